@@ -5,6 +5,9 @@
 /* Disable deprecated functions and enums while building */
 #define GSL_DISABLE_DEPRECATED 1
 
+/* Define if the compiler has the __atomic builtins */
+#undef HAVE_ATOMIC_BUILTINS
+
 /* Define if you have inline with C99 behavior */
 #undef HAVE_C99_INLINE
 
@@ -107,9 +110,15 @@
 /* Define to 1 if you have the <memory.h> header file. */
 #define HAVE_MEMORY_H 1
 
+/* Define to 1 if you have the `mmap' function. */
+#undef HAVE_MMAP
+
 /* Define this if printf can handle %Lf for long double */
 #define HAVE_PRINTF_LONGDOUBLE 1
 
+/* Define to 1 if you have the <stdatomic.h> header file. */
+#undef HAVE_STDATOMIC_H
+
 /* Define to 1 if you have the <stdint.h> header file. */
 #undef HAVE_STDINT_H
 
@@ -131,6 +140,9 @@
 /* Define to 1 if you have the `strtoul' function. */
 #define HAVE_STRTOUL 1
 
+/* Define to 1 if you have the <sys/mman.h> header file. */
+#undef HAVE_SYS_MMAN_H
+
 /* Define to 1 if you have the <sys/stat.h> header file. */
 #define HAVE_SYS_STAT_H 1
 
@@ -171,6 +183,9 @@
 /* Define to 1 if you have the ANSI C header files. */
 #define STDC_HEADERS 1
 
+/* Define to the storage class for thread-local variables */
+#undef THREAD_LOCAL
+
 /* Version number of package */
 #define VERSION "2.4"
 
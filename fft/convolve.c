@@ -0,0 +1,516 @@
+/* fft/convolve.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+#include <gsl/gsl_fft_convolve.h>
+
+/*
+ * This module computes the causal convolution
+ *
+ *   y_i = sum_{k=0}^{K-1} h_k x_{i-k}
+ *
+ * of an unbounded input stream x with a kernel h of length K. Short
+ * kernels are applied directly. Longer kernels are applied blockwise
+ * with real FFTs of length nfft, each block consuming L = nfft - K + 1
+ * new samples, using either the overlap-add or the overlap-save method.
+ * Correlation is convolution with the reversed kernel.
+ */
+
+static int convolve_direct(const double x[], const size_t n, double y[], gsl_fft_convolve_workspace * w);
+static int convolve_block(const double x[], const size_t n, double y[], gsl_fft_convolve_workspace * w);
+static int convolve_set_kernel(const double kernel[], const size_t stride, const int reverse,
+                               gsl_fft_convolve_workspace * w);
+
+/*
+gsl_fft_convolve_alloc()
+  Allocate a workspace for convolution with a kernel of length K
+
+Inputs: K      - kernel length
+        method - direct, FFT, or automatic choice based on K
+        mode   - overlap-add or overlap-save (for the FFT method)
+
+Return: pointer to workspace
+*/
+
+gsl_fft_convolve_workspace *
+gsl_fft_convolve_alloc(const size_t K, const gsl_fft_convolve_method_t method,
+                       const gsl_fft_convolve_mode_t mode)
+{
+  gsl_fft_convolve_workspace *w;
+
+  if (K == 0)
+    {
+      GSL_ERROR_NULL ("kernel length must be positive", GSL_EINVAL);
+    }
+
+  w = calloc(1, sizeof(gsl_fft_convolve_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->K = K;
+  w->mode = mode;
+
+  if (method == GSL_FFT_CONVOLVE_FFT)
+    w->use_fft = 1;
+  else if (method == GSL_FFT_CONVOLVE_DIRECT)
+    w->use_fft = 0;
+  else
+    w->use_fft = (K > GSL_FFT_CONVOLVE_DIRECT_MAX);
+
+  /* nfft is the smallest power of 2 >= 4K, so that each block
+   * consumes at least 3K new samples */
+  w->nfft = 4;
+  while (w->nfft < 4 * K)
+    w->nfft *= 2;
+
+  w->L = w->nfft - K + 1;
+
+  w->kernel = malloc(K * sizeof(double));
+  if (w->kernel == 0)
+    {
+      gsl_fft_convolve_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for kernel", GSL_ENOMEM);
+    }
+
+  w->state = calloc(K, sizeof(double));
+  if (w->state == 0)
+    {
+      gsl_fft_convolve_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for state", GSL_ENOMEM);
+    }
+
+  if (w->use_fft)
+    {
+      w->kernel_fft = malloc(w->nfft * sizeof(double));
+      if (w->kernel_fft == 0)
+        {
+          gsl_fft_convolve_free(w);
+          GSL_ERROR_NULL ("failed to allocate space for kernel_fft", GSL_ENOMEM);
+        }
+
+      w->block = malloc(w->nfft * sizeof(double));
+      if (w->block == 0)
+        {
+          gsl_fft_convolve_free(w);
+          GSL_ERROR_NULL ("failed to allocate space for block", GSL_ENOMEM);
+        }
+
+      w->wavetable = gsl_fft_real_packed_wavetable_alloc(w->nfft);
+      if (w->wavetable == 0)
+        {
+          gsl_fft_convolve_free(w);
+          GSL_ERROR_NULL ("failed to allocate wavetable", GSL_ENOMEM);
+        }
+
+      w->work = gsl_fft_real_packed_workspace_alloc(w->nfft);
+      if (w->work == 0)
+        {
+          gsl_fft_convolve_free(w);
+          GSL_ERROR_NULL ("failed to allocate fft workspace", GSL_ENOMEM);
+        }
+    }
+
+  return w;
+}
+
+void
+gsl_fft_convolve_free(gsl_fft_convolve_workspace * w)
+{
+  RETURN_IF_NULL(w);
+
+  if (w->kernel)
+    free(w->kernel);
+
+  if (w->kernel_fft)
+    free(w->kernel_fft);
+
+  if (w->block)
+    free(w->block);
+
+  if (w->state)
+    free(w->state);
+
+  if (w->wavetable)
+    gsl_fft_real_packed_wavetable_free(w->wavetable);
+
+  if (w->work)
+    gsl_fft_real_packed_workspace_free(w->work);
+
+  free(w);
+}
+
+/*
+gsl_fft_convolve_init()
+  Set the kernel for a convolution and reset the stream state
+
+Inputs: kernel - kernel h, length w->K
+        stride - stride of kernel
+        w      - workspace
+
+Notes: the transform of the kernel is computed here once and reused
+for every block of the stream
+*/
+
+int
+gsl_fft_convolve_init(const double kernel[], const size_t stride,
+                      gsl_fft_convolve_workspace * w)
+{
+  return convolve_set_kernel(kernel, stride, 0, w);
+}
+
+/*
+gsl_fft_correlate_init()
+  Set the kernel for a correlation and reset the stream state.
+The stream output is then
+
+  y_i = sum_{k=0}^{K-1} h_k x_{i-K+1+k}
+
+i.e. the cross-correlation at lag i - K + 1.
+*/
+
+int
+gsl_fft_correlate_init(const double kernel[], const size_t stride,
+                       gsl_fft_convolve_workspace * w)
+{
+  return convolve_set_kernel(kernel, stride, 1, w);
+}
+
+/*
+gsl_fft_convolve_stream()
+  Process the next n samples of the input stream
+
+Inputs: x - next n input samples
+        n - number of samples
+        y - (output) next n output samples
+        w - workspace
+
+Notes: x and y may not overlap
+*/
+
+int
+gsl_fft_convolve_stream(const double x[], const size_t n, double y[],
+                        gsl_fft_convolve_workspace * w)
+{
+  if (w->use_fft)
+    {
+      size_t i = 0;
+
+      while (i < n)
+        {
+          const size_t r = GSL_MIN(w->L, n - i);
+          int status = convolve_block(x + i, r, y + i, w);
+
+          if (status)
+            return status;
+
+          i += r;
+        }
+
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      return convolve_direct(x, n, y, w);
+    }
+}
+
+/*
+gsl_fft_convolve_flush()
+  Terminate the input stream with K - 1 zeros, which produces the
+final K - 1 outputs of the full linear convolution
+
+Inputs: y - (output) final K - 1 outputs
+        w - workspace
+
+Notes: the stream state is reset afterwards
+*/
+
+int
+gsl_fft_convolve_flush(double y[], gsl_fft_convolve_workspace * w)
+{
+  const size_t K = w->K;
+  int status = GSL_SUCCESS;
+
+  if (K > 1)
+    {
+      if (w->use_fft)
+        status = convolve_block(NULL, K - 1, y, w);
+      else
+        status = convolve_direct(NULL, K - 1, y, w);
+    }
+
+  memset(w->state, 0, K * sizeof(double));
+
+  return status;
+}
+
+/*
+gsl_fft_convolve()
+  Full linear convolution of a finite signal with a kernel
+
+Inputs: x      - input signal, length nx
+        nx     - signal length
+        kernel - kernel, length w->K
+        y      - (output) convolution, length nx + K - 1
+        w      - workspace
+*/
+
+int
+gsl_fft_convolve(const double x[], const size_t nx, const double kernel[],
+                 double y[], gsl_fft_convolve_workspace * w)
+{
+  int status = gsl_fft_convolve_init(kernel, 1, w);
+
+  if (status)
+    return status;
+
+  status = gsl_fft_convolve_stream(x, nx, y, w);
+  if (status)
+    return status;
+
+  return gsl_fft_convolve_flush(y + nx, w);
+}
+
+/*
+gsl_fft_correlate()
+  Full cross-correlation of a finite signal with a kernel,
+
+  y_j = sum_k h_k x_{j-K+1+k},  j = 0, ..., nx + K - 2
+
+Inputs: x      - input signal, length nx
+        nx     - signal length
+        kernel - kernel, length w->K
+        y      - (output) correlation, length nx + K - 1
+        w      - workspace
+*/
+
+int
+gsl_fft_correlate(const double x[], const size_t nx, const double kernel[],
+                  double y[], gsl_fft_convolve_workspace * w)
+{
+  int status = gsl_fft_correlate_init(kernel, 1, w);
+
+  if (status)
+    return status;
+
+  status = gsl_fft_convolve_stream(x, nx, y, w);
+  if (status)
+    return status;
+
+  return gsl_fft_convolve_flush(y + nx, w);
+}
+
+static int
+convolve_set_kernel(const double kernel[], const size_t stride, const int reverse,
+                    gsl_fft_convolve_workspace * w)
+{
+  const size_t K = w->K;
+  size_t i;
+
+  if (stride == 0)
+    {
+      GSL_ERROR ("stride must be positive", GSL_EINVAL);
+    }
+
+  for (i = 0; i < K; ++i)
+    {
+      const double hi = kernel[i * stride];
+
+      if (reverse)
+        w->kernel[K - 1 - i] = hi;
+      else
+        w->kernel[i] = hi;
+    }
+
+  memset(w->state, 0, K * sizeof(double));
+
+  if (w->use_fft)
+    {
+      const size_t nfft = w->nfft;
+      const double scale = 1.0 / (double) nfft;
+
+      /* fold the 1/nfft normalization of the inverse transform into the kernel */
+      for (i = 0; i < K; ++i)
+        w->kernel_fft[i] = scale * w->kernel[i];
+
+      for (i = K; i < nfft; ++i)
+        w->kernel_fft[i] = 0.0;
+
+      return gsl_fft_real_packed_transform(w->kernel_fft, 1, nfft, w->wavetable, w->work);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/*
+convolve_direct()
+  Direct summation; the last K - 1 inputs are kept in w->state.
+If x is NULL the input is taken to be zero.
+*/
+
+static int
+convolve_direct(const double x[], const size_t n, double y[], gsl_fft_convolve_workspace * w)
+{
+  const size_t K = w->K;
+  const double *h = w->kernel;
+  double *hist = w->state;
+  size_t i, k;
+
+  for (i = 0; i < n; ++i)
+    {
+      double sum = 0.0;
+
+      /* terms with current input samples, x_{i-k} for k <= i */
+      if (x != NULL)
+        {
+          const size_t kmax = GSL_MIN(i + 1, K);
+
+          for (k = 0; k < kmax; ++k)
+            sum += h[k] * x[i - k];
+        }
+
+      /* terms with samples before this call, hist[K-1+i-k] = x_{i-k} */
+      for (k = i + 1; k < K; ++k)
+        sum += h[k] * hist[K - 1 + i - k];
+
+      y[i] = sum;
+    }
+
+  /* update the history with the last K - 1 inputs */
+  if (K > 1)
+    {
+      const size_t m = K - 1;
+
+      if (n >= m)
+        {
+          for (i = 0; i < m; ++i)
+            hist[i] = (x != NULL) ? x[n - m + i] : 0.0;
+        }
+      else
+        {
+          memmove(hist, hist + n, (m - n) * sizeof(double));
+
+          for (i = 0; i < n; ++i)
+            hist[m - n + i] = (x != NULL) ? x[i] : 0.0;
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* multiply two half-complex arrays of even length n: a := a * b */
+static void
+halfcomplex_mul(double a[], const double b[], const size_t n)
+{
+  size_t k;
+
+  a[0] *= b[0];
+  a[n - 1] *= b[n - 1];
+
+  for (k = 1; k < n / 2; ++k)
+    {
+      const double ar = a[2 * k - 1], ai = a[2 * k];
+      const double br = b[2 * k - 1], bi = b[2 * k];
+
+      a[2 * k - 1] = ar * br - ai * bi;
+      a[2 * k] = ar * bi + ai * br;
+    }
+}
+
+/*
+convolve_block()
+  Process r <= L input samples with one forward and one backward FFT
+of length nfft. If x is NULL the input is taken to be zero.
+*/
+
+static int
+convolve_block(const double x[], const size_t r, double y[], gsl_fft_convolve_workspace * w)
+{
+  const size_t K = w->K;
+  const size_t m = K - 1;
+  const size_t nfft = w->nfft;
+  double *block = w->block;
+  double *state = w->state;
+  size_t i;
+  int status;
+
+  if (w->mode == GSL_FFT_CONVOLVE_OVERLAP_SAVE)
+    {
+      /* block = [ last K-1 inputs | r new inputs | zeros ] */
+      memcpy(block, state, m * sizeof(double));
+
+      if (x != NULL)
+        memcpy(block + m, x, r * sizeof(double));
+      else
+        memset(block + m, 0, r * sizeof(double));
+
+      memset(block + m + r, 0, (nfft - m - r) * sizeof(double));
+
+      /* the new history is the last K-1 entries of the input part */
+      memcpy(state, block + r, m * sizeof(double));
+    }
+  else
+    {
+      /* block = [ r new inputs | zeros ] */
+      if (x != NULL)
+        memcpy(block, x, r * sizeof(double));
+      else
+        memset(block, 0, r * sizeof(double));
+
+      memset(block + r, 0, (nfft - r) * sizeof(double));
+    }
+
+  status = gsl_fft_real_packed_transform(block, 1, nfft, w->wavetable, w->work);
+  if (status)
+    return status;
+
+  halfcomplex_mul(block, w->kernel_fft, nfft);
+
+  status = gsl_fft_halfcomplex_packed_backward(block, 1, nfft, w->wavetable, w->work);
+  if (status)
+    return status;
+
+  if (w->mode == GSL_FFT_CONVOLVE_OVERLAP_SAVE)
+    {
+      /* the first K-1 outputs are corrupted by circular wrap-around */
+      memcpy(y, block + m, r * sizeof(double));
+    }
+  else
+    {
+      /* add the tail carried over from previous blocks */
+      for (i = 0; i < m; ++i)
+        block[i] += state[i];
+
+      memcpy(y, block, r * sizeof(double));
+
+      /* the new tail is block[r..r+K-2]; for r < K-1 this still
+       * includes part of the previous tail, added above */
+      memcpy(state, block + r, m * sizeof(double));
+    }
+
+  return GSL_SUCCESS;
+}
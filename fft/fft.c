@@ -99,6 +99,7 @@
 #include "real_pass_n.c"
 #include "real_radix2.c"
 #include "real_unpack.c"
+#include "real_packed.c"
 #include "templates_off.h"
 #undef  BASE_DOUBLE
 
@@ -113,5 +114,6 @@
 #include "real_pass_n.c"
 #include "real_radix2.c"
 #include "real_unpack.c"
+#include "real_packed.c"
 #include "templates_off.h"
 #undef  BASE_FLOAT
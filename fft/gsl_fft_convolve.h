@@ -0,0 +1,91 @@
+/* fft/gsl_fft_convolve.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_FFT_CONVOLVE_H__
+#define __GSL_FFT_CONVOLVE_H__
+
+#include <stddef.h>
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_fft_real.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* kernels up to this length are applied directly in automatic mode */
+#define GSL_FFT_CONVOLVE_DIRECT_MAX   64
+
+typedef enum
+{
+  GSL_FFT_CONVOLVE_AUTO,    /* choose direct or FFT method from kernel length */
+  GSL_FFT_CONVOLVE_DIRECT,  /* direct O(n K) summation */
+  GSL_FFT_CONVOLVE_FFT      /* block FFT, O(n log K) */
+} gsl_fft_convolve_method_t;
+
+typedef enum
+{
+  GSL_FFT_CONVOLVE_OVERLAP_ADD,  /* carry the tail of each block output */
+  GSL_FFT_CONVOLVE_OVERLAP_SAVE  /* carry the last K - 1 input samples */
+} gsl_fft_convolve_mode_t;
+
+typedef struct
+{
+  size_t K;                               /* kernel length */
+  size_t nfft;                            /* FFT length */
+  size_t L;                               /* new input samples per FFT block */
+  int use_fft;                            /* process blocks with the FFT */
+  gsl_fft_convolve_mode_t mode;           /* overlap-add or overlap-save */
+  double *kernel;                         /* kernel, size K */
+  double *kernel_fft;                     /* scaled half-complex transform of padded kernel, size nfft */
+  double *block;                          /* block work array, size nfft */
+  double *state;                          /* overlap tail or input history, size K - 1 */
+  gsl_fft_real_packed_wavetable *wavetable;
+  gsl_fft_real_packed_workspace *work;
+} gsl_fft_convolve_workspace;
+
+gsl_fft_convolve_workspace *gsl_fft_convolve_alloc (const size_t K,
+                                                    const gsl_fft_convolve_method_t method,
+                                                    const gsl_fft_convolve_mode_t mode);
+void gsl_fft_convolve_free (gsl_fft_convolve_workspace * w);
+
+int gsl_fft_convolve_init (const double kernel[], const size_t stride,
+                           gsl_fft_convolve_workspace * w);
+int gsl_fft_correlate_init (const double kernel[], const size_t stride,
+                            gsl_fft_convolve_workspace * w);
+int gsl_fft_convolve_stream (const double x[], const size_t n, double y[],
+                             gsl_fft_convolve_workspace * w);
+int gsl_fft_convolve_flush (double y[], gsl_fft_convolve_workspace * w);
+
+int gsl_fft_convolve (const double x[], const size_t nx, const double kernel[],
+                      double y[], gsl_fft_convolve_workspace * w);
+int gsl_fft_correlate (const double x[], const size_t nx, const double kernel[],
+                       double y[], gsl_fft_convolve_workspace * w);
+
+__END_DECLS
+
+#endif /* __GSL_FFT_CONVOLVE_H__ */
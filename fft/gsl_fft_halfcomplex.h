@@ -50,6 +50,7 @@ typedef struct
     size_t factor[64];
     gsl_complex *twiddle[64];
     gsl_complex *trig;
+    gsl_fft_real_packed_wavetable *packed;   /* even n only */
   }
 gsl_fft_halfcomplex_wavetable;
 
@@ -81,6 +82,24 @@ gsl_fft_halfcomplex_radix2_unpack (const double halfcomplex_coefficient[],
                                    double complex_coefficient[],
                                    const size_t stride, const size_t n);
 
+int gsl_fft_halfcomplex_packed_backward (double data[], const size_t stride, const size_t n,
+                                         const gsl_fft_real_packed_wavetable * wavetable,
+                                         gsl_fft_real_packed_workspace * work);
+
+int gsl_fft_halfcomplex_packed_inverse (double data[], const size_t stride, const size_t n,
+                                        const gsl_fft_real_packed_wavetable * wavetable,
+                                        gsl_fft_real_packed_workspace * work);
+
+int
+gsl_fft_halfcomplex_unpack_half (const double halfcomplex_coefficient[],
+                                 double complex_coefficient[],
+                                 const size_t stride, const size_t n);
+
+int
+gsl_fft_halfcomplex_pack_half (const double complex_coefficient[],
+                               double halfcomplex_coefficient[],
+                               const size_t stride, const size_t n);
+
 __END_DECLS
 
 #endif /* __GSL_FFT_HALFCOMPLEX_H__ */
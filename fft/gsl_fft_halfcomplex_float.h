@@ -50,6 +50,7 @@ typedef struct
     size_t factor[64];
     gsl_complex_float *twiddle[64];
     gsl_complex_float *trig;
+    gsl_fft_real_packed_wavetable_float *packed;   /* even n only */
   }
 gsl_fft_halfcomplex_wavetable_float;
 
@@ -81,6 +82,24 @@ gsl_fft_halfcomplex_float_radix2_unpack (const float halfcomplex_coefficient[],
                                          float complex_coefficient[],
                                          const size_t stride, const size_t n);
 
+int gsl_fft_halfcomplex_float_packed_backward (float data[], const size_t stride, const size_t n,
+                                               const gsl_fft_real_packed_wavetable_float * wavetable,
+                                               gsl_fft_real_packed_workspace_float * work);
+
+int gsl_fft_halfcomplex_float_packed_inverse (float data[], const size_t stride, const size_t n,
+                                              const gsl_fft_real_packed_wavetable_float * wavetable,
+                                              gsl_fft_real_packed_workspace_float * work);
+
+int
+gsl_fft_halfcomplex_float_unpack_half (const float halfcomplex_coefficient[],
+                                       float complex_coefficient[],
+                                       const size_t stride, const size_t n);
+
+int
+gsl_fft_halfcomplex_float_pack_half (const float complex_coefficient[],
+                                     float halfcomplex_coefficient[],
+                                     const size_t stride, const size_t n);
+
 __END_DECLS
 
 #endif /* __GSL_FFT_HALFCOMPLEX_FLOAT_H__ */
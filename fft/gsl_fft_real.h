@@ -25,6 +25,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_complex.h>
 #include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -40,6 +41,28 @@ __BEGIN_DECLS
 
 int gsl_fft_real_radix2_transform (double data[], const size_t stride, const size_t n) ;
 
+/* Real transforms of even length n computed with an n/2 point complex
+   transform of the packed data, followed by a twiddle step which
+   separates the spectra of the even and odd samples.
+   gsl_fft_real_transform and gsl_fft_halfcomplex_transform use them
+   for all even n > 1. */
+
+typedef struct
+  {
+    size_t n;
+    gsl_fft_complex_wavetable *cwavetable;
+    gsl_complex *trig;
+  }
+gsl_fft_real_packed_wavetable;
+
+typedef struct
+  {
+    size_t n;
+    double *packed;
+    gsl_fft_complex_workspace *cwork;
+  }
+gsl_fft_real_packed_workspace;
+
 typedef struct
   {
     size_t n;
@@ -47,13 +70,15 @@ typedef struct
     size_t factor[64];
     gsl_complex *twiddle[64];
     gsl_complex *trig;
+    gsl_fft_real_packed_wavetable *packed;   /* even n only */
   }
 gsl_fft_real_wavetable;
 
 typedef struct
   {
     size_t n;
-    double *scratch;
+    double *scratch;                         /* odd n only */
+    gsl_fft_real_packed_workspace *packed;   /* even n only */
   }
 gsl_fft_real_workspace;
 
@@ -75,6 +100,21 @@ int gsl_fft_real_unpack (const double real_coefficient[],
                          double complex_coefficient[],
                          const size_t stride, const size_t n);
 
+/* Real transforms of even length n computed with an n/2 point complex
+   transform of the packed data (see gsl_fft_real_packed_wavetable) */
+
+gsl_fft_real_packed_wavetable * gsl_fft_real_packed_wavetable_alloc (size_t n);
+
+void gsl_fft_real_packed_wavetable_free (gsl_fft_real_packed_wavetable * wavetable);
+
+gsl_fft_real_packed_workspace * gsl_fft_real_packed_workspace_alloc (size_t n);
+
+void gsl_fft_real_packed_workspace_free (gsl_fft_real_packed_workspace * workspace);
+
+int gsl_fft_real_packed_transform (double data[], const size_t stride, const size_t n,
+                                   const gsl_fft_real_packed_wavetable * wavetable,
+                                   gsl_fft_real_packed_workspace * work);
+
 __END_DECLS
 
 #endif /* __GSL_FFT_REAL_H__ */
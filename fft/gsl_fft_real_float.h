@@ -25,6 +25,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_complex.h>
 #include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex_float.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -40,6 +41,28 @@ __BEGIN_DECLS
 
 int gsl_fft_real_float_radix2_transform (float data[], const size_t stride, const size_t n) ;
 
+/* Real transforms of even length n computed with an n/2 point complex
+   transform of the packed data, followed by a twiddle step which
+   separates the spectra of the even and odd samples.
+   gsl_fft_real_transform and gsl_fft_halfcomplex_transform use them
+   for all even n > 1. */
+
+typedef struct
+  {
+    size_t n;
+    gsl_fft_complex_wavetable_float *cwavetable;
+    gsl_complex_float *trig;
+  }
+gsl_fft_real_packed_wavetable_float;
+
+typedef struct
+  {
+    size_t n;
+    float *packed;
+    gsl_fft_complex_workspace_float *cwork;
+  }
+gsl_fft_real_packed_workspace_float;
+
 typedef struct
   {
     size_t n;
@@ -47,13 +70,15 @@ typedef struct
     size_t factor[64];
     gsl_complex_float *twiddle[64];
     gsl_complex_float *trig;
+    gsl_fft_real_packed_wavetable_float *packed;   /* even n only */
   }
 gsl_fft_real_wavetable_float;
 
 typedef struct
   {
     size_t n;
-    float *scratch;
+    float *scratch;                                /* odd n only */
+    gsl_fft_real_packed_workspace_float *packed;   /* even n only */
   }
 gsl_fft_real_workspace_float;
 
@@ -74,6 +99,21 @@ int gsl_fft_real_float_unpack (const float real_float_coefficient[],
                                float complex_coefficient[],
                                const size_t stride, const size_t n);
 
+/* Real transforms of even length n computed with an n/2 point complex
+   transform of the packed data (see gsl_fft_real_packed_wavetable) */
+
+gsl_fft_real_packed_wavetable_float * gsl_fft_real_packed_wavetable_float_alloc (size_t n);
+
+void gsl_fft_real_packed_wavetable_float_free (gsl_fft_real_packed_wavetable_float * wavetable);
+
+gsl_fft_real_packed_workspace_float * gsl_fft_real_packed_workspace_float_alloc (size_t n);
+
+void gsl_fft_real_packed_workspace_float_free (gsl_fft_real_packed_workspace_float * workspace);
+
+int gsl_fft_real_float_packed_transform (float data[], const size_t stride, const size_t n,
+                                         const gsl_fft_real_packed_wavetable_float * wavetable,
+                                         gsl_fft_real_packed_workspace_float * work);
+
 __END_DECLS
 
 #endif /* __GSL_FFT_REAL_FLOAT_H__ */
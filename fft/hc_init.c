@@ -110,6 +110,26 @@ FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (size_t n)
       GSL_ERROR_VAL ("overflowed trigonometric lookup table", GSL_ESANITY, 0);
     }
 
+  /* even lengths are transformed through the packed n/2 point
+     complex transform */
+
+  wavetable->packed = 0;
+
+  if (n % 2 == 0)
+    {
+      wavetable->packed = FUNCTION(gsl_fft_real_packed_wavetable,alloc) (n);
+
+      if (wavetable->packed == NULL)
+        {
+          /* error in constructor, prevent memory leak */
+
+          free(wavetable->trig) ; 
+          free(wavetable) ; 
+
+          GSL_ERROR_VAL ("failed to allocate packed wavetable", GSL_ENOMEM, 0);
+        }
+    }
+
   return wavetable;
 }
 
@@ -123,6 +143,9 @@ FUNCTION(gsl_fft_halfcomplex_wavetable,free) (TYPE(gsl_fft_halfcomplex_wavetable
   free (wavetable->trig);
   wavetable->trig = NULL;
 
+  FUNCTION(gsl_fft_real_packed_wavetable,free) (wavetable->packed);
+  wavetable->packed = NULL;
+
   free (wavetable);
 }
 
@@ -103,6 +103,15 @@ FUNCTION(gsl_fft_halfcomplex,transform) (BASE data[], const size_t stride, const
       GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
     }
 
+  /* even lengths go through the packed n/2 point complex transform */
+
+  if (n % 2 == 0)
+    {
+      return FUNCTION(gsl_fft_halfcomplex,packed_backward) (data, stride, n,
+                                                            wavetable->packed,
+                                                            work->packed);
+    }
+
   nf = wavetable->nf;
   product = 1;
   state = 0;
@@ -88,3 +88,69 @@ FUNCTION(gsl_fft_halfcomplex,radix2_unpack) (const BASE halfcomplex_coefficient[
   return 0;
 }
 
+
+
+int
+FUNCTION(gsl_fft_halfcomplex,unpack_half) (const BASE halfcomplex_coefficient[],
+                                           BASE complex_coefficient[],
+                                           const size_t stride, const size_t n)
+{
+  /* Like gsl_fft_halfcomplex_unpack but only the n/2 + 1 non-redundant
+     coefficients z_0 ... z_{n/2} are written to the complex array */
+
+  size_t i;
+
+  if (n == 0)
+    {
+      GSL_ERROR ("length n must be positive integer", GSL_EDOM);
+    }
+
+  REAL(complex_coefficient,stride,0) = halfcomplex_coefficient[0];
+  IMAG(complex_coefficient,stride,0) = 0.0;
+
+  for (i = 1; i < n - i; i++)
+    {
+      REAL(complex_coefficient,stride,i) = halfcomplex_coefficient[(2 * i - 1) * stride];
+      IMAG(complex_coefficient,stride,i) = halfcomplex_coefficient[2 * i * stride];
+    }
+
+  if (i == n - i)
+    {
+      REAL(complex_coefficient,stride,i) = halfcomplex_coefficient[(n - 1) * stride];
+      IMAG(complex_coefficient,stride,i) = 0.0;
+    }
+
+  return 0;
+}
+
+
+int
+FUNCTION(gsl_fft_halfcomplex,pack_half) (const BASE complex_coefficient[],
+                                         BASE halfcomplex_coefficient[],
+                                         const size_t stride, const size_t n)
+{
+  /* Inverse of gsl_fft_halfcomplex_unpack_half, the imaginary parts of
+     z_0 and z_{n/2} (n even) are assumed to be zero and are ignored */
+
+  size_t i;
+
+  if (n == 0)
+    {
+      GSL_ERROR ("length n must be positive integer", GSL_EDOM);
+    }
+
+  halfcomplex_coefficient[0] = REAL(complex_coefficient,stride,0);
+
+  for (i = 1; i < n - i; i++)
+    {
+      halfcomplex_coefficient[(2 * i - 1) * stride] = REAL(complex_coefficient,stride,i);
+      halfcomplex_coefficient[2 * i * stride] = IMAG(complex_coefficient,stride,i);
+    }
+
+  if (i == n - i)
+    {
+      halfcomplex_coefficient[(n - 1) * stride] = REAL(complex_coefficient,stride,i);
+    }
+
+  return 0;
+}
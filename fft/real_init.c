@@ -119,6 +119,26 @@ FUNCTION(gsl_fft_real_wavetable,alloc) (size_t n)
                         GSL_ESANITY, 0);
     }
 
+  /* even lengths are transformed through the packed n/2 point
+     complex transform */
+
+  wavetable->packed = 0;
+
+  if (n % 2 == 0)
+    {
+      wavetable->packed = FUNCTION(gsl_fft_real_packed_wavetable,alloc) (n);
+
+      if (wavetable->packed == NULL)
+        {
+          /* error in constructor, prevent memory leak */
+
+          free(wavetable->trig);
+          free(wavetable) ; 
+
+          GSL_ERROR_VAL ("failed to allocate packed wavetable", GSL_ENOMEM, 0);
+        }
+    }
+
   return wavetable;
 }
 
@@ -141,6 +161,27 @@ FUNCTION(gsl_fft_real_workspace,alloc) (size_t n)
     }
 
   workspace->n = n;
+  workspace->scratch = 0;
+  workspace->packed = 0;
+
+  /* even lengths use the packed transform, which has its own
+     scratch space */
+
+  if (n % 2 == 0)
+    {
+      workspace->packed = FUNCTION(gsl_fft_real_packed_workspace,alloc) (n);
+
+      if (workspace->packed == NULL)
+        {
+          /* error in constructor, prevent memory leak */
+
+          free(workspace) ; 
+
+          GSL_ERROR_VAL ("failed to allocate packed workspace", GSL_ENOMEM, 0);
+        }
+
+      return workspace;
+    }
 
   workspace->scratch = (BASE *) malloc (n * sizeof (BASE));
 
@@ -167,6 +208,9 @@ FUNCTION(gsl_fft_real_wavetable,free) (TYPE(gsl_fft_real_wavetable) * wavetable)
   free (wavetable->trig);
   wavetable->trig = NULL;
 
+  FUNCTION(gsl_fft_real_packed_wavetable,free) (wavetable->packed);
+  wavetable->packed = NULL;
+
   free (wavetable) ;
 }
 
@@ -179,5 +223,8 @@ FUNCTION(gsl_fft_real_workspace,free) (TYPE(gsl_fft_real_workspace) * workspace)
   free (workspace->scratch);
   workspace->scratch = NULL;
 
+  FUNCTION(gsl_fft_real_packed_workspace,free) (workspace->packed);
+  workspace->packed = NULL;
+
   free (workspace) ;
 }
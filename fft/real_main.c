@@ -69,6 +69,15 @@ FUNCTION(gsl_fft_real,transform) (BASE data[], const size_t stride, const size_t
       GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
     }
 
+  /* even lengths go through the packed n/2 point complex transform */
+
+  if (n % 2 == 0)
+    {
+      return FUNCTION(gsl_fft_real,packed_transform) (data, stride, n,
+                                                      wavetable->packed,
+                                                      work->packed);
+    }
+
   for (i = 0; i < nf; i++)
     {
       const size_t factor = wavetable->factor[i];
@@ -0,0 +1,357 @@
+/* fft/real_packed.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* A real sequence x of even length n is treated as a complex sequence
+   z_j = x_{2j} + i x_{2j+1} of length m = n/2.  If Z = FFT(z) then the
+   transforms of the even and odd samples are
+
+     E_k = (Z_k + conj(Z_{m-k}))/2,   O_k = (Z_k - conj(Z_{m-k}))/(2i)
+
+   and X_k = E_k + w^k O_k with w = exp(-2 pi i/n).  The backward
+   transform runs the same steps in reverse.  All of the heavy lifting
+   is done by the mixed-radix complex transform of length n/2. */
+
+TYPE(gsl_fft_real_packed_wavetable) *
+FUNCTION(gsl_fft_real_packed_wavetable,alloc) (size_t n)
+{
+  size_t k;
+  const size_t m = n / 2;
+  const double d_theta = 2.0 * M_PI / ((double) n);
+
+  TYPE(gsl_fft_real_packed_wavetable) * wavetable;
+
+  if (n == 0)
+    {
+      GSL_ERROR_VAL ("length n must be positive integer", GSL_EDOM, 0);
+    }
+
+  if (n > 1 && n % 2 != 0)
+    {
+      GSL_ERROR_VAL ("length n must be even", GSL_EINVAL, 0);
+    }
+
+  wavetable = (TYPE(gsl_fft_real_packed_wavetable) *)
+    malloc(sizeof(TYPE(gsl_fft_real_packed_wavetable)));
+
+  if (wavetable == NULL)
+    {
+      GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
+    }
+
+  wavetable->n = n;
+
+  if (n == 1)
+    {
+      wavetable->cwavetable = 0;
+      wavetable->trig = 0;
+      return wavetable;
+    }
+
+  wavetable->trig = (TYPE(gsl_complex) *) malloc (m * sizeof (TYPE(gsl_complex)));
+
+  if (wavetable->trig == NULL)
+    {
+      /* error in constructor, prevent memory leak */
+
+      free (wavetable);
+
+      GSL_ERROR_VAL ("failed to allocate trigonometric lookup table",
+                     GSL_ENOMEM, 0);
+    }
+
+  wavetable->cwavetable = FUNCTION(gsl_fft_complex_wavetable,alloc) (m);
+
+  if (wavetable->cwavetable == NULL)
+    {
+      /* error in constructor, prevent memory leak */
+
+      free (wavetable->trig);
+      free (wavetable);
+
+      GSL_ERROR_VAL ("failed to allocate complex wavetable", GSL_ENOMEM, 0);
+    }
+
+  for (k = 0; k < m; k++)
+    {
+      const double theta = d_theta * k;
+      GSL_REAL(wavetable->trig[k]) = cos (theta);
+      GSL_IMAG(wavetable->trig[k]) = -sin (theta);
+    }
+
+  return wavetable;
+}
+
+TYPE(gsl_fft_real_packed_workspace) *
+FUNCTION(gsl_fft_real_packed_workspace,alloc) (size_t n)
+{
+  TYPE(gsl_fft_real_packed_workspace) * workspace;
+
+  if (n == 0)
+    {
+      GSL_ERROR_VAL ("length n must be positive integer", GSL_EDOM, 0);
+    }
+
+  if (n > 1 && n % 2 != 0)
+    {
+      GSL_ERROR_VAL ("length n must be even", GSL_EINVAL, 0);
+    }
+
+  workspace = (TYPE(gsl_fft_real_packed_workspace) *)
+    malloc(sizeof(TYPE(gsl_fft_real_packed_workspace)));
+
+  if (workspace == NULL)
+    {
+      GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
+    }
+
+  workspace->n = n;
+
+  workspace->packed = (BASE *) malloc (n * sizeof (BASE));
+
+  if (workspace->packed == NULL)
+    {
+      /* error in constructor, prevent memory leak */
+
+      free (workspace);
+
+      GSL_ERROR_VAL ("failed to allocate packed array", GSL_ENOMEM, 0);
+    }
+
+  if (n == 1)
+    {
+      workspace->cwork = 0;
+      return workspace;
+    }
+
+  workspace->cwork = FUNCTION(gsl_fft_complex_workspace,alloc) (n / 2);
+
+  if (workspace->cwork == NULL)
+    {
+      /* error in constructor, prevent memory leak */
+
+      free (workspace->packed);
+      free (workspace);
+
+      GSL_ERROR_VAL ("failed to allocate complex workspace", GSL_ENOMEM, 0);
+    }
+
+  return workspace;
+}
+
+void
+FUNCTION(gsl_fft_real_packed_wavetable,free) (TYPE(gsl_fft_real_packed_wavetable) * wavetable)
+{
+  RETURN_IF_NULL (wavetable);
+
+  FUNCTION(gsl_fft_complex_wavetable,free) (wavetable->cwavetable);
+  free (wavetable->trig);
+  free (wavetable);
+}
+
+void
+FUNCTION(gsl_fft_real_packed_workspace,free) (TYPE(gsl_fft_real_packed_workspace) * workspace)
+{
+  RETURN_IF_NULL (workspace);
+
+  FUNCTION(gsl_fft_complex_workspace,free) (workspace->cwork);
+  free (workspace->packed);
+  free (workspace);
+}
+
+static int
+FUNCTION(fft_real_packed,check) (const size_t n,
+                                 const TYPE(gsl_fft_real_packed_wavetable) * wavetable,
+                                 const TYPE(gsl_fft_real_packed_workspace) * work)
+{
+  if (n == 0)
+    {
+      GSL_ERROR ("length n must be positive integer", GSL_EDOM);
+    }
+
+  if (n > 1 && n % 2 != 0)
+    {
+      GSL_ERROR ("length n must be even", GSL_EINVAL);
+    }
+
+  if (n != wavetable->n)
+    {
+      GSL_ERROR ("wavetable does not match length of data", GSL_EINVAL);
+    }
+
+  if (n != work->n)
+    {
+      GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+FUNCTION(gsl_fft_real,packed_transform) (BASE data[], const size_t stride, const size_t n,
+                                         const TYPE(gsl_fft_real_packed_wavetable) * wavetable,
+                                         TYPE(gsl_fft_real_packed_workspace) * work)
+{
+  const size_t m = n / 2;
+  BASE *const z = work->packed;
+  const TYPE(gsl_complex) *const trig = wavetable->trig;
+  size_t k;
+  int status = FUNCTION(fft_real_packed,check) (n, wavetable, work);
+
+  if (status)
+    {
+      return status;
+    }
+
+  if (n == 1)
+    {                           /* FFT of one data point is the identity */
+      return 0;
+    }
+
+  for (k = 0; k < n; k++)
+    {
+      z[k] = data[k * stride];
+    }
+
+  status = FUNCTION(gsl_fft_complex,forward) (z, 1, m, wavetable->cwavetable,
+                                              work->cwork);
+
+  if (status)
+    {
+      return status;
+    }
+
+  /* the k = 0 and k = n/2 terms are purely real */
+
+  data[0] = z[0] + z[1];
+  data[(n - 1) * stride] = z[0] - z[1];
+
+  for (k = 1; k < m; k++)
+    {
+      const ATOMIC z_real = REAL(z,1,k);
+      const ATOMIC z_imag = IMAG(z,1,k);
+      const ATOMIC c_real = REAL(z,1,m - k);
+      const ATOMIC c_imag = -IMAG(z,1,m - k);
+
+      const ATOMIC e_real = 0.5 * (z_real + c_real);
+      const ATOMIC e_imag = 0.5 * (z_imag + c_imag);
+      const ATOMIC o_real = 0.5 * (z_imag - c_imag);
+      const ATOMIC o_imag = -0.5 * (z_real - c_real);
+
+      const ATOMIC w_real = GSL_REAL(trig[k]);
+      const ATOMIC w_imag = GSL_IMAG(trig[k]);
+
+      data[(2 * k - 1) * stride] = e_real + w_real * o_real - w_imag * o_imag;
+      data[2 * k * stride] = e_imag + w_real * o_imag + w_imag * o_real;
+    }
+
+  return 0;
+}
+
+int
+FUNCTION(gsl_fft_halfcomplex,packed_backward) (BASE data[], const size_t stride, const size_t n,
+                                               const TYPE(gsl_fft_real_packed_wavetable) * wavetable,
+                                               TYPE(gsl_fft_real_packed_workspace) * work)
+{
+  const size_t m = n / 2;
+  BASE *const z = work->packed;
+  const TYPE(gsl_complex) *const trig = wavetable->trig;
+  size_t k;
+  int status = FUNCTION(fft_real_packed,check) (n, wavetable, work);
+
+  if (status)
+    {
+      return status;
+    }
+
+  if (n == 1)
+    {                           /* FFT of one data point is the identity */
+      return 0;
+    }
+
+  {
+    const ATOMIC x0 = data[0];
+    const ATOMIC xm = data[(n - 1) * stride];
+
+    REAL(z,1,0) = x0 + xm;
+    IMAG(z,1,0) = x0 - xm;
+  }
+
+  for (k = 1; k < m; k++)
+    {
+      const ATOMIC x_real = data[(2 * k - 1) * stride];
+      const ATOMIC x_imag = data[2 * k * stride];
+      const ATOMIC c_real = data[(2 * (m - k) - 1) * stride];
+      const ATOMIC c_imag = -data[2 * (m - k) * stride];
+
+      const ATOMIC d_real = x_real - c_real;
+      const ATOMIC d_imag = x_imag - c_imag;
+
+      /* multiply the odd part by conj(w^k) */
+
+      const ATOMIC w_real = GSL_REAL(trig[k]);
+      const ATOMIC w_imag = GSL_IMAG(trig[k]);
+      const ATOMIC o_real = d_real * w_real + d_imag * w_imag;
+      const ATOMIC o_imag = d_imag * w_real - d_real * w_imag;
+
+      REAL(z,1,k) = (x_real + c_real) - o_imag;
+      IMAG(z,1,k) = (x_imag + c_imag) + o_real;
+    }
+
+  status = FUNCTION(gsl_fft_complex,backward) (z, 1, m, wavetable->cwavetable,
+                                               work->cwork);
+
+  if (status)
+    {
+      return status;
+    }
+
+  for (k = 0; k < n; k++)
+    {
+      data[k * stride] = z[k];
+    }
+
+  return 0;
+}
+
+int
+FUNCTION(gsl_fft_halfcomplex,packed_inverse) (BASE data[], const size_t stride, const size_t n,
+                                              const TYPE(gsl_fft_real_packed_wavetable) * wavetable,
+                                              TYPE(gsl_fft_real_packed_workspace) * work)
+{
+  int status = FUNCTION(gsl_fft_halfcomplex,packed_backward) (data, stride, n,
+                                                              wavetable, work);
+
+  if (status)
+    {
+      return status;
+    }
+
+  /* normalize inverse fft with 1/n */
+
+  {
+    const ATOMIC norm = ONE / (ATOMIC)n;
+    size_t i;
+    for (i = 0; i < n; i++)
+      {
+        data[stride*i] *= norm;
+      }
+  }
+
+  return status;
+}
@@ -34,6 +34,7 @@
 #include <gsl/gsl_fft_real_float.h>
 #include <gsl/gsl_fft_halfcomplex.h>
 #include <gsl/gsl_fft_halfcomplex_float.h>
+#include <gsl/gsl_fft_convolve.h>
 #include <gsl/gsl_ieee_utils.h>
 #include <gsl/gsl_test.h>
 
@@ -66,6 +67,8 @@ void my_error_handler (const char *reason, const char *file,
 #include "templates_off.h"
 #undef  BASE_FLOAT
 
+#include "test_convolve.c"
+
 int
 main (int argc, char *argv[])
 {
@@ -108,9 +111,20 @@ main (int argc, char *argv[])
           test_complex_float_func (stride, i) ;
           test_real_func (stride, i) ;
           test_real_float_func (stride, i) ;
+
+          if (i == 1 || i % 2 == 0)
+            {
+              test_real_packed_func (stride, i) ;
+              test_real_float_packed_func (stride, i) ;
+            }
         }
     }
 
+  if (n == 0)
+    {
+      test_convolve () ;
+    }
+
   gsl_set_error_handler (&my_error_handler);
   test_trap () ;
   test_float_trap () ;
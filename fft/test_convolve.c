@@ -0,0 +1,132 @@
+/* fft/test_convolve.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+double urand (void);
+
+/* naive full convolution (corr = 0) or correlation (corr = 1), length nx + K - 1 */
+static void
+slow_convolve (const int corr, const double x[], const size_t nx,
+               const double h[], const size_t K, double y[])
+{
+  size_t i, k;
+
+  for (i = 0; i < nx + K - 1; i++)
+    {
+      double sum = 0.0;
+
+      for (k = 0; k < K; k++)
+        {
+          const double hk = corr ? h[K - 1 - k] : h[k];
+
+          if (k <= i && i - k < nx)
+            sum += hk * x[i - k];
+        }
+
+      y[i] = sum;
+    }
+}
+
+static void
+test_convolve_compare (const double expected[], const double y[], const size_t n,
+                       const char * desc, const size_t K,
+                       const gsl_fft_convolve_method_t method,
+                       const gsl_fft_convolve_mode_t mode)
+{
+  size_t i;
+  double maxerr = 0.0, maxval = 0.0;
+
+  for (i = 0; i < n; i++)
+    {
+      maxerr = GSL_MAX (maxerr, fabs (y[i] - expected[i]));
+      maxval = GSL_MAX (maxval, fabs (expected[i]));
+    }
+
+  gsl_test (maxerr > 1.0e-12 * (1.0 + maxval),
+            "gsl_fft_%s, K = %d, method = %d, mode = %d, max error = %g",
+            desc, (int) K, (int) method, (int) mode, maxerr);
+}
+
+static void
+test_convolve_kernel (const size_t K, const gsl_fft_convolve_method_t method,
+                      const gsl_fft_convolve_mode_t mode)
+{
+  const size_t nx = 5 * K + 1234;
+  const size_t ny = nx + K - 1;
+  double *x = malloc (nx * sizeof (double));
+  double *h = malloc (K * sizeof (double));
+  double *y = malloc (ny * sizeof (double));
+  double *expected = malloc (ny * sizeof (double));
+  gsl_fft_convolve_workspace *w = gsl_fft_convolve_alloc (K, method, mode);
+  size_t i, chunk;
+
+  for (i = 0; i < nx; i++)
+    x[i] = urand () - 0.5;
+
+  for (i = 0; i < K; i++)
+    h[i] = urand () - 0.5;
+
+  /* one-shot convolution and correlation */
+
+  slow_convolve (0, x, nx, h, K, expected);
+  gsl_fft_convolve (x, nx, h, y, w);
+  test_convolve_compare (expected, y, ny, "convolve", K, method, mode);
+
+  slow_convolve (1, x, nx, h, K, expected);
+  gsl_fft_correlate (x, nx, h, y, w);
+  test_convolve_compare (expected, y, ny, "correlate", K, method, mode);
+
+  /* streaming with irregular chunk sizes, reusing the kernel transform */
+
+  slow_convolve (0, x, nx, h, K, expected);
+  gsl_fft_convolve_init (h, 1, w);
+
+  i = 0;
+  chunk = 1;
+  while (i < nx)
+    {
+      const size_t r = GSL_MIN (chunk, nx - i);
+      gsl_fft_convolve_stream (x + i, r, y + i, w);
+      i += r;
+      chunk = (3 * chunk + 7) % (2 * K + 101);
+    }
+
+  gsl_fft_convolve_flush (y + nx, w);
+  test_convolve_compare (expected, y, ny, "convolve_stream", K, method, mode);
+
+  gsl_fft_convolve_free (w);
+  free (x);
+  free (h);
+  free (y);
+  free (expected);
+}
+
+static void
+test_convolve (void)
+{
+  const size_t K[] = { 1, 2, 5, 17, 64, 65, 300, 1000 };
+  size_t i;
+
+  for (i = 0; i < sizeof (K) / sizeof (K[0]); i++)
+    {
+      test_convolve_kernel (K[i], GSL_FFT_CONVOLVE_DIRECT, GSL_FFT_CONVOLVE_OVERLAP_ADD);
+      test_convolve_kernel (K[i], GSL_FFT_CONVOLVE_FFT, GSL_FFT_CONVOLVE_OVERLAP_ADD);
+      test_convolve_kernel (K[i], GSL_FFT_CONVOLVE_FFT, GSL_FFT_CONVOLVE_OVERLAP_SAVE);
+      test_convolve_kernel (K[i], GSL_FFT_CONVOLVE_AUTO, GSL_FFT_CONVOLVE_OVERLAP_SAVE);
+    }
+}
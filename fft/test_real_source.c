@@ -24,6 +24,7 @@
 void FUNCTION(test_real,func) (size_t stride, size_t n);
 void FUNCTION(test_real,bitreverse_order) (size_t stride, size_t n);
 void FUNCTION(test_real,radix2) (size_t stride, size_t n);
+void FUNCTION(test_real,packed_func) (size_t stride, size_t n);
 
 void FUNCTION(test_real,func) (size_t stride, size_t n) 
 {
@@ -233,3 +234,95 @@ void FUNCTION(test_real,radix2) (size_t stride, size_t n)
   free(complex_tmp) ;
   free(fft_complex_data) ;
 }
+
+
+void FUNCTION(test_real,packed_func) (size_t stride, size_t n) 
+{
+  size_t i ;
+  int status ;
+
+  TYPE(gsl_fft_real_packed_wavetable) * pw ;
+  TYPE(gsl_fft_real_packed_workspace) * pwork ;
+
+  BASE * real_data = (BASE *) malloc (n * stride * sizeof (BASE));
+  BASE * half_data = (BASE *) malloc (n * stride * sizeof (BASE));
+  BASE * complex_data = (BASE *) malloc (2 * n * stride * sizeof (BASE));
+  BASE * complex_tmp = (BASE *) malloc (2 * n * stride * sizeof (BASE));
+  BASE * fft_complex_data = (BASE *) malloc (2 * n * stride * sizeof (BASE));
+
+  for (i = 0 ; i < n * stride ; i++)
+    {
+      real_data[i] = (BASE)i ;
+      half_data[i] = (BASE)(i + 4000.0) ;
+    }
+
+  for (i = 0 ; i < 2 * n * stride ; i++)
+    {
+      complex_data[i] = (BASE)(i + 1000.0) ;
+      complex_tmp[i] = (BASE)(i + 2000.0) ;
+      fft_complex_data[i] = (BASE)(i + 3000.0) ;
+    }
+
+  gsl_set_error_handler (NULL); /* abort on any errors */
+  
+  /* real fft through a packed complex fft of length n/2 */
+  
+  pw = FUNCTION(gsl_fft_real_packed_wavetable,alloc) (n);
+  gsl_test (pw == 0, NAME(gsl_fft_real_packed_wavetable) 
+            "_alloc, n = %d, stride = %d", n, stride);
+
+  pwork = FUNCTION(gsl_fft_real_packed_workspace,alloc) (n);
+  gsl_test (pwork == 0, NAME(gsl_fft_real_packed_workspace) 
+            "_alloc, n = %d", n);
+    
+  FUNCTION(fft_signal,real_noise) (n, stride, complex_data, fft_complex_data);
+  memcpy (complex_tmp, complex_data, 2 * n * stride * sizeof (BASE));
+
+  for (i = 0; i < n; i++)
+    {
+      real_data[i*stride] = REAL(complex_data,stride,i);
+    }
+  
+  FUNCTION(gsl_fft_real,packed_transform) (real_data, stride, n, pw, pwork);
+  FUNCTION(gsl_fft_halfcomplex,unpack) (real_data, complex_data, stride, n);
+  
+  status = FUNCTION(compare_complex,results) ("dft", fft_complex_data,
+                                              "fft of noise", complex_data,
+                                              stride, n, 1e6);
+  gsl_test (status, NAME(gsl_fft_real) 
+            "_packed with signal_real_noise, n = %d, stride = %d", n, stride);
+
+  /* round trip through the n/2 + 1 element complex layout */
+
+  FUNCTION(gsl_fft_halfcomplex,unpack_half) (real_data, complex_data, stride, n);
+  FUNCTION(gsl_fft_halfcomplex,pack_half) (complex_data, half_data, stride, n);
+
+  status = FUNCTION(compare_real,results) ("halfcomplex", real_data,
+                                           "pack_half", half_data,
+                                           stride, n, 1e6);
+  gsl_test (status, NAME(gsl_fft_halfcomplex) 
+            "_unpack_half/pack_half, n = %d, stride = %d", n, stride);
+  
+  /* compute the inverse fft */
+
+  status = FUNCTION(gsl_fft_halfcomplex,packed_inverse) (real_data, stride, n,
+                                                         pw, pwork);
+  
+  FUNCTION(gsl_fft_real,unpack) (real_data, complex_data, stride, n);
+  
+  status = FUNCTION(compare_complex,results) ("orig", complex_tmp,
+                                              "fft inverse", complex_data,
+                                              stride, n, 1e6);
+
+  gsl_test (status, NAME(gsl_fft_halfcomplex) 
+            "_packed with data from signal_noise, n = %d, stride = %d", n, stride);
+
+  FUNCTION(gsl_fft_real_packed_workspace,free) (pwork);
+  FUNCTION(gsl_fft_real_packed_wavetable,free) (pw);
+
+  free(real_data) ;
+  free(half_data) ;
+  free(complex_data) ;
+  free(complex_tmp) ;
+  free(fft_complex_data) ;
+}
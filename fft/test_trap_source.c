@@ -124,6 +124,31 @@ FUNCTION(test,trap) (void)
   status = FUNCTION(gsl_fft_halfcomplex,transform) (real_data, 1, 4, hcw, rwork);
   gsl_test (!status, "trap for n != nw in " NAME(gsl_fft_halfcomplex) "_transform");
 
+  /* odd n in packed real routines */
+
+  {
+    TYPE(gsl_fft_real_packed_wavetable) * pw;
+    TYPE(gsl_fft_real_packed_workspace) * pwork;
+
+    pw = FUNCTION(gsl_fft_real_packed_wavetable,alloc) (9);
+    gsl_test (pw != 0, "trap for odd n in " NAME(gsl_fft_real_packed_wavetable) "_alloc");
+
+    pwork = FUNCTION(gsl_fft_real_packed_workspace,alloc) (9);
+    gsl_test (pwork != 0, "trap for odd n in " NAME(gsl_fft_real_packed_workspace) "_alloc");
+
+    pw = FUNCTION(gsl_fft_real_packed_wavetable,alloc) (10);
+    pwork = FUNCTION(gsl_fft_real_packed_workspace,alloc) (10);
+
+    status = FUNCTION(gsl_fft_real,packed_transform) (real_data, 1, 9, pw, pwork);
+    gsl_test (!status, "trap for odd n in " NAME(gsl_fft_real) "_packed_transform");
+
+    status = FUNCTION(gsl_fft_halfcomplex,packed_backward) (real_data, 1, 8, pw, pwork);
+    gsl_test (!status, "trap for n != nw in " NAME(gsl_fft_halfcomplex) "_packed_backward");
+
+    FUNCTION (gsl_fft_real_packed_wavetable,free) (pw) ;
+    FUNCTION (gsl_fft_real_packed_workspace,free) (pwork) ;
+  }
+
   FUNCTION (gsl_fft_halfcomplex_wavetable,free) (hcw) ;
   FUNCTION (gsl_fft_real_wavetable,free) (rw) ;
   FUNCTION (gsl_fft_complex_wavetable,free) (cw) ;
@@ -18,10 +18,13 @@
  */
 
 #include <config.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_histogram.h>
 
 #include "find.c"
+#include "findarray.c"
 
 int
 gsl_histogram_increment (gsl_histogram * h, double x)
@@ -53,3 +56,72 @@ gsl_histogram_accumulate (gsl_histogram * h, double x, double weight)
 
   return GSL_SUCCESS;
 }
+
+/* Fill the histogram from arrays of values, a block at a time: the bins
+   of a block of values are found first and then incremented.  Values
+   outside the range of the histogram are skipped, and GSL_EDOM is
+   returned if there were any, without calling the error handler, as for
+   a single value. */
+
+int
+gsl_histogram_increment_array (gsl_histogram * h, const double x[],
+                               const size_t stride, const size_t n)
+{
+  const size_t nbins = h->n;
+  int status = GSL_SUCCESS;
+  size_t idx[FINDARRAY_BLOCK];
+  findarray_t f;
+  size_t k0;
+
+  findarray_init (&f, h->n, h->range);
+
+  for (k0 = 0; k0 < n; k0 += FINDARRAY_BLOCK)
+    {
+      const size_t m = GSL_MIN (FINDARRAY_BLOCK, n - k0);
+      size_t k;
+
+      if (findarray_block (&f, x + k0 * stride, stride, m, idx))
+        status = GSL_EDOM;
+
+      for (k = 0; k < m; k++)
+        {
+          if (idx[k] < nbins)
+            h->bin[idx[k]] += 1.0;
+        }
+    }
+
+  return status;
+}
+
+int
+gsl_histogram_accumulate_array (gsl_histogram * h,
+                                const double x[], const size_t xstride,
+                                const double w[], const size_t wstride,
+                                const size_t n)
+{
+  const size_t nbins = h->n;
+  int status = GSL_SUCCESS;
+  size_t idx[FINDARRAY_BLOCK];
+  findarray_t f;
+  size_t k0;
+
+  findarray_init (&f, h->n, h->range);
+
+  for (k0 = 0; k0 < n; k0 += FINDARRAY_BLOCK)
+    {
+      const size_t m = GSL_MIN (FINDARRAY_BLOCK, n - k0);
+      const double *wk = w + k0 * wstride;
+      size_t k;
+
+      if (findarray_block (&f, x + k0 * xstride, xstride, m, idx))
+        status = GSL_EDOM;
+
+      for (k = 0; k < m; k++)
+        {
+          if (idx[k] < nbins)
+            h->bin[idx[k]] += wk[k * wstride];
+        }
+    }
+
+  return status;
+}
@@ -19,11 +19,14 @@
 
 #include <config.h>
 #include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_histogram.h>
 #include <gsl/gsl_histogram2d.h>
 
 #include "find2d.c"
+#include "findarray.c"
 
 int
 gsl_histogram2d_increment (gsl_histogram2d * h, double x, double y)
@@ -64,3 +67,81 @@ gsl_histogram2d_accumulate (gsl_histogram2d * h,
 
   return GSL_SUCCESS;
 }
+
+/* Fill the histogram from arrays of coordinates, a block at a time.
+   Points outside the range of the histogram are skipped, and GSL_EDOM
+   is returned if there were any, without calling the error handler. */
+
+int
+gsl_histogram2d_increment_array (gsl_histogram2d * h,
+                                 const double x[], const size_t xstride,
+                                 const double y[], const size_t ystride,
+                                 const size_t n)
+{
+  const size_t nx = h->nx, ny = h->ny;
+  int status = GSL_SUCCESS;
+  size_t ix[FINDARRAY_BLOCK], iy[FINDARRAY_BLOCK];
+  findarray_t fx, fy;
+  size_t k0;
+
+  findarray_init (&fx, h->nx, h->xrange);
+  findarray_init (&fy, h->ny, h->yrange);
+
+  for (k0 = 0; k0 < n; k0 += FINDARRAY_BLOCK)
+    {
+      const size_t m = GSL_MIN (FINDARRAY_BLOCK, n - k0);
+      size_t k;
+
+      if (findarray_block (&fx, x + k0 * xstride, xstride, m, ix))
+        status = GSL_EDOM;
+
+      if (findarray_block (&fy, y + k0 * ystride, ystride, m, iy))
+        status = GSL_EDOM;
+
+      for (k = 0; k < m; k++)
+        {
+          if (ix[k] < nx && iy[k] < ny)
+            h->bin[ix[k] * ny + iy[k]] += 1.0;
+        }
+    }
+
+  return status;
+}
+
+int
+gsl_histogram2d_accumulate_array (gsl_histogram2d * h,
+                                  const double x[], const size_t xstride,
+                                  const double y[], const size_t ystride,
+                                  const double w[], const size_t wstride,
+                                  const size_t n)
+{
+  const size_t nx = h->nx, ny = h->ny;
+  int status = GSL_SUCCESS;
+  size_t ix[FINDARRAY_BLOCK], iy[FINDARRAY_BLOCK];
+  findarray_t fx, fy;
+  size_t k0;
+
+  findarray_init (&fx, h->nx, h->xrange);
+  findarray_init (&fy, h->ny, h->yrange);
+
+  for (k0 = 0; k0 < n; k0 += FINDARRAY_BLOCK)
+    {
+      const size_t m = GSL_MIN (FINDARRAY_BLOCK, n - k0);
+      const double *wk = w + k0 * wstride;
+      size_t k;
+
+      if (findarray_block (&fx, x + k0 * xstride, xstride, m, ix))
+        status = GSL_EDOM;
+
+      if (findarray_block (&fy, y + k0 * ystride, ystride, m, iy))
+        status = GSL_EDOM;
+
+      for (k = 0; k < m; k++)
+        {
+          if (ix[k] < nx && iy[k] < ny)
+            h->bin[ix[k] * ny + iy[k]] += wk[k * wstride];
+        }
+    }
+
+  return status;
+}
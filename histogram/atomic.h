@@ -0,0 +1,98 @@
+/* histogram/atomic.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Lock-free updates for the sharded histograms, using the GCC __atomic
+   builtins or C11 <stdatomic.h>, whichever configure found.
+   HISTOGRAM_ATOMIC is defined when they are available, and
+   HISTOGRAM_THREAD_INDEX when each thread can also be given its own
+   index for choosing a shard. */
+
+#if defined(HAVE_ATOMIC_BUILTINS)
+
+#define HISTOGRAM_ATOMIC 1
+
+static inline void
+histogram_atomic_add (double *p, const double x)
+{
+  double old, sum;
+
+  __atomic_load (p, &old, __ATOMIC_RELAXED);
+
+  do
+    {
+      sum = old + x;
+    }
+  while (!__atomic_compare_exchange (p, &old, &sum, 0,
+                                     __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+static inline size_t
+histogram_atomic_next (size_t *n)
+{
+  return __atomic_fetch_add (n, 1, __ATOMIC_RELAXED);
+}
+
+#elif defined(HAVE_STDATOMIC_H) && defined(__STDC_VERSION__) \
+  && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+
+#include <stdatomic.h>
+
+#define HISTOGRAM_ATOMIC 1
+
+static inline void
+histogram_atomic_add (double *p, const double x)
+{
+  _Atomic double *a = (_Atomic double *) p;
+  double old = atomic_load_explicit (a, memory_order_relaxed);
+
+  while (!atomic_compare_exchange_weak_explicit (a, &old, old + x,
+                                                 memory_order_relaxed,
+                                                 memory_order_relaxed))
+    ;
+}
+
+static inline size_t
+histogram_atomic_next (size_t *n)
+{
+  return atomic_fetch_add_explicit ((_Atomic size_t *) n, 1,
+                                    memory_order_relaxed);
+}
+
+#endif
+
+#if defined(HISTOGRAM_ATOMIC) && defined(THREAD_LOCAL)
+
+#define HISTOGRAM_THREAD_INDEX 1
+
+/* threads are numbered 0, 1, 2, ... in the order of their first call,
+   the stored value is the index plus one so that zero means unset */
+
+static size_t histogram_nthreads = 0;
+static THREAD_LOCAL size_t histogram_thread_id = 0;
+
+static inline size_t
+histogram_thread_index (void)
+{
+  if (histogram_thread_id == 0)
+    histogram_thread_id = histogram_atomic_next (&histogram_nthreads) + 1;
+
+  return histogram_thread_id - 1;
+}
+
+#endif
@@ -0,0 +1,136 @@
+/* histogram/findarray.c
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Bin search for filling a histogram from an array of values.  The
+   properties of the ranges are examined once per array instead of once
+   per value.  If each boundary is within a quarter of a bin width of
+   its position for uniform bins, the bin is estimated with one
+   multiplication and corrected by at most one step either way;
+   otherwise a binary search is used whose loop body compiles to a
+   conditional move rather than a branch, so that its cost does not
+   depend on how predictable the data are.  Values outside the range,
+   and NaNs, are given the index n. */
+
+typedef struct
+{
+  size_t n;
+  const double *range;
+  double xmin;
+  double xmax;
+  double scale;
+  int uniform;
+} findarray_t;
+
+static void
+findarray_init (findarray_t * f, const size_t n, const double range[])
+{
+  const double dx = (range[n] - range[0]) / n;
+  size_t i;
+
+  f->n = n;
+  f->range = range;
+  f->xmin = range[0];
+  f->xmax = range[n];
+  f->scale = n / (range[n] - range[0]);
+  f->uniform = 1;
+
+  for (i = 1; i < n; i++)
+    {
+      if (fabs (range[i] - (range[0] + i * dx)) > 0.25 * dx)
+        {
+          f->uniform = 0;
+          break;
+        }
+    }
+}
+
+#define FINDARRAY_BLOCK 256
+
+/* Store in idx[k] the bin containing x[k*stride], for k < n, or f->n
+   if the value is outside the range.  Returns the number of values
+   outside the range.  The test for uniform bins is made once for the
+   whole block, so that each loop is a simple sequence of arithmetic
+   and loads. */
+
+static size_t
+findarray_block (const findarray_t * f, const double x[], const size_t stride,
+                 const size_t n, size_t idx[])
+{
+  const double *range = f->range;
+  const double xmin = f->xmin, xmax = f->xmax;
+  const size_t nbins = f->n;
+  size_t k, nout = 0;
+
+  if (f->uniform)
+    {
+      const double scale = f->scale;
+
+      for (k = 0; k < n; k++)
+        {
+          const double xk = x[k * stride];
+          size_t i;
+
+          if (!(xk >= xmin && xk < xmax))
+            {
+              idx[k] = nbins;
+              nout++;
+              continue;
+            }
+
+          i = (size_t) ((xk - xmin) * scale);
+
+          if (i >= nbins)
+            i = nbins - 1;
+
+          /* the estimate is at most one bin out */
+          i -= (xk < range[i]);
+          i += (xk >= range[i + 1]);
+
+          idx[k] = i;
+        }
+    }
+  else
+    {
+      for (k = 0; k < n; k++)
+        {
+          const double xk = x[k * stride];
+          const double *base = range;
+          size_t len = nbins;
+
+          if (!(xk >= xmin && xk < xmax))
+            {
+              idx[k] = nbins;
+              nout++;
+              continue;
+            }
+
+          /* find the last boundary <= x among range[0..n-1] */
+          while (len > 1)
+            {
+              const size_t half = len / 2;
+              base = (base[half] <= xk) ? base + half : base;
+              len -= half;
+            }
+
+          idx[k] = base - range;
+        }
+    }
+
+  return nout;
+}
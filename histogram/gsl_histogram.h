@@ -45,15 +45,26 @@ typedef struct {
   size_t n ;
   double * range ;
   double * sum ;
+  size_t * guide ;
 } gsl_histogram_pdf ;
 
+typedef struct {
+  size_t nshards ;
+  gsl_histogram ** shard ;
+  gsl_histogram * merged ;
+  int atomic ;
+} gsl_histogram_sharded ;
+
 gsl_histogram * gsl_histogram_alloc (size_t n);
 
 gsl_histogram * gsl_histogram_calloc (size_t n);
 gsl_histogram * gsl_histogram_calloc_uniform (const size_t n, const double xmin, const double xmax);
+gsl_histogram * gsl_histogram_calloc_loglinear (const double xmin, const double xmax, const double rel_err);
 void gsl_histogram_free (gsl_histogram * h);
 int gsl_histogram_increment (gsl_histogram * h, double x);
 int gsl_histogram_accumulate (gsl_histogram * h, double x, double weight);
+int gsl_histogram_increment_array (gsl_histogram * h, const double x[], const size_t stride, const size_t n);
+int gsl_histogram_accumulate_array (gsl_histogram * h, const double x[], const size_t xstride, const double w[], const size_t wstride, const size_t n);
 int gsl_histogram_find (const gsl_histogram * h, 
                         const double x, size_t * i);
 
@@ -82,6 +93,30 @@ gsl_histogram_memcpy(gsl_histogram * dest, const gsl_histogram * source);
 gsl_histogram *
 gsl_histogram_clone(const gsl_histogram * source);
 
+gsl_histogram_sharded *
+gsl_histogram_sharded_alloc (const gsl_histogram * h, const size_t nshards);
+gsl_histogram_sharded *
+gsl_histogram_sharded_alloc_atomic (const gsl_histogram * h,
+                                    const size_t nshards);
+void gsl_histogram_sharded_free (gsl_histogram_sharded * s);
+void gsl_histogram_sharded_reset (gsl_histogram_sharded * s);
+gsl_histogram *
+gsl_histogram_sharded_shard (gsl_histogram_sharded * s, const size_t k);
+int gsl_histogram_sharded_increment (gsl_histogram_sharded * s, const size_t k,
+                                     double x);
+int gsl_histogram_sharded_accumulate (gsl_histogram_sharded * s, const size_t k,
+                                      double x, double weight);
+int gsl_histogram_sharded_thread_increment (gsl_histogram_sharded * s,
+                                            double x);
+int gsl_histogram_sharded_thread_accumulate (gsl_histogram_sharded * s,
+                                             double x, double weight);
+int gsl_histogram_sharded_merge (gsl_histogram * dest,
+                                 const gsl_histogram_sharded * s);
+double gsl_histogram_sharded_get (const gsl_histogram_sharded * s,
+                                  const size_t i);
+const gsl_histogram *
+gsl_histogram_sharded_merged (gsl_histogram_sharded * s);
+
 double gsl_histogram_max_val (const gsl_histogram * h);
 
 size_t gsl_histogram_max_bin (const gsl_histogram * h);
@@ -128,6 +163,7 @@ gsl_histogram_pdf * gsl_histogram_pdf_alloc (const size_t n);
 int gsl_histogram_pdf_init (gsl_histogram_pdf * p, const gsl_histogram * h);
 void gsl_histogram_pdf_free (gsl_histogram_pdf * p);
 double gsl_histogram_pdf_sample (const gsl_histogram_pdf * p, double r);
+int gsl_histogram_pdf_sample_array (const gsl_histogram_pdf * p, const double r[], double x[], const size_t n);
 
 __END_DECLS
 
@@ -47,8 +47,36 @@ typedef struct {
   double * xrange ;
   double * yrange ;
   double * sum ;
+  size_t * guide ;
 } gsl_histogram2d_pdf ;
 
+typedef struct {
+  size_t nshards ;
+  gsl_histogram2d ** shard ;
+  gsl_histogram2d * merged ;
+  int atomic ;
+} gsl_histogram2d_sharded ;
+
+typedef struct {
+  size_t nx, ny ;
+  double * xrange ;
+  double * yrange ;
+  size_t size ;
+  size_t nbins ;
+  size_t * key ;
+  double * bin ;
+} gsl_histogram2d_sparse ;
+
+typedef struct {
+  size_t nx, ny ;
+  double * xrange ;
+  double * yrange ;
+  size_t n, nmax ;
+  size_t * index ;
+  double * sum ;
+  size_t * guide ;
+} gsl_histogram2d_sparse_pdf ;
+
 gsl_histogram2d * gsl_histogram2d_alloc (const size_t nx, const size_t ny);
 gsl_histogram2d * gsl_histogram2d_calloc (const size_t nx, const size_t ny);
 gsl_histogram2d * gsl_histogram2d_calloc_uniform (const size_t nx, const size_t ny,
@@ -60,6 +88,15 @@ void gsl_histogram2d_free (gsl_histogram2d * h);
 int gsl_histogram2d_increment (gsl_histogram2d * h, double x, double y);
 int gsl_histogram2d_accumulate (gsl_histogram2d * h, 
                                 double x, double y, double weight);
+int gsl_histogram2d_increment_array (gsl_histogram2d * h,
+                                     const double x[], const size_t xstride,
+                                     const double y[], const size_t ystride,
+                                     const size_t n);
+int gsl_histogram2d_accumulate_array (gsl_histogram2d * h,
+                                      const double x[], const size_t xstride,
+                                      const double y[], const size_t ystride,
+                                      const double w[], const size_t wstride,
+                                      const size_t n);
 int gsl_histogram2d_find (const gsl_histogram2d * h, 
                           const double x, const double y, size_t * i, size_t * j);
 
@@ -100,6 +137,32 @@ gsl_histogram2d_memcpy(gsl_histogram2d *dest, const gsl_histogram2d *source);
 gsl_histogram2d *
 gsl_histogram2d_clone(const gsl_histogram2d * source);
 
+gsl_histogram2d_sharded *
+gsl_histogram2d_sharded_alloc (const gsl_histogram2d * h, const size_t nshards);
+gsl_histogram2d_sharded *
+gsl_histogram2d_sharded_alloc_atomic (const gsl_histogram2d * h,
+                                      const size_t nshards);
+void gsl_histogram2d_sharded_free (gsl_histogram2d_sharded * s);
+void gsl_histogram2d_sharded_reset (gsl_histogram2d_sharded * s);
+gsl_histogram2d *
+gsl_histogram2d_sharded_shard (gsl_histogram2d_sharded * s, const size_t k);
+int gsl_histogram2d_sharded_increment (gsl_histogram2d_sharded * s,
+                                       const size_t k, double x, double y);
+int gsl_histogram2d_sharded_accumulate (gsl_histogram2d_sharded * s,
+                                        const size_t k, double x, double y,
+                                        double weight);
+int gsl_histogram2d_sharded_thread_increment (gsl_histogram2d_sharded * s,
+                                              double x, double y);
+int gsl_histogram2d_sharded_thread_accumulate (gsl_histogram2d_sharded * s,
+                                               double x, double y,
+                                               double weight);
+int gsl_histogram2d_sharded_merge (gsl_histogram2d * dest,
+                                   const gsl_histogram2d_sharded * s);
+double gsl_histogram2d_sharded_get (const gsl_histogram2d_sharded * s,
+                                    const size_t i, const size_t j);
+const gsl_histogram2d *
+gsl_histogram2d_sharded_merged (gsl_histogram2d_sharded * s);
+
 double
 gsl_histogram2d_max_val(const gsl_histogram2d *h);
 
@@ -165,6 +228,55 @@ void gsl_histogram2d_pdf_free (gsl_histogram2d_pdf * p);
 int gsl_histogram2d_pdf_sample (const gsl_histogram2d_pdf * p, 
                                    double r1, double r2, 
                                    double * x, double * y);
+int gsl_histogram2d_pdf_sample_array (const gsl_histogram2d_pdf * p,
+                                      const double r1[], const double r2[],
+                                      double x[], double y[], const size_t n);
+
+gsl_histogram2d_sparse *
+gsl_histogram2d_sparse_alloc (const size_t nx, const size_t ny);
+void gsl_histogram2d_sparse_free (gsl_histogram2d_sparse * h);
+void gsl_histogram2d_sparse_reset (gsl_histogram2d_sparse * h);
+
+int gsl_histogram2d_sparse_set_ranges_uniform (gsl_histogram2d_sparse * h,
+                                               double xmin, double xmax,
+                                               double ymin, double ymax);
+int gsl_histogram2d_sparse_set_ranges (gsl_histogram2d_sparse * h,
+                                       const double xrange[], size_t xsize,
+                                       const double yrange[], size_t ysize);
+
+int gsl_histogram2d_sparse_increment (gsl_histogram2d_sparse * h,
+                                      double x, double y);
+int gsl_histogram2d_sparse_accumulate (gsl_histogram2d_sparse * h,
+                                       double x, double y, double weight);
+int gsl_histogram2d_sparse_find (const gsl_histogram2d_sparse * h,
+                                 const double x, const double y,
+                                 size_t * i, size_t * j);
+double gsl_histogram2d_sparse_get (const gsl_histogram2d_sparse * h,
+                                   const size_t i, const size_t j);
+int gsl_histogram2d_sparse_next (const gsl_histogram2d_sparse * h,
+                                 size_t * pos, size_t * i, size_t * j,
+                                 double * value);
+
+int gsl_histogram2d_sparse_equal_bins_p (const gsl_histogram2d_sparse * h1,
+                                         const gsl_histogram2d_sparse * h2);
+int gsl_histogram2d_sparse_add (gsl_histogram2d_sparse * h1,
+                                const gsl_histogram2d_sparse * h2);
+
+double gsl_histogram2d_sparse_sum (const gsl_histogram2d_sparse * h);
+double gsl_histogram2d_sparse_xmean (const gsl_histogram2d_sparse * h);
+double gsl_histogram2d_sparse_ymean (const gsl_histogram2d_sparse * h);
+double gsl_histogram2d_sparse_xsigma (const gsl_histogram2d_sparse * h);
+double gsl_histogram2d_sparse_ysigma (const gsl_histogram2d_sparse * h);
+double gsl_histogram2d_sparse_cov (const gsl_histogram2d_sparse * h);
+
+gsl_histogram2d_sparse_pdf *
+gsl_histogram2d_sparse_pdf_alloc (const size_t nx, const size_t ny);
+int gsl_histogram2d_sparse_pdf_init (gsl_histogram2d_sparse_pdf * p,
+                                     const gsl_histogram2d_sparse * h);
+void gsl_histogram2d_sparse_pdf_free (gsl_histogram2d_sparse_pdf * p);
+int gsl_histogram2d_sparse_pdf_sample (const gsl_histogram2d_sparse_pdf * p,
+                                       double r1, double r2,
+                                       double * x, double * y);
 
 __END_DECLS
 
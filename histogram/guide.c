@@ -0,0 +1,73 @@
+/* histogram/guide.c
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Guide table for inverting a cumulative distribution sum[0..n] in
+   constant expected time (Chen and Asau, 1974).  Entry m of the table
+   is the first bin whose upper cumulative value exceeds m/n, so a
+   search for r starts at entry floor(r n) and steps forward, visiting
+   one bin on average.  The bin found is the same one located by a
+   binary search with find(). */
+
+static void guide_init (const size_t n, const double sum[], size_t guide[]);
+
+static int guide_find (const size_t n, const double sum[],
+                       const size_t guide[], const double r, size_t * i);
+
+static void
+guide_init (const size_t n, const double sum[], size_t guide[])
+{
+  size_t i = 0, m;
+
+  for (m = 0; m < n; m++)
+    {
+      const double u = (double) m / (double) n;
+
+      while (i < n - 1 && sum[i + 1] <= u)
+        i++;
+
+      guide[m] = i;
+    }
+}
+
+static int
+guide_find (const size_t n, const double sum[], const size_t guide[],
+            const double r, size_t * i)
+{
+  size_t k;
+
+  if (!(r >= sum[0] && r < sum[n]))
+    {
+      return -1;
+    }
+
+  k = (size_t) (r * n);
+  k = guide[k < n ? k : n - 1];
+
+  /* step back in case r * n was rounded up to the next entry */
+
+  while (k > 0 && sum[k] > r)
+    k--;
+
+  while (sum[k + 1] <= r)
+    k++;
+
+  *i = k;
+
+  return 0;
+}
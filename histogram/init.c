@@ -19,6 +19,8 @@
 
 #include <config.h>
 #include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_histogram.h>
 
@@ -103,6 +105,86 @@ gsl_histogram_calloc_uniform (const size_t n, const double xmin,
   return h;
 }
 
+/* Log-linear ranges: each octave [xmin 2^k, xmin 2^(k+1)) is divided
+   into sub equal bins, sub being the smallest power of two with
+   1/sub <= rel_err, so that the width of every bin is at most rel_err
+   times its lower limit.  The last bin is the first one to reach xmax. */
+
+gsl_histogram *
+gsl_histogram_calloc_loglinear (const double xmin, const double xmax,
+                                const double rel_err)
+{
+  gsl_histogram *h;
+  size_t sub = 1, n = 0, m;
+
+  if (!(xmin > 0))
+    {
+      GSL_ERROR_VAL ("xmin must be positive", GSL_EINVAL, 0);
+    }
+
+  if (xmin >= xmax)
+    {
+      GSL_ERROR_VAL ("xmin must be less than xmax", GSL_EINVAL, 0);
+    }
+
+  if (!gsl_finite (xmax / xmin))
+    {
+      GSL_ERROR_VAL ("ratio xmax / xmin must be finite", GSL_EINVAL, 0);
+    }
+
+  if (!(rel_err >= GSL_DBL_EPSILON))
+    {
+      GSL_ERROR_VAL ("rel_err must not be less than GSL_DBL_EPSILON",
+                     GSL_EINVAL, 0);
+    }
+
+  while (sub * rel_err < 1.0)
+    sub *= 2;
+
+#define LOGLINEAR_RANGE(m) \
+  (ldexp (xmin, (int) ((m) / sub)) * (1.0 + (double) ((m) % sub) / sub))
+
+  /* start from the octave containing xmax and correct for rounding */
+
+  {
+    int e;
+    size_t octave;
+
+    frexp (xmax / xmin, &e);
+    octave = (size_t) (e - 1);
+
+    if (octave > ((size_t) -1) / sub - 2)
+      {
+        GSL_ERROR_VAL ("too many bins for rel_err and range", GSL_EINVAL, 0);
+      }
+
+    n = octave * sub
+      + (size_t) ceil ((xmax / ldexp (xmin, (int) octave) - 1.0) * sub);
+
+    while (n > 1 && LOGLINEAR_RANGE (n - 1) >= xmax)
+      n--;
+
+    while (LOGLINEAR_RANGE (n) < xmax)
+      n++;
+  }
+
+  h = gsl_histogram_calloc (n);
+
+  if (h == 0)
+    {
+      return h;
+    }
+
+  for (m = 0; m <= n; m++)
+    {
+      h->range[m] = LOGLINEAR_RANGE (m);
+    }
+
+#undef LOGLINEAR_RANGE
+
+  return h;
+}
+
 gsl_histogram *
 gsl_histogram_calloc (size_t n)
 {
@@ -22,7 +22,7 @@
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_histogram.h>
 
-#include "find.c"
+#include "guide.c"
 
 double
 gsl_histogram_pdf_sample (const gsl_histogram_pdf * p, double r)
@@ -39,7 +39,7 @@ gsl_histogram_pdf_sample (const gsl_histogram_pdf * p, double r)
       r = 0.0;
     }
 
-  status = find (p->n, p->sum, r, &i);
+  status = guide_find (p->n, p->sum, p->guide, r, &i);
 
   if (status)
     {
@@ -53,6 +53,33 @@ gsl_histogram_pdf_sample (const gsl_histogram_pdf * p, double r)
     }
 }
 
+/* r and x may be the same array */
+
+int
+gsl_histogram_pdf_sample_array (const gsl_histogram_pdf * p,
+                                const double r[], double x[], const size_t n)
+{
+  size_t k;
+
+  for (k = 0; k < n; k++)
+    {
+      double u = (r[k] == 1.0) ? 0.0 : r[k];
+      size_t i;
+
+      if (guide_find (p->n, p->sum, p->guide, u, &i))
+        {
+          GSL_ERROR ("cannot find r in cumulative pdf", GSL_EDOM);
+        }
+
+      {
+        double delta = (u - p->sum[i]) / (p->sum[i + 1] - p->sum[i]);
+        x[k] = p->range[i] + delta * (p->range[i + 1] - p->range[i]);
+      }
+    }
+
+  return GSL_SUCCESS;
+}
+
 gsl_histogram_pdf *
 gsl_histogram_pdf_alloc (const size_t n)
 {
@@ -93,6 +120,18 @@ gsl_histogram_pdf_alloc (const size_t n)
                         GSL_ENOMEM, 0);
     }
 
+  p->guide = (size_t *) malloc (n * sizeof (size_t));
+
+  if (p->guide == 0)
+    {
+      free (p->sum);
+      free (p->range);
+      free (p);         /* exception in constructor, avoid memory leak */
+
+      GSL_ERROR_VAL ("failed to allocate space for histogram pdf guide table",
+                        GSL_ENOMEM, 0);
+    }
+
   p->n = n;
 
   return p;
@@ -140,6 +179,8 @@ gsl_histogram_pdf_init (gsl_histogram_pdf * p, const gsl_histogram * h)
       }
   }
 
+  guide_init (n, p->sum, p->guide);
+
   return GSL_SUCCESS;
 }
 
@@ -150,5 +191,6 @@ gsl_histogram_pdf_free (gsl_histogram_pdf * p)
   RETURN_IF_NULL (p);
   free (p->range);
   free (p->sum);
+  free (p->guide);
   free (p);
 }
@@ -23,7 +23,7 @@
 #include <gsl/gsl_histogram.h>
 #include <gsl/gsl_histogram2d.h>
 
-#include "find.c"
+#include "guide.c"
 
 int
 gsl_histogram2d_pdf_sample (const gsl_histogram2d_pdf * p,
@@ -46,7 +46,7 @@ gsl_histogram2d_pdf_sample (const gsl_histogram2d_pdf * p,
       r1 = 0.0;
     }
 
-  status = find (p->nx * p->ny, p->sum, r1, &k);
+  status = guide_find (p->nx * p->ny, p->sum, p->guide, r1, &k);
 
   if (status)
     {
@@ -63,6 +63,39 @@ gsl_histogram2d_pdf_sample (const gsl_histogram2d_pdf * p,
     }
 }
 
+/* r1, r2 may be the same arrays as x, y */
+
+int
+gsl_histogram2d_pdf_sample_array (const gsl_histogram2d_pdf * p,
+                                  const double r1[], const double r2[],
+                                  double x[], double y[], const size_t n)
+{
+  const size_t nbins = p->nx * p->ny;
+  size_t m;
+
+  for (m = 0; m < n; m++)
+    {
+      double u = (r1[m] == 1.0) ? 0.0 : r1[m];
+      double v = (r2[m] == 1.0) ? 0.0 : r2[m];
+      size_t k;
+
+      if (guide_find (nbins, p->sum, p->guide, u, &k))
+        {
+          GSL_ERROR ("cannot find r1 in cumulative pdf", GSL_EDOM);
+        }
+
+      {
+        size_t i = k / p->ny;
+        size_t j = k - (i * p->ny);
+        double delta = (u - p->sum[k]) / (p->sum[k + 1] - p->sum[k]);
+        x[m] = p->xrange[i] + delta * (p->xrange[i + 1] - p->xrange[i]);
+        y[m] = p->yrange[j] + v * (p->yrange[j + 1] - p->yrange[j]);
+      }
+    }
+
+  return GSL_SUCCESS;
+}
+
 gsl_histogram2d_pdf *
 gsl_histogram2d_pdf_alloc (const size_t nx, const size_t ny)
 {
@@ -117,6 +150,19 @@ gsl_histogram2d_pdf_alloc (const size_t nx, const size_t ny)
                         GSL_ENOMEM, 0);
     }
 
+  p->guide = (size_t *) malloc (n * sizeof (size_t));
+
+  if (p->guide == 0)
+    {
+      free (p->sum);
+      free (p->yrange);
+      free (p->xrange);
+      free (p);         /* exception in constructor, avoid memory leak */
+
+      GSL_ERROR_VAL ("failed to allocate space for histogram2d pdf guide table",
+                        GSL_ENOMEM, 0);
+    }
+
   p->nx = nx;
   p->ny = ny;
 
@@ -172,6 +218,8 @@ gsl_histogram2d_pdf_init (gsl_histogram2d_pdf * p, const gsl_histogram2d * h)
       }
   }
 
+  guide_init (n, p->sum, p->guide);
+
   return GSL_SUCCESS;
 }
 
@@ -183,5 +231,6 @@ gsl_histogram2d_pdf_free (gsl_histogram2d_pdf * p)
   free (p->xrange);
   free (p->yrange);
   free (p->sum);
+  free (p->guide);
   free (p);
 }
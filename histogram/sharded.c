@@ -0,0 +1,296 @@
+/* histogram/sharded.c
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* A histogram split into shards with identical ranges, so that several
+   threads can fill it at the same time without locking, each thread
+   using its own shard.  The shards are added together only when the
+   result is needed.
+
+   Where the compiler provides atomic operations the shards can also be
+   updated with lock-free atomic additions, either as a single shared
+   shard (gsl_histogram_sharded_alloc_atomic) or with each thread
+   choosing its shard automatically (gsl_histogram_sharded_thread_*). */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogram.h>
+
+#include "atomic.h"
+
+#ifdef HISTOGRAM_ATOMIC
+#include "find.c"
+
+static int
+atomic_accumulate (gsl_histogram * h, double x, double weight)
+{
+  size_t index = 0;
+
+  int status = find (h->n, h->range, x, &index);
+
+  if (status)
+    {
+      return GSL_EDOM;
+    }
+
+  histogram_atomic_add (&h->bin[index], weight);
+
+  return GSL_SUCCESS;
+}
+#endif
+
+gsl_histogram_sharded *
+gsl_histogram_sharded_alloc (const gsl_histogram * h, const size_t nshards)
+{
+  gsl_histogram_sharded *s;
+  size_t k;
+
+  if (nshards == 0)
+    {
+      GSL_ERROR_NULL ("number of shards must be positive", GSL_EINVAL);
+    }
+
+  s = malloc (sizeof (gsl_histogram_sharded));
+  if (s == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for sharded histogram struct",
+                      GSL_ENOMEM);
+    }
+
+  s->shard = calloc (nshards, sizeof (gsl_histogram *));
+  if (s->shard == 0)
+    {
+      free (s);
+      GSL_ERROR_NULL ("failed to allocate space for shards", GSL_ENOMEM);
+    }
+
+  s->nshards = nshards;
+  s->merged = 0;
+  s->atomic = 0;
+
+  for (k = 0; k < nshards; k++)
+    {
+      s->shard[k] = gsl_histogram_calloc_range (h->n, h->range);
+
+      if (s->shard[k] == 0)
+        {
+          gsl_histogram_sharded_free (s);
+          GSL_ERROR_NULL ("failed to allocate space for shards", GSL_ENOMEM);
+        }
+    }
+
+  return s;
+}
+
+/* a single shard updated atomically if the compiler supports it,
+   otherwise nshards ordinary shards */
+
+gsl_histogram_sharded *
+gsl_histogram_sharded_alloc_atomic (const gsl_histogram * h,
+                                    const size_t nshards)
+{
+  gsl_histogram_sharded *s;
+
+  if (nshards == 0)
+    {
+      GSL_ERROR_NULL ("number of shards must be positive", GSL_EINVAL);
+    }
+
+#ifdef HISTOGRAM_ATOMIC
+  s = gsl_histogram_sharded_alloc (h, 1);
+
+  if (s != 0)
+    s->atomic = 1;
+#else
+  s = gsl_histogram_sharded_alloc (h, nshards);
+#endif
+
+  return s;
+}
+
+void
+gsl_histogram_sharded_free (gsl_histogram_sharded * s)
+{
+  size_t k;
+
+  RETURN_IF_NULL (s);
+
+  for (k = 0; k < s->nshards; k++)
+    {
+      if (s->shard[k])
+        gsl_histogram_free (s->shard[k]);
+    }
+
+  if (s->merged)
+    gsl_histogram_free (s->merged);
+
+  free (s->shard);
+  free (s);
+}
+
+void
+gsl_histogram_sharded_reset (gsl_histogram_sharded * s)
+{
+  size_t k;
+
+  for (k = 0; k < s->nshards; k++)
+    gsl_histogram_reset (s->shard[k]);
+}
+
+gsl_histogram *
+gsl_histogram_sharded_shard (gsl_histogram_sharded * s, const size_t k)
+{
+  if (k >= s->nshards)
+    {
+      GSL_ERROR_NULL ("shard index lies outside valid range of 0 .. nshards - 1",
+                      GSL_EINVAL);
+    }
+
+  return s->shard[k];
+}
+
+int
+gsl_histogram_sharded_increment (gsl_histogram_sharded * s, const size_t k,
+                                 double x)
+{
+  return gsl_histogram_sharded_accumulate (s, k, x, 1.0);
+}
+
+int
+gsl_histogram_sharded_accumulate (gsl_histogram_sharded * s, const size_t k,
+                                  double x, double weight)
+{
+  if (k >= s->nshards)
+    {
+      GSL_ERROR ("shard index lies outside valid range of 0 .. nshards - 1",
+                 GSL_EINVAL);
+    }
+
+#ifdef HISTOGRAM_ATOMIC
+  if (s->atomic)
+    return atomic_accumulate (s->shard[k], x, weight);
+#endif
+
+  return gsl_histogram_accumulate (s->shard[k], x, weight);
+}
+
+int
+gsl_histogram_sharded_thread_increment (gsl_histogram_sharded * s, double x)
+{
+  return gsl_histogram_sharded_thread_accumulate (s, x, 1.0);
+}
+
+/* each thread adds into shard (thread index) mod nshards, atomically
+   since there may be more threads than shards */
+
+int
+gsl_histogram_sharded_thread_accumulate (gsl_histogram_sharded * s,
+                                         double x, double weight)
+{
+#ifdef HISTOGRAM_ATOMIC
+  size_t k = 0;
+
+#ifdef HISTOGRAM_THREAD_INDEX
+  k = histogram_thread_index () % s->nshards;
+#endif
+
+  return atomic_accumulate (s->shard[k], x, weight);
+#else
+  (void) s;
+  (void) x;
+  (void) weight;
+
+  GSL_ERROR ("atomic operations are not available, use an explicit shard",
+             GSL_EUNSUP);
+#endif
+}
+
+/* the sum of bin i over the shards, without merging the other bins */
+
+double
+gsl_histogram_sharded_get (const gsl_histogram_sharded * s, const size_t i)
+{
+  double sum;
+  size_t k;
+
+  if (i >= s->shard[0]->n)
+    {
+      GSL_ERROR_VAL ("index lies outside valid range of 0 .. n - 1",
+                     GSL_EDOM, 0);
+    }
+
+  sum = s->shard[0]->bin[i];
+
+  for (k = 1; k < s->nshards; k++)
+    sum += s->shard[k]->bin[i];
+
+  return sum;
+}
+
+/* dest = sum of the shards, added in order so that the result does not
+   depend on which threads filled which shards */
+
+int
+gsl_histogram_sharded_merge (gsl_histogram * dest,
+                             const gsl_histogram_sharded * s)
+{
+  const size_t n = dest->n;
+  size_t i, k;
+
+  if (!gsl_histogram_equal_bins_p (dest, s->shard[0]))
+    {
+      GSL_ERROR ("histograms have different binning", GSL_EINVAL);
+    }
+
+  for (i = 0; i < n; i++)
+    dest->bin[i] = s->shard[0]->bin[i];
+
+  for (k = 1; k < s->nshards; k++)
+    {
+      const double *bin = s->shard[k]->bin;
+
+      for (i = 0; i < n; i++)
+        dest->bin[i] += bin[i];
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* merge the shards into a histogram owned by s, allocated on the first
+   call and brought up to date on each call */
+
+const gsl_histogram *
+gsl_histogram_sharded_merged (gsl_histogram_sharded * s)
+{
+  if (s->merged == 0)
+    {
+      s->merged = gsl_histogram_calloc_range (s->shard[0]->n,
+                                              s->shard[0]->range);
+
+      if (s->merged == 0)
+        {
+          GSL_ERROR_NULL ("failed to allocate space for merged histogram",
+                          GSL_ENOMEM);
+        }
+    }
+
+  gsl_histogram_sharded_merge (s->merged, s);
+
+  return s->merged;
+}
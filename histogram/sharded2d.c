@@ -0,0 +1,294 @@
+/* histogram/sharded2d.c
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* A 2D histogram split into shards with identical ranges, so that several
+   threads can fill it at the same time without locking, each thread
+   using its own shard.  The shards are added together only when the
+   result is needed.  Atomic updates are handled as in sharded.c. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogram2d.h>
+
+#include "atomic.h"
+
+#ifdef HISTOGRAM_ATOMIC
+#include "find2d.c"
+
+static int
+atomic_accumulate (gsl_histogram2d * h, double x, double y, double weight)
+{
+  size_t i = 0, j = 0;
+
+  int status = find2d (h->nx, h->xrange, h->ny, h->yrange, x, y, &i, &j);
+
+  if (status)
+    {
+      return GSL_EDOM;
+    }
+
+  histogram_atomic_add (&h->bin[i * h->ny + j], weight);
+
+  return GSL_SUCCESS;
+}
+#endif
+
+gsl_histogram2d_sharded *
+gsl_histogram2d_sharded_alloc (const gsl_histogram2d * h, const size_t nshards)
+{
+  gsl_histogram2d_sharded *s;
+  size_t k;
+
+  if (nshards == 0)
+    {
+      GSL_ERROR_NULL ("number of shards must be positive", GSL_EINVAL);
+    }
+
+  s = malloc (sizeof (gsl_histogram2d_sharded));
+  if (s == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for sharded histogram struct",
+                      GSL_ENOMEM);
+    }
+
+  s->shard = calloc (nshards, sizeof (gsl_histogram2d *));
+  if (s->shard == 0)
+    {
+      free (s);
+      GSL_ERROR_NULL ("failed to allocate space for shards", GSL_ENOMEM);
+    }
+
+  s->nshards = nshards;
+  s->merged = 0;
+  s->atomic = 0;
+
+  for (k = 0; k < nshards; k++)
+    {
+      s->shard[k] = gsl_histogram2d_calloc_range (h->nx, h->ny,
+                                                 h->xrange, h->yrange);
+
+      if (s->shard[k] == 0)
+        {
+          gsl_histogram2d_sharded_free (s);
+          GSL_ERROR_NULL ("failed to allocate space for shards", GSL_ENOMEM);
+        }
+    }
+
+  return s;
+}
+
+gsl_histogram2d_sharded *
+gsl_histogram2d_sharded_alloc_atomic (const gsl_histogram2d * h,
+                                      const size_t nshards)
+{
+  gsl_histogram2d_sharded *s;
+
+  if (nshards == 0)
+    {
+      GSL_ERROR_NULL ("number of shards must be positive", GSL_EINVAL);
+    }
+
+#ifdef HISTOGRAM_ATOMIC
+  s = gsl_histogram2d_sharded_alloc (h, 1);
+
+  if (s != 0)
+    s->atomic = 1;
+#else
+  s = gsl_histogram2d_sharded_alloc (h, nshards);
+#endif
+
+  return s;
+}
+
+void
+gsl_histogram2d_sharded_free (gsl_histogram2d_sharded * s)
+{
+  size_t k;
+
+  RETURN_IF_NULL (s);
+
+  for (k = 0; k < s->nshards; k++)
+    {
+      if (s->shard[k])
+        gsl_histogram2d_free (s->shard[k]);
+    }
+
+  if (s->merged)
+    gsl_histogram2d_free (s->merged);
+
+  free (s->shard);
+  free (s);
+}
+
+void
+gsl_histogram2d_sharded_reset (gsl_histogram2d_sharded * s)
+{
+  size_t k;
+
+  for (k = 0; k < s->nshards; k++)
+    gsl_histogram2d_reset (s->shard[k]);
+}
+
+gsl_histogram2d *
+gsl_histogram2d_sharded_shard (gsl_histogram2d_sharded * s, const size_t k)
+{
+  if (k >= s->nshards)
+    {
+      GSL_ERROR_NULL ("shard index lies outside valid range of 0 .. nshards - 1",
+                      GSL_EINVAL);
+    }
+
+  return s->shard[k];
+}
+
+int
+gsl_histogram2d_sharded_increment (gsl_histogram2d_sharded * s, const size_t k,
+                                   double x, double y)
+{
+  return gsl_histogram2d_sharded_accumulate (s, k, x, y, 1.0);
+}
+
+int
+gsl_histogram2d_sharded_accumulate (gsl_histogram2d_sharded * s, const size_t k,
+                                    double x, double y, double weight)
+{
+  if (k >= s->nshards)
+    {
+      GSL_ERROR ("shard index lies outside valid range of 0 .. nshards - 1",
+                 GSL_EINVAL);
+    }
+
+#ifdef HISTOGRAM_ATOMIC
+  if (s->atomic)
+    return atomic_accumulate (s->shard[k], x, y, weight);
+#endif
+
+  return gsl_histogram2d_accumulate (s->shard[k], x, y, weight);
+}
+
+int
+gsl_histogram2d_sharded_thread_increment (gsl_histogram2d_sharded * s,
+                                          double x, double y)
+{
+  return gsl_histogram2d_sharded_thread_accumulate (s, x, y, 1.0);
+}
+
+int
+gsl_histogram2d_sharded_thread_accumulate (gsl_histogram2d_sharded * s,
+                                           double x, double y, double weight)
+{
+#ifdef HISTOGRAM_ATOMIC
+  size_t k = 0;
+
+#ifdef HISTOGRAM_THREAD_INDEX
+  k = histogram_thread_index () % s->nshards;
+#endif
+
+  return atomic_accumulate (s->shard[k], x, y, weight);
+#else
+  (void) s;
+  (void) x;
+  (void) y;
+  (void) weight;
+
+  GSL_ERROR ("atomic operations are not available, use an explicit shard",
+             GSL_EUNSUP);
+#endif
+}
+
+double
+gsl_histogram2d_sharded_get (const gsl_histogram2d_sharded * s,
+                             const size_t i, const size_t j)
+{
+  const size_t nx = s->shard[0]->nx;
+  const size_t ny = s->shard[0]->ny;
+  double sum;
+  size_t k;
+
+  if (i >= nx)
+    {
+      GSL_ERROR_VAL ("index i lies outside valid range of 0 .. nx - 1",
+                     GSL_EDOM, 0);
+    }
+
+  if (j >= ny)
+    {
+      GSL_ERROR_VAL ("index j lies outside valid range of 0 .. ny - 1",
+                     GSL_EDOM, 0);
+    }
+
+  sum = s->shard[0]->bin[i * ny + j];
+
+  for (k = 1; k < s->nshards; k++)
+    sum += s->shard[k]->bin[i * ny + j];
+
+  return sum;
+}
+
+/* dest = sum of the shards, added in order so that the result does not
+   depend on which threads filled which shards */
+
+int
+gsl_histogram2d_sharded_merge (gsl_histogram2d * dest,
+                               const gsl_histogram2d_sharded * s)
+{
+  const size_t n = dest->nx * dest->ny;
+  size_t i, k;
+
+  if (!gsl_histogram2d_equal_bins_p (dest, s->shard[0]))
+    {
+      GSL_ERROR ("histograms have different binning", GSL_EINVAL);
+    }
+
+  for (i = 0; i < n; i++)
+    dest->bin[i] = s->shard[0]->bin[i];
+
+  for (k = 1; k < s->nshards; k++)
+    {
+      const double *bin = s->shard[k]->bin;
+
+      for (i = 0; i < n; i++)
+        dest->bin[i] += bin[i];
+    }
+
+  return GSL_SUCCESS;
+}
+
+const gsl_histogram2d *
+gsl_histogram2d_sharded_merged (gsl_histogram2d_sharded * s)
+{
+  if (s->merged == 0)
+    {
+      const gsl_histogram2d *h = s->shard[0];
+
+      s->merged = gsl_histogram2d_calloc_range (h->nx, h->ny,
+                                                h->xrange, h->yrange);
+
+      if (s->merged == 0)
+        {
+          GSL_ERROR_NULL ("failed to allocate space for merged histogram",
+                          GSL_ENOMEM);
+        }
+    }
+
+  gsl_histogram2d_sharded_merge (s->merged, s);
+
+  return s->merged;
+}
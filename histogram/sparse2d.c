@@ -0,0 +1,569 @@
+/* histogram/sparse2d.c
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* A 2D histogram which stores only the bins that have been filled, in
+   an open-addressing hash table keyed on the bin index i * ny + j.  A
+   key of 0 marks an empty slot, so the index is stored plus one.  The
+   table is doubled whenever it becomes half full. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogram2d.h>
+
+#include "find2d.c"
+
+#define SPARSE_INITIAL_SIZE 16
+
+static size_t
+sparse_hash (size_t k)
+{
+  k ^= k >> 15;
+  k *= 0x2c1b3c6dUL;
+  k ^= k >> 12;
+  k *= 0x297a2d39UL;
+  k ^= k >> 15;
+  return k;
+}
+
+/* return the slot holding key, or the empty slot where it belongs */
+
+static size_t
+sparse_slot (const gsl_histogram2d_sparse * h, const size_t key)
+{
+  const size_t mask = h->size - 1;
+  size_t k = sparse_hash (key) & mask;
+
+  while (h->key[k] != 0 && h->key[k] != key)
+    k = (k + 1) & mask;
+
+  return k;
+}
+
+static int
+sparse_grow (gsl_histogram2d_sparse * h)
+{
+  const size_t size = h->size;
+  size_t *key = h->key;
+  double *bin = h->bin;
+  size_t k;
+
+  h->key = calloc (2 * size, sizeof (size_t));
+  h->bin = malloc (2 * size * sizeof (double));
+
+  if (h->key == 0 || h->bin == 0)
+    {
+      free (h->key);
+      free (h->bin);
+      h->key = key;
+      h->bin = bin;
+      GSL_ERROR ("failed to allocate space for histogram bins", GSL_ENOMEM);
+    }
+
+  h->size = 2 * size;
+
+  for (k = 0; k < size; k++)
+    {
+      if (key[k] != 0)
+        {
+          size_t s = sparse_slot (h, key[k]);
+          h->key[s] = key[k];
+          h->bin[s] = bin[k];
+        }
+    }
+
+  free (key);
+  free (bin);
+
+  return GSL_SUCCESS;
+}
+
+/* add weight to the bin with index key - 1, creating it if necessary */
+
+static int
+sparse_add (gsl_histogram2d_sparse * h, const size_t key, const double weight)
+{
+  size_t s = sparse_slot (h, key);
+
+  if (h->key[s] == 0)
+    {
+      if (2 * (h->nbins + 1) > h->size)
+        {
+          int status = sparse_grow (h);
+
+          if (status)
+            return status;
+
+          s = sparse_slot (h, key);
+        }
+
+      h->key[s] = key;
+      h->bin[s] = 0.0;
+      h->nbins++;
+    }
+
+  h->bin[s] += weight;
+
+  return GSL_SUCCESS;
+}
+
+static void
+make_uniform (double range[], size_t n, double xmin, double xmax)
+{
+  size_t i;
+
+  for (i = 0; i <= n; i++)
+    {
+      double f1 = ((double) (n-i) / (double) n);
+      double f2 = ((double) i / (double) n);
+      range[i] = f1 * xmin +  f2 * xmax;
+    }
+}
+
+gsl_histogram2d_sparse *
+gsl_histogram2d_sparse_alloc (const size_t nx, const size_t ny)
+{
+  gsl_histogram2d_sparse *h;
+
+  if (nx == 0)
+    {
+      GSL_ERROR_VAL ("histogram2d length nx must be positive integer",
+                     GSL_EDOM, 0);
+    }
+
+  if (ny == 0)
+    {
+      GSL_ERROR_VAL ("histogram2d length ny must be positive integer",
+                     GSL_EDOM, 0);
+    }
+
+  if (nx > ((size_t) -1 - 1) / ny)
+    {
+      GSL_ERROR_VAL ("number of bins nx * ny is too large", GSL_EDOM, 0);
+    }
+
+  h = (gsl_histogram2d_sparse *) malloc (sizeof (gsl_histogram2d_sparse));
+
+  if (h == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for histogram2d struct",
+                     GSL_ENOMEM, 0);
+    }
+
+  h->xrange = (double *) malloc ((nx + 1) * sizeof (double));
+  h->yrange = (double *) malloc ((ny + 1) * sizeof (double));
+  h->key = (size_t *) calloc (SPARSE_INITIAL_SIZE, sizeof (size_t));
+  h->bin = (double *) malloc (SPARSE_INITIAL_SIZE * sizeof (double));
+
+  if (h->xrange == 0 || h->yrange == 0 || h->key == 0 || h->bin == 0)
+    {
+      free (h->xrange);
+      free (h->yrange);
+      free (h->key);
+      free (h->bin);
+      free (h);         /* exception in constructor, avoid memory leak */
+
+      GSL_ERROR_VAL ("failed to allocate space for histogram2d",
+                     GSL_ENOMEM, 0);
+    }
+
+  h->nx = nx;
+  h->ny = ny;
+  h->size = SPARSE_INITIAL_SIZE;
+  h->nbins = 0;
+
+  make_uniform (h->xrange, nx, 0.0, (double) nx);
+  make_uniform (h->yrange, ny, 0.0, (double) ny);
+
+  return h;
+}
+
+void
+gsl_histogram2d_sparse_free (gsl_histogram2d_sparse * h)
+{
+  RETURN_IF_NULL (h);
+  free (h->xrange);
+  free (h->yrange);
+  free (h->key);
+  free (h->bin);
+  free (h);
+}
+
+void
+gsl_histogram2d_sparse_reset (gsl_histogram2d_sparse * h)
+{
+  size_t k;
+
+  for (k = 0; k < h->size; k++)
+    h->key[k] = 0;
+
+  h->nbins = 0;
+}
+
+int
+gsl_histogram2d_sparse_set_ranges_uniform (gsl_histogram2d_sparse * h,
+                                           double xmin, double xmax,
+                                           double ymin, double ymax)
+{
+  if (xmin >= xmax)
+    {
+      GSL_ERROR_VAL ("xmin must be less than xmax", GSL_EINVAL, 0);
+    }
+
+  if (ymin >= ymax)
+    {
+      GSL_ERROR_VAL ("ymin must be less than ymax", GSL_EINVAL, 0);
+    }
+
+  make_uniform (h->xrange, h->nx, xmin, xmax);
+  make_uniform (h->yrange, h->ny, ymin, ymax);
+
+  gsl_histogram2d_sparse_reset (h);
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogram2d_sparse_set_ranges (gsl_histogram2d_sparse * h,
+                                   const double xrange[], size_t xsize,
+                                   const double yrange[], size_t ysize)
+{
+  size_t i;
+  const size_t nx = h->nx, ny = h->ny;
+
+  if (xsize != (nx + 1))
+    {
+      GSL_ERROR_VAL ("size of xrange must match size of histogram",
+                     GSL_EINVAL, 0);
+    }
+
+  if (ysize != (ny + 1))
+    {
+      GSL_ERROR_VAL ("size of yrange must match size of histogram",
+                     GSL_EINVAL, 0);
+    }
+
+  for (i = 0; i <= nx; i++)
+    {
+      h->xrange[i] = xrange[i];
+    }
+
+  for (i = 0; i <= ny; i++)
+    {
+      h->yrange[i] = yrange[i];
+    }
+
+  gsl_histogram2d_sparse_reset (h);
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogram2d_sparse_find (const gsl_histogram2d_sparse * h,
+                             const double x, const double y,
+                             size_t * i, size_t * j)
+{
+  int status = find (h->nx, h->xrange, x, i);
+
+  if (status)
+    {
+      GSL_ERROR ("x not found in range of h", GSL_EDOM);
+    }
+
+  status = find (h->ny, h->yrange, y, j);
+
+  if (status)
+    {
+      GSL_ERROR ("y not found in range of h", GSL_EDOM);
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogram2d_sparse_increment (gsl_histogram2d_sparse * h,
+                                  double x, double y)
+{
+  return gsl_histogram2d_sparse_accumulate (h, x, y, 1.0);
+}
+
+int
+gsl_histogram2d_sparse_accumulate (gsl_histogram2d_sparse * h,
+                                   double x, double y, double weight)
+{
+  size_t i = 0, j = 0;
+
+  int status = find2d (h->nx, h->xrange, h->ny, h->yrange, x, y, &i, &j);
+
+  if (status)
+    {
+      return GSL_EDOM;
+    }
+
+  if (weight == 0.0)
+    {
+      return GSL_SUCCESS;
+    }
+
+  return sparse_add (h, i * h->ny + j + 1, weight);
+}
+
+double
+gsl_histogram2d_sparse_get (const gsl_histogram2d_sparse * h,
+                            const size_t i, const size_t j)
+{
+  size_t s;
+
+  if (i >= h->nx)
+    {
+      GSL_ERROR_VAL ("index i lies outside valid range of 0 .. nx - 1",
+                     GSL_EDOM, 0);
+    }
+
+  if (j >= h->ny)
+    {
+      GSL_ERROR_VAL ("index j lies outside valid range of 0 .. ny - 1",
+                     GSL_EDOM, 0);
+    }
+
+  s = sparse_slot (h, i * h->ny + j + 1);
+
+  return (h->key[s] != 0) ? h->bin[s] : 0.0;
+}
+
+/* step through the filled bins, starting with *pos = 0 */
+
+int
+gsl_histogram2d_sparse_next (const gsl_histogram2d_sparse * h, size_t * pos,
+                             size_t * i, size_t * j, double * value)
+{
+  size_t k;
+
+  for (k = *pos; k < h->size; k++)
+    {
+      if (h->key[k] != 0)
+        {
+          const size_t key = h->key[k] - 1;
+
+          *i = key / h->ny;
+          *j = key - *i * h->ny;
+          *value = h->bin[k];
+          *pos = k + 1;
+
+          return GSL_SUCCESS;
+        }
+    }
+
+  *pos = h->size;
+
+  return GSL_FAILURE;
+}
+
+int
+gsl_histogram2d_sparse_equal_bins_p (const gsl_histogram2d_sparse * h1,
+                                     const gsl_histogram2d_sparse * h2)
+{
+  size_t i;
+
+  if ((h1->nx != h2->nx) || (h1->ny != h2->ny))
+    {
+      return 0;
+    }
+
+  for (i = 0; i <= h1->nx; i++)
+    {
+      if (h1->xrange[i] != h2->xrange[i])
+        {
+          return 0;
+        }
+    }
+
+  for (i = 0; i <= h1->ny; i++)
+    {
+      if (h1->yrange[i] != h2->yrange[i])
+        {
+          return 0;
+        }
+    }
+
+  return 1;
+}
+
+/* h1 = h1 + h2 */
+
+int
+gsl_histogram2d_sparse_add (gsl_histogram2d_sparse * h1,
+                            const gsl_histogram2d_sparse * h2)
+{
+  size_t k;
+
+  if (!gsl_histogram2d_sparse_equal_bins_p (h1, h2))
+    {
+      GSL_ERROR ("histograms have different binning", GSL_EINVAL);
+    }
+
+  for (k = 0; k < h2->size; k++)
+    {
+      if (h2->key[k] != 0)
+        {
+          int status = sparse_add (h1, h2->key[k], h2->bin[k]);
+
+          if (status)
+            return status;
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+double
+gsl_histogram2d_sparse_sum (const gsl_histogram2d_sparse * h)
+{
+  double sum = 0;
+  size_t k;
+
+  for (k = 0; k < h->size; k++)
+    {
+      if (h->key[k] != 0)
+        sum += h->bin[k];
+    }
+
+  return sum;
+}
+
+/* The moments follow gsl_histogram2d_xmean etc, using the centres of
+   the bins and ignoring bins with negative contents.  Only the filled
+   bins are visited. */
+
+double
+gsl_histogram2d_sparse_xmean (const gsl_histogram2d_sparse * h)
+{
+  long double wmean = 0;
+  long double W = 0;
+  size_t k;
+
+  for (k = 0; k < h->size; k++)
+    {
+      if (h->key[k] != 0 && h->bin[k] > 0)
+        {
+          const size_t i = (h->key[k] - 1) / h->ny;
+          const double xi = (h->xrange[i + 1] + h->xrange[i]) / 2.0;
+
+          W += h->bin[k];
+          wmean += (xi - wmean) * (h->bin[k] / W);
+        }
+    }
+
+  return wmean;
+}
+
+double
+gsl_histogram2d_sparse_ymean (const gsl_histogram2d_sparse * h)
+{
+  long double wmean = 0;
+  long double W = 0;
+  size_t k;
+
+  for (k = 0; k < h->size; k++)
+    {
+      if (h->key[k] != 0 && h->bin[k] > 0)
+        {
+          const size_t j = (h->key[k] - 1) % h->ny;
+          const double yj = (h->yrange[j + 1] + h->yrange[j]) / 2.0;
+
+          W += h->bin[k];
+          wmean += (yj - wmean) * (h->bin[k] / W);
+        }
+    }
+
+  return wmean;
+}
+
+double
+gsl_histogram2d_sparse_xsigma (const gsl_histogram2d_sparse * h)
+{
+  const double xmean = gsl_histogram2d_sparse_xmean (h);
+  long double wvariance = 0;
+  long double W = 0;
+  size_t k;
+
+  for (k = 0; k < h->size; k++)
+    {
+      if (h->key[k] != 0 && h->bin[k] > 0)
+        {
+          const size_t i = (h->key[k] - 1) / h->ny;
+          const double xi = (h->xrange[i + 1] + h->xrange[i]) / 2.0 - xmean;
+
+          W += h->bin[k];
+          wvariance += ((xi * xi) - wvariance) * (h->bin[k] / W);
+        }
+    }
+
+  return sqrt (wvariance);
+}
+
+double
+gsl_histogram2d_sparse_ysigma (const gsl_histogram2d_sparse * h)
+{
+  const double ymean = gsl_histogram2d_sparse_ymean (h);
+  long double wvariance = 0;
+  long double W = 0;
+  size_t k;
+
+  for (k = 0; k < h->size; k++)
+    {
+      if (h->key[k] != 0 && h->bin[k] > 0)
+        {
+          const size_t j = (h->key[k] - 1) % h->ny;
+          const double yj = (h->yrange[j + 1] + h->yrange[j]) / 2.0 - ymean;
+
+          W += h->bin[k];
+          wvariance += ((yj * yj) - wvariance) * (h->bin[k] / W);
+        }
+    }
+
+  return sqrt (wvariance);
+}
+
+double
+gsl_histogram2d_sparse_cov (const gsl_histogram2d_sparse * h)
+{
+  const double xmean = gsl_histogram2d_sparse_xmean (h);
+  const double ymean = gsl_histogram2d_sparse_ymean (h);
+  long double wcovariance = 0;
+  long double W = 0;
+  size_t k;
+
+  for (k = 0; k < h->size; k++)
+    {
+      if (h->key[k] != 0 && h->bin[k] > 0)
+        {
+          const size_t i = (h->key[k] - 1) / h->ny;
+          const size_t j = (h->key[k] - 1) % h->ny;
+          const double xi = (h->xrange[i + 1] + h->xrange[i]) / 2.0 - xmean;
+          const double yj = (h->yrange[j + 1] + h->yrange[j]) / 2.0 - ymean;
+
+          W += h->bin[k];
+          wcovariance += ((xi * yj) - wcovariance) * (h->bin[k] / W);
+        }
+    }
+
+  return wcovariance;
+}
@@ -0,0 +1,230 @@
+/* histogram/sparsepdf2d.c
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_heapsort.h>
+#include <gsl/gsl_histogram2d.h>
+
+#include "guide.c"
+
+static int
+compare_index (const void *a, const void *b)
+{
+  const size_t x = *(const size_t *) a, y = *(const size_t *) b;
+
+  return (x > y) - (x < y);
+}
+
+int
+gsl_histogram2d_sparse_pdf_sample (const gsl_histogram2d_sparse_pdf * p,
+                                   double r1, double r2,
+                                   double *x, double *y)
+{
+  size_t k;
+  int status;
+
+  /* Wrap the exclusive top of the bin down to the inclusive bottom of
+     the bin, as in gsl_histogram2d_pdf_sample */
+
+  if (r2 == 1.0)
+    {
+      r2 = 0.0;
+    }
+  if (r1 == 1.0)
+    {
+      r1 = 0.0;
+    }
+
+  status = guide_find (p->n, p->sum, p->guide, r1, &k);
+
+  if (status)
+    {
+      GSL_ERROR ("cannot find r1 in cumulative pdf", GSL_EDOM);
+    }
+  else
+    {
+      size_t i = p->index[k] / p->ny;
+      size_t j = p->index[k] - (i * p->ny);
+      double delta = (r1 - p->sum[k]) / (p->sum[k + 1] - p->sum[k]);
+      *x = p->xrange[i] + delta * (p->xrange[i + 1] - p->xrange[i]);
+      *y = p->yrange[j] + r2 * (p->yrange[j + 1] - p->yrange[j]);
+      return GSL_SUCCESS;
+    }
+}
+
+gsl_histogram2d_sparse_pdf *
+gsl_histogram2d_sparse_pdf_alloc (const size_t nx, const size_t ny)
+{
+  gsl_histogram2d_sparse_pdf *p;
+
+  if (nx == 0 || ny == 0)
+    {
+      GSL_ERROR_VAL ("histogram2d pdf lengths nx, ny must be positive integers",
+                     GSL_EDOM, 0);
+    }
+
+  p = (gsl_histogram2d_sparse_pdf *) malloc (sizeof (gsl_histogram2d_sparse_pdf));
+
+  if (p == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for histogram2d pdf struct",
+                     GSL_ENOMEM, 0);
+    }
+
+  p->xrange = (double *) malloc ((nx + 1) * sizeof (double));
+  p->yrange = (double *) malloc ((ny + 1) * sizeof (double));
+
+  if (p->xrange == 0 || p->yrange == 0)
+    {
+      free (p->xrange);
+      free (p->yrange);
+      free (p);         /* exception in constructor, avoid memory leak */
+
+      GSL_ERROR_VAL ("failed to allocate space for histogram2d pdf ranges",
+                     GSL_ENOMEM, 0);
+    }
+
+  p->nx = nx;
+  p->ny = ny;
+  p->n = 0;
+  p->nmax = 0;
+  p->index = 0;
+  p->guide = 0;
+  p->sum = 0;
+
+  return p;
+}
+
+/* The distribution is built from the bins with positive contents only,
+   taken in order of their index so that the result does not depend on
+   the order in which the histogram was filled.  The arrays for these
+   bins grow as needed. */
+
+int
+gsl_histogram2d_sparse_pdf_init (gsl_histogram2d_sparse_pdf * p,
+                                 const gsl_histogram2d_sparse * h)
+{
+  size_t i, j, k, m = 0, pos = 0;
+  double value, sum = 0;
+
+  if (p->nx != h->nx || p->ny != h->ny)
+    {
+      GSL_ERROR ("histogram2d size must match pdf size", GSL_EDOM);
+    }
+
+  while (gsl_histogram2d_sparse_next (h, &pos, &i, &j, &value) == GSL_SUCCESS)
+    {
+      if (value < 0)
+        {
+          GSL_ERROR ("histogram bins must be non-negative to compute "
+                     "a probability distribution", GSL_EDOM);
+        }
+
+      if (value > 0)
+        m++;
+    }
+
+  if (m == 0)
+    {
+      GSL_ERROR ("histogram must have at least one positive bin to compute "
+                 "a probability distribution", GSL_EDOM);
+    }
+
+  if (m > p->nmax)
+    {
+      size_t *index = (size_t *) malloc (m * sizeof (size_t));
+      size_t *guide = (size_t *) malloc (m * sizeof (size_t));
+      double *s = (double *) malloc ((m + 1) * sizeof (double));
+
+      if (index == 0 || guide == 0 || s == 0)
+        {
+          free (index);
+          free (guide);
+          free (s);
+          GSL_ERROR ("failed to allocate space for histogram2d pdf sums",
+                     GSL_ENOMEM);
+        }
+
+      free (p->index);
+      free (p->guide);
+      free (p->sum);
+      p->index = index;
+      p->guide = guide;
+      p->sum = s;
+      p->nmax = m;
+    }
+
+  for (i = 0; i < h->nx + 1; i++)
+    {
+      p->xrange[i] = h->xrange[i];
+    }
+
+  for (i = 0; i < h->ny + 1; i++)
+    {
+      p->yrange[i] = h->yrange[i];
+    }
+
+  pos = 0;
+  k = 0;
+
+  while (gsl_histogram2d_sparse_next (h, &pos, &i, &j, &value) == GSL_SUCCESS)
+    {
+      if (value > 0)
+        {
+          p->index[k++] = i * h->ny + j;
+        }
+    }
+
+  gsl_heapsort (p->index, m, sizeof (size_t), compare_index);
+
+  p->sum[0] = 0;
+
+  for (k = 0; k < m; k++)
+    {
+      i = p->index[k] / h->ny;
+      j = p->index[k] - i * h->ny;
+      sum += gsl_histogram2d_sparse_get (h, i, j);
+      p->sum[k + 1] = sum;
+    }
+
+  for (k = 1; k <= m; k++)
+    {
+      p->sum[k] /= sum;
+    }
+
+  guide_init (m, p->sum, p->guide);
+
+  p->n = m;
+
+  return GSL_SUCCESS;
+}
+
+void
+gsl_histogram2d_sparse_pdf_free (gsl_histogram2d_sparse_pdf * p)
+{
+  RETURN_IF_NULL (p);
+  free (p->xrange);
+  free (p->yrange);
+  free (p->index);
+  free (p->guide);
+  free (p->sum);
+  free (p);
+}
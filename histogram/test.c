@@ -30,6 +30,12 @@ void test1d_resample (void);
 void test2d_resample (void);
 void test1d_trap (void);
 void test2d_trap (void);
+void test1d_array (void);
+void test2d_array (void);
+void test1d_sharded (void);
+void test2d_sharded (void);
+void test1d_loglinear (void);
+void test2d_sparse (void);
 
 int
 main (void)
@@ -40,6 +46,12 @@ main (void)
   test2d_resample();
   test1d_trap();
   test2d_trap();
+  test1d_array();
+  test2d_array();
+  test1d_sharded();
+  test2d_sharded();
+  test1d_loglinear();
+  test2d_sparse();
   
   exit (gsl_test_summary ());
 }
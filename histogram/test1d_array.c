@@ -0,0 +1,145 @@
+/* histogram/test1d_array.c
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogram.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+
+#include "urand.c"
+
+#define N 10000
+
+/* fill h with gsl_histogram_increment_array and with single calls,
+   and compare the bins */
+static void
+test1d_array_compare (gsl_histogram * h, const char * desc)
+{
+  const size_t n = h->n;
+  const double xmin = h->range[0], xmax = h->range[n];
+  double *x = malloc (2 * N * sizeof (double));
+  double *w = malloc (N * sizeof (double));
+  gsl_histogram *g = gsl_histogram_clone (h);
+  gsl_histogram *a = gsl_histogram_clone (h);
+  gsl_histogram *b = gsl_histogram_clone (h);
+  size_t i;
+  int status = 0, ret;
+
+  /* values across and beyond the range, including the boundaries
+     themselves, stored with stride 2 */
+  for (i = 0; i < N; i++)
+    {
+      double u = urand ();
+
+      if (i % 7 == 0)
+        x[2 * i] = h->range[(size_t) (u * (n + 1))];
+      else
+        x[2 * i] = xmin + (1.2 * u - 0.1) * (xmax - xmin);
+
+      w[i] = 0.5 + urand ();
+    }
+
+  gsl_histogram_reset (g);
+  gsl_histogram_reset (h);
+
+  for (i = 0; i < N; i++)
+    gsl_histogram_increment (g, x[2 * i]);
+
+  ret = gsl_histogram_increment_array (h, x, 2, N);
+
+  for (i = 0; i < n; i++)
+    status |= (h->bin[i] != g->bin[i]);
+
+  gsl_test (status, "gsl_histogram_increment_array, %s", desc);
+  gsl_test (ret != GSL_EDOM, "gsl_histogram_increment_array return value, %s", desc);
+
+  /* weighted, and split into two sub-histograms which are then added */
+  gsl_histogram_reset (g);
+  gsl_histogram_reset (a);
+  gsl_histogram_reset (b);
+
+  for (i = 0; i < N; i++)
+    gsl_histogram_accumulate (g, x[2 * i], w[i]);
+
+  gsl_histogram_accumulate_array (a, x, 2, w, 1, N / 3);
+  gsl_histogram_accumulate_array (b, x + 2 * (N / 3), 2, w + N / 3, 1, N - N / 3);
+  gsl_histogram_add (a, b);
+
+  status = 0;
+  for (i = 0; i < n; i++)
+    status |= (fabs (a->bin[i] - g->bin[i]) > 1e-12 * g->bin[i]);
+
+  gsl_test (status, "gsl_histogram_accumulate_array, %s", desc);
+
+  free (x);
+  free (w);
+  gsl_histogram_free (g);
+  gsl_histogram_free (a);
+  gsl_histogram_free (b);
+}
+
+void
+test1d_array (void)
+{
+  gsl_histogram *h;
+  size_t i;
+
+  gsl_ieee_env_setup ();
+
+  h = gsl_histogram_calloc_uniform (100, 0.0, 1.0);
+  test1d_array_compare (h, "uniform");
+  gsl_histogram_free (h);
+
+  h = gsl_histogram_calloc_uniform (37, -1.3, 7.7);
+  test1d_array_compare (h, "uniform, inexact boundaries");
+  gsl_histogram_free (h);
+
+  h = gsl_histogram_calloc (50);
+  for (i = 0; i <= 50; i++)
+    h->range[i] = (i * i) / 7.0 - 3.0;
+  test1d_array_compare (h, "non-uniform");
+  gsl_histogram_free (h);
+
+  h = gsl_histogram_calloc (1);
+  h->range[0] = 0.0;
+  h->range[1] = 1.0;
+  test1d_array_compare (h, "one bin");
+  gsl_histogram_free (h);
+
+  /* values which are all in range, and special values */
+  {
+    const double x[6] = { 0.0, 0.5, 0.999, GSL_NAN, GSL_POSINF, GSL_NEGINF };
+    int status;
+
+    h = gsl_histogram_calloc_uniform (10, 0.0, 1.0);
+
+    status = gsl_histogram_increment_array (h, x, 1, 3);
+    gsl_test (status != GSL_SUCCESS, "gsl_histogram_increment_array in range");
+
+    status = gsl_histogram_increment_array (h, x + 3, 1, 3);
+    gsl_test (status != GSL_EDOM || gsl_histogram_sum (h) != 3.0,
+              "gsl_histogram_increment_array NaN and Inf");
+
+    gsl_histogram_free (h);
+  }
+}
@@ -0,0 +1,101 @@
+/* histogram/test1d_loglinear.c
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogram.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+
+#include "urand.c"
+
+/* check that the ranges of a log-linear histogram are increasing, cover
+   [xmin, xmax] with the last bin reaching xmax, and that every bin is
+   narrower than rel_err times its lower limit */
+static void
+test1d_loglinear_ranges (double xmin, double xmax, double rel_err)
+{
+  gsl_histogram *h = gsl_histogram_calloc_loglinear (xmin, xmax, rel_err);
+  const size_t n = h->n;
+  size_t i;
+  int status = 0;
+
+  for (i = 0; i < n; i++)
+    {
+      status |= !(h->range[i + 1] > h->range[i]);
+      status |= ((h->range[i + 1] - h->range[i]) > rel_err * h->range[i] * (1 + 1e-15));
+    }
+
+  status |= (h->range[0] != xmin);
+  status |= !(h->range[n - 1] < xmax && h->range[n] >= xmax);
+
+  gsl_test (status, "gsl_histogram_calloc_loglinear (%g, %g, %g), n = %u",
+            xmin, xmax, rel_err, (unsigned int) n);
+
+  gsl_histogram_free (h);
+}
+
+void
+test1d_loglinear (void)
+{
+  gsl_ieee_env_setup ();
+
+  test1d_loglinear_ranges (1.0, 2.0, 0.5);
+  test1d_loglinear_ranges (1.0, 2.0000001, 0.5);
+  test1d_loglinear_ranges (1e-6, 1e3, 0.01);
+  test1d_loglinear_ranges (3.0, 3.0000001, 0.01);
+  test1d_loglinear_ranges (1e-150, 1e150, 0.1);
+  test1d_loglinear_ranges (0.7, 1e5, 1e-4);
+
+  /* the relative error of the bin centres for values spread over many
+     orders of magnitude, and merging with gsl_histogram_add */
+  {
+    const double rel_err = 0.001;
+    gsl_histogram *h = gsl_histogram_calloc_loglinear (1e-3, 1e6, rel_err);
+    gsl_histogram *h2 = gsl_histogram_clone (h);
+    double worst = 0.0;
+    size_t i, k;
+
+    gsl_histogram_reset (h2);
+
+    for (k = 0; k < 10000; k++)
+      {
+        const double x = pow (10.0, -3.0 + 9.0 * urand ());
+        double lower, upper;
+
+        gsl_histogram_find (h, x, &i);
+        gsl_histogram_get_range (h, i, &lower, &upper);
+        worst = GSL_MAX (worst, fabs ((lower + upper) / 2 - x) / x);
+
+        gsl_histogram_increment (k % 2 ? h : h2, x);
+      }
+
+    gsl_test (worst > rel_err / 2,
+              "gsl_histogram_calloc_loglinear relative error %g", worst);
+
+    gsl_histogram_add (h, h2);
+    gsl_test (gsl_histogram_sum (h) != 10000.0,
+              "gsl_histogram_calloc_loglinear merged sum");
+
+    gsl_histogram_free (h);
+    gsl_histogram_free (h2);
+  }
+}
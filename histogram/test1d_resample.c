@@ -26,6 +26,18 @@
 
 #include "urand.c"
 
+/* bin containing r in the cumulative sums, found by a linear scan */
+static size_t
+scan_sum (const size_t n, const double sum[], const double r)
+{
+  size_t i = 0;
+
+  while (i < n - 1 && !(sum[i] <= r && r < sum[i + 1]))
+    i++;
+
+  return i;
+}
+
 void
 test1d_resample (void)
 {
@@ -95,5 +107,57 @@ test1d_resample (void)
     gsl_test (status, "gsl_histogram_pdf_sample within statistical errors");
   }
 
+  /* compare the guide table search with a linear scan, on a histogram
+     with runs of empty bins and bins of very different sizes, including
+     the values of r at the bin boundaries */
+  {
+    const size_t n = 200, nr = 5000;
+    gsl_histogram *g = gsl_histogram_calloc_uniform (n, -2.0, 3.0);
+    gsl_histogram_pdf *p = gsl_histogram_pdf_alloc (n);
+    double *r = malloc (nr * sizeof (double));
+    double *x = malloc (nr * sizeof (double));
+    int astatus = 0;
+
+    status = 0;
+
+    for (i = 0; i < n; i++)
+      {
+        if (i % 17 < 5 || i == n - 1)
+          g->bin[i] = 0;
+        else
+          g->bin[i] = (i % 7 == 0) ? 1000.0 * urand () : urand ();
+      }
+
+    gsl_histogram_pdf_init (p, g);
+
+    for (i = 0; i < nr; i++)
+      r[i] = (i < n && p->sum[i] < p->sum[n]) ? p->sum[i] : urand ();
+
+    for (i = 0; i < nr; i++)
+      {
+        size_t k = scan_sum (n, p->sum, r[i]);
+        double xi = gsl_histogram_pdf_sample (p, r[i]);
+
+        status |= (xi < p->range[k] || xi > p->range[k + 1]);
+      }
+
+    gsl_test (status, "gsl_histogram_pdf_sample guide table");
+
+    for (i = 0; i < nr; i++)
+      x[i] = gsl_histogram_pdf_sample (p, r[i]);
+
+    gsl_histogram_pdf_sample_array (p, r, r, nr);
+
+    for (i = 0; i < nr; i++)
+      astatus |= (r[i] != x[i]);
+
+    gsl_test (astatus, "gsl_histogram_pdf_sample_array");
+
+    free (r);
+    free (x);
+    gsl_histogram_pdf_free (p);
+    gsl_histogram_free (g);
+  }
+
   gsl_histogram_free (h);
 }
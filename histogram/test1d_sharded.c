@@ -0,0 +1,194 @@
+/* histogram/test1d_sharded.c
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogram.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+
+#include "urand.c"
+
+#define N 10000
+#define NSHARDS 4
+
+/* fill the shards of a sharded histogram in turn and compare the
+   merged result with a single histogram filled with the same data */
+void
+test1d_sharded (void)
+{
+  gsl_histogram *h = gsl_histogram_calloc_uniform (50, -1.0, 1.0);
+  gsl_histogram *g = gsl_histogram_clone (h);
+  gsl_histogram *m = gsl_histogram_clone (h);
+  gsl_histogram *d = gsl_histogram_calloc_uniform (49, -1.0, 1.0);
+  gsl_histogram_sharded *s;
+  size_t i, k;
+  int status = 0;
+
+  gsl_ieee_env_setup ();
+
+  s = gsl_histogram_sharded_alloc (h, NSHARDS);
+
+  for (k = 0; k < NSHARDS; k++)
+    status |= !gsl_histogram_equal_bins_p (h, gsl_histogram_sharded_shard (s, k));
+
+  gsl_test (status, "gsl_histogram_sharded_alloc ranges");
+
+  for (i = 0; i < N; i++)
+    {
+      const double x = 2.4 * urand () - 1.2;
+      const double w = 0.5 + urand ();
+
+      k = i % NSHARDS;
+
+      if (i % 2)
+        {
+          gsl_histogram_increment (g, x);
+          gsl_histogram_sharded_increment (s, k, x);
+        }
+      else
+        {
+          gsl_histogram_accumulate (g, x, w);
+          gsl_histogram_sharded_accumulate (s, k, x, w);
+        }
+    }
+
+  gsl_histogram_sharded_merge (m, s);
+
+  status = 0;
+  for (i = 0; i < m->n; i++)
+    status |= (gsl_fcmp (m->bin[i], g->bin[i], 1e-12) != 0);
+
+  gsl_test (status, "gsl_histogram_sharded_merge");
+
+  status = 0;
+  for (i = 0; i < g->n; i++)
+    status |= (gsl_fcmp (gsl_histogram_sharded_get (s, i), g->bin[i], 1e-12) != 0);
+
+  gsl_test (status, "gsl_histogram_sharded_get");
+
+  {
+    const gsl_histogram *mm = gsl_histogram_sharded_merged (s);
+
+    status = 0;
+    for (i = 0; i < g->n; i++)
+      status |= (gsl_fcmp (mm->bin[i], g->bin[i], 1e-12) != 0);
+
+    gsl_test (status, "gsl_histogram_sharded_merged");
+  }
+
+  gsl_histogram_sharded_reset (s);
+  gsl_histogram_sharded_merge (m, s);
+  gsl_test (gsl_histogram_sum (m) != 0.0, "gsl_histogram_sharded_reset");
+
+  /* automatic shard selection, where atomic operations are available */
+  {
+    gsl_error_handler_t *old_handler = gsl_set_error_handler_off ();
+    int supported;
+
+    gsl_histogram_reset (g);
+    supported = (gsl_histogram_sharded_thread_increment (s, 0.0) != GSL_EUNSUP);
+    gsl_set_error_handler (old_handler);
+
+    if (supported)
+      {
+        const gsl_histogram *mm;
+        size_t used = 0;
+
+        gsl_histogram_increment (g, 0.0);
+
+        for (i = 0; i < N; i++)
+          {
+            const double x = 2.4 * urand () - 1.2;
+            const double w = 0.5 + urand ();
+
+            gsl_histogram_accumulate (g, x, w);
+            gsl_histogram_sharded_thread_accumulate (s, x, w);
+          }
+
+        mm = gsl_histogram_sharded_merged (s);
+
+        status = 0;
+        for (i = 0; i < g->n; i++)
+          status |= (gsl_fcmp (mm->bin[i], g->bin[i], 1e-12) != 0);
+
+        gsl_test (status, "gsl_histogram_sharded_thread_accumulate");
+
+        for (k = 0; k < NSHARDS; k++)
+          used += (gsl_histogram_sum (gsl_histogram_sharded_shard (s, k)) != 0.0);
+
+        gsl_test (used != 1, "gsl_histogram_sharded_thread_accumulate one shard per thread");
+      }
+
+    gsl_histogram_sharded_reset (s);
+  }
+
+  /* atomic mode, or ordinary shards where atomics are not available */
+  {
+    gsl_histogram_sharded *a = gsl_histogram_sharded_alloc_atomic (h, NSHARDS);
+    const gsl_histogram *mm;
+
+    gsl_histogram_reset (g);
+
+    for (i = 0; i < N; i++)
+      {
+        const double x = 2.4 * urand () - 1.2;
+        const double w = 0.5 + urand ();
+
+        k = i % a->nshards;
+
+        gsl_histogram_accumulate (g, x, w);
+        gsl_histogram_sharded_accumulate (a, k, x, w);
+      }
+
+    mm = gsl_histogram_sharded_merged (a);
+
+    status = 0;
+    for (i = 0; i < g->n; i++)
+      status |= (gsl_fcmp (mm->bin[i], g->bin[i], 1e-12) != 0);
+
+    gsl_test (status, "gsl_histogram_sharded_alloc_atomic");
+
+    gsl_histogram_sharded_free (a);
+  }
+
+  {
+    gsl_error_handler_t *old_handler = gsl_set_error_handler_off ();
+    int status;
+
+    status = gsl_histogram_sharded_increment (s, NSHARDS, 0.0);
+    gsl_test (status != GSL_EINVAL, "gsl_histogram_sharded_increment bad shard");
+
+    gsl_test (gsl_histogram_sharded_get (s, m->n) != 0.0,
+              "gsl_histogram_sharded_get bad index");
+
+    status = gsl_histogram_sharded_merge (d, s);
+    gsl_test (status != GSL_EINVAL, "gsl_histogram_sharded_merge different binning");
+
+    gsl_set_error_handler (old_handler);
+  }
+
+  gsl_histogram_sharded_free (s);
+  gsl_histogram_free (h);
+  gsl_histogram_free (g);
+  gsl_histogram_free (m);
+  gsl_histogram_free (d);
+}
@@ -0,0 +1,125 @@
+/* histogram/test2d_array.c
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogram2d.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+
+#include "urand.c"
+
+#define N 10000
+
+/* fill h with gsl_histogram2d_increment_array and with single calls,
+   and compare the bins */
+static void
+test2d_array_compare (gsl_histogram2d * h, const char * desc)
+{
+  const size_t nx = h->nx, ny = h->ny;
+  double *x = malloc (N * sizeof (double));
+  double *y = malloc (N * sizeof (double));
+  double *w = malloc (N * sizeof (double));
+  gsl_histogram2d *g = gsl_histogram2d_clone (h);
+  gsl_histogram2d *a = gsl_histogram2d_clone (h);
+  gsl_histogram2d *b = gsl_histogram2d_clone (h);
+  size_t i;
+  int status = 0, ret;
+
+  for (i = 0; i < N; i++)
+    {
+      double u = urand (), v = urand ();
+
+      if (i % 7 == 0)
+        {
+          x[i] = h->xrange[(size_t) (u * (nx + 1))];
+          y[i] = h->yrange[(size_t) (v * (ny + 1))];
+        }
+      else
+        {
+          x[i] = h->xrange[0] + (1.2 * u - 0.1) * (h->xrange[nx] - h->xrange[0]);
+          y[i] = h->yrange[0] + (1.2 * v - 0.1) * (h->yrange[ny] - h->yrange[0]);
+        }
+
+      w[i] = 0.5 + urand ();
+    }
+
+  gsl_histogram2d_reset (g);
+  gsl_histogram2d_reset (h);
+
+  for (i = 0; i < N; i++)
+    gsl_histogram2d_increment (g, x[i], y[i]);
+
+  ret = gsl_histogram2d_increment_array (h, x, 1, y, 1, N);
+
+  for (i = 0; i < nx * ny; i++)
+    status |= (h->bin[i] != g->bin[i]);
+
+  gsl_test (status, "gsl_histogram2d_increment_array, %s", desc);
+  gsl_test (ret != GSL_EDOM, "gsl_histogram2d_increment_array return value, %s", desc);
+
+  /* weighted, and split into two sub-histograms which are then added */
+  gsl_histogram2d_reset (g);
+  gsl_histogram2d_reset (a);
+  gsl_histogram2d_reset (b);
+
+  for (i = 0; i < N; i++)
+    gsl_histogram2d_accumulate (g, x[i], y[i], w[i]);
+
+  gsl_histogram2d_accumulate_array (a, x, 1, y, 1, w, 1, N / 2);
+  gsl_histogram2d_accumulate_array (b, x + N / 2, 1, y + N / 2, 1, w + N / 2, 1, N - N / 2);
+  gsl_histogram2d_add (a, b);
+
+  status = 0;
+  for (i = 0; i < nx * ny; i++)
+    status |= (fabs (a->bin[i] - g->bin[i]) > 1e-12 * g->bin[i]);
+
+  gsl_test (status, "gsl_histogram2d_accumulate_array, %s", desc);
+
+  free (x);
+  free (y);
+  free (w);
+  gsl_histogram2d_free (g);
+  gsl_histogram2d_free (a);
+  gsl_histogram2d_free (b);
+}
+
+void
+test2d_array (void)
+{
+  gsl_histogram2d *h;
+  size_t i;
+
+  gsl_ieee_env_setup ();
+
+  h = gsl_histogram2d_calloc_uniform (20, 30, 0.0, 1.0, -2.1, 3.3);
+  test2d_array_compare (h, "uniform");
+  gsl_histogram2d_free (h);
+
+  h = gsl_histogram2d_calloc (15, 25);
+  for (i = 0; i <= 15; i++)
+    h->xrange[i] = sqrt ((double) i);
+  for (i = 0; i <= 25; i++)
+    h->yrange[i] = (double) (i * i);
+  test2d_array_compare (h, "non-uniform");
+  gsl_histogram2d_free (h);
+}
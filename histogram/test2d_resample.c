@@ -111,5 +111,45 @@ test2d_resample (void)
     gsl_test (status, "gsl_histogram2d_pdf_sample within statistical errors");
   }
 
+  /* gsl_histogram2d_pdf_sample_array must give the same points as
+     gsl_histogram2d_pdf_sample */
+  {
+    const size_t nr = 1000;
+    gsl_histogram2d_pdf *p = gsl_histogram2d_pdf_alloc (10, 10);
+    double *u = malloc (nr * sizeof (double));
+    double *v = malloc (nr * sizeof (double));
+    double *x = malloc (nr * sizeof (double));
+    double *y = malloc (nr * sizeof (double));
+
+    gsl_histogram2d_pdf_init (p, h);
+
+    for (i = 0; i < nr; i++)
+      {
+        u[i] = (i < 100) ? p->sum[i] : urand ();
+        v[i] = urand ();
+      }
+
+    u[0] = 1.0;
+    v[1] = 1.0;
+
+    gsl_histogram2d_pdf_sample_array (p, u, v, x, y, nr);
+
+    status = 0;
+    for (i = 0; i < nr; i++)
+      {
+        double xi, yi;
+        gsl_histogram2d_pdf_sample (p, u[i], v[i], &xi, &yi);
+        status |= (xi != x[i] || yi != y[i]);
+      }
+
+    gsl_test (status, "gsl_histogram2d_pdf_sample_array");
+
+    free (u);
+    free (v);
+    free (x);
+    free (y);
+    gsl_histogram2d_pdf_free (p);
+  }
+
   gsl_histogram2d_free (h) ;
 }
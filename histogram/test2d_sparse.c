@@ -0,0 +1,188 @@
+/* histogram/test2d_sparse.c
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogram2d.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+
+#include "urand.c"
+
+#define NX 300
+#define NY 200
+#define N 20000
+
+/* fill a sparse and a dense histogram with the same points and compare
+   the bins, statistics and sampled distributions */
+void
+test2d_sparse (void)
+{
+  gsl_histogram2d *g = gsl_histogram2d_calloc_uniform (NX, NY, -1.0, 2.0, 0.0, 1.0);
+  gsl_histogram2d *g2 = gsl_histogram2d_clone (g);
+  gsl_histogram2d_sparse *h = gsl_histogram2d_sparse_alloc (NX, NY);
+  gsl_histogram2d_sparse *h2 = gsl_histogram2d_sparse_alloc (NX, NY);
+  gsl_histogram2d_pdf *gp = gsl_histogram2d_pdf_alloc (NX, NY);
+  gsl_histogram2d_sparse_pdf *hp = gsl_histogram2d_sparse_pdf_alloc (NX, NY);
+  size_t i, j, k, pos, count;
+  double value;
+  int status;
+
+  gsl_ieee_env_setup ();
+
+  gsl_histogram2d_sparse_set_ranges (h, g->xrange, NX + 1, g->yrange, NY + 1);
+  gsl_histogram2d_sparse_set_ranges_uniform (h2, -1.0, 2.0, 0.0, 1.0);
+
+  gsl_test (!gsl_histogram2d_sparse_equal_bins_p (h, h2),
+            "gsl_histogram2d_sparse_set_ranges_uniform");
+
+  /* points clustered around a few centres, so that most bins are
+     empty, and some outside the range */
+  for (k = 0; k < N; k++)
+    {
+      const double cx = (k % 3) - 0.5, cy = (k % 5) * 0.2 + 0.1;
+      const double x = cx + 0.3 * (urand () - 0.5) * urand ();
+      const double y = cy + 0.1 * (urand () - 0.5) * urand ();
+      const double w = (k % 4) ? 1.0 : 0.5 + urand ();
+
+      gsl_histogram2d_accumulate (k % 2 ? g : g2, x, y, w);
+
+      if (k % 2)
+        gsl_histogram2d_sparse_accumulate (h, x, y, w);
+      else
+        {
+          gsl_histogram2d_sparse_increment (h2, x, y);
+          gsl_histogram2d_sparse_accumulate (h2, x, y, w - 1.0);
+        }
+    }
+
+  gsl_histogram2d_add (g, g2);
+  gsl_histogram2d_sparse_add (h, h2);
+
+  status = 0;
+  count = 0;
+  for (i = 0; i < NX; i++)
+    for (j = 0; j < NY; j++)
+      {
+        double gij = gsl_histogram2d_get (g, i, j);
+        double hij = gsl_histogram2d_sparse_get (h, i, j);
+
+        status |= (gsl_fcmp (gij + 1.0, hij + 1.0, 1e-12) != 0);
+
+        if (gij != 0)
+          count++;
+      }
+
+  gsl_test (status, "gsl_histogram2d_sparse_add bins");
+  gsl_test (h->nbins != count, "gsl_histogram2d_sparse nbins %u",
+            (unsigned int) h->nbins);
+  gsl_test (h->nbins > NX * NY / 10, "gsl_histogram2d_sparse is sparse");
+
+  status = 0;
+  count = 0;
+  pos = 0;
+  while (gsl_histogram2d_sparse_next (h, &pos, &i, &j, &value) == GSL_SUCCESS)
+    {
+      status |= (value != gsl_histogram2d_sparse_get (h, i, j));
+      count++;
+    }
+
+  gsl_test (status || count != h->nbins, "gsl_histogram2d_sparse_next");
+
+  {
+    double x = 0.123, y = 0.456;
+    size_t gi, gj;
+
+    gsl_histogram2d_find (g, x, y, &gi, &gj);
+    gsl_histogram2d_sparse_find (h, x, y, &i, &j);
+    gsl_test (i != gi || j != gj, "gsl_histogram2d_sparse_find");
+  }
+
+  gsl_test_rel (gsl_histogram2d_sparse_sum (h), gsl_histogram2d_sum (g),
+                1e-12, "gsl_histogram2d_sparse_sum");
+  gsl_test_rel (gsl_histogram2d_sparse_xmean (h), gsl_histogram2d_xmean (g),
+                1e-12, "gsl_histogram2d_sparse_xmean");
+  gsl_test_rel (gsl_histogram2d_sparse_ymean (h), gsl_histogram2d_ymean (g),
+                1e-12, "gsl_histogram2d_sparse_ymean");
+  gsl_test_rel (gsl_histogram2d_sparse_xsigma (h), gsl_histogram2d_xsigma (g),
+                1e-12, "gsl_histogram2d_sparse_xsigma");
+  gsl_test_rel (gsl_histogram2d_sparse_ysigma (h), gsl_histogram2d_ysigma (g),
+                1e-12, "gsl_histogram2d_sparse_ysigma");
+  gsl_test_rel (gsl_histogram2d_sparse_cov (h), gsl_histogram2d_cov (g),
+                1e-10, "gsl_histogram2d_sparse_cov");
+
+  gsl_histogram2d_pdf_init (gp, g);
+  gsl_histogram2d_sparse_pdf_init (hp, h);
+
+  status = 0;
+  for (k = 0; k < 1000; k++)
+    {
+      double r1 = urand (), r2 = urand ();
+      double gx, gy, hx, hy;
+
+      gsl_histogram2d_pdf_sample (gp, r1, r2, &gx, &gy);
+      gsl_histogram2d_sparse_pdf_sample (hp, r1, r2, &hx, &hy);
+
+      status |= (fabs (gx - hx) > 1e-9 || fabs (gy - hy) > 1e-9);
+    }
+
+  gsl_test (status, "gsl_histogram2d_sparse_pdf_sample");
+
+  gsl_histogram2d_sparse_reset (h);
+  gsl_test (h->nbins != 0 || gsl_histogram2d_sparse_sum (h) != 0,
+            "gsl_histogram2d_sparse_reset");
+
+  {
+    gsl_error_handler_t *old_handler = gsl_set_error_handler_off ();
+
+    status = gsl_histogram2d_sparse_pdf_init (hp, h);
+    gsl_test (status != GSL_EDOM, "gsl_histogram2d_sparse_pdf_init empty");
+
+    gsl_set_error_handler (old_handler);
+  }
+
+  /* a histogram with 10^10 bins, far too many to store densely */
+  if (((size_t) -1) / 100000 > 100000)
+    {
+      gsl_histogram2d_sparse *b = gsl_histogram2d_sparse_alloc (100000, 100000);
+
+      gsl_histogram2d_sparse_set_ranges_uniform (b, 0.0, 1.0, 0.0, 1.0);
+
+      for (k = 0; k < N; k++)
+        gsl_histogram2d_sparse_increment (b, urand (), urand ());
+
+      gsl_histogram2d_sparse_increment (b, 0.999999999, 0.999999999);
+
+      gsl_test (gsl_histogram2d_sparse_sum (b) != N + 1,
+                "gsl_histogram2d_sparse with 10^10 bins");
+      gsl_test (gsl_histogram2d_sparse_get (b, 99999, 99999) != 1.0,
+                "gsl_histogram2d_sparse_get with 10^10 bins");
+
+      gsl_histogram2d_sparse_free (b);
+    }
+
+  gsl_histogram2d_free (g);
+  gsl_histogram2d_free (g2);
+  gsl_histogram2d_sparse_free (h);
+  gsl_histogram2d_sparse_free (h2);
+  gsl_histogram2d_pdf_free (gp);
+  gsl_histogram2d_sparse_pdf_free (hp);
+}
@@ -44,6 +44,21 @@ typedef struct {
     FILE * file;
     void * ntuple_data;
     size_t size;
+    /* columnar files (ncols > 0), written and read a chunk of
+       chunk_rows rows at a time through the row buffer chunk */
+    size_t ncols;
+    size_t * col_size;
+    int * col_use;
+    char * chunk;
+    char * colbuf;
+    size_t chunk_rows;
+    size_t nrows;
+    size_t pos;
+    int writing;
+    /* memory mapped input file, or 0 when reading through stdio */
+    void * map;
+    size_t map_size;
+    size_t map_pos;
 } gsl_ntuple;
 
 typedef struct {
@@ -56,21 +71,50 @@ typedef struct {
   void * params;
 } gsl_ntuple_value_fn;
 
+typedef struct {
+  int (* function) (const void * rows, size_t n, double values[], void * params);
+  void * params;
+} gsl_ntuple_batch_fn;
+
 gsl_ntuple * 
 gsl_ntuple_open (char * filename, void * ntuple_data, size_t size);
 
 gsl_ntuple * 
 gsl_ntuple_create (char * filename, void * ntuple_data, size_t size);
 
+gsl_ntuple *
+gsl_ntuple_create_columns (char * filename, void * ntuple_data, size_t size,
+                           const size_t col_size[], const size_t ncols);
+
+gsl_ntuple *
+gsl_ntuple_open_columns (char * filename, void * ntuple_data, size_t size,
+                         const size_t col_size[], const size_t ncols);
+
+int gsl_ntuple_use_columns (gsl_ntuple * ntuple, const int use[]);
+
 int gsl_ntuple_write (gsl_ntuple * ntuple);
 int gsl_ntuple_read (gsl_ntuple * ntuple);
 
+int gsl_ntuple_write_rows (gsl_ntuple * ntuple, const void * rows,
+                           const size_t n);
+int gsl_ntuple_read_rows (gsl_ntuple * ntuple, void * rows, const size_t n,
+                          size_t * nread);
+
 int gsl_ntuple_bookdata (gsl_ntuple * ntuple);  /* synonym for write */
 
 int gsl_ntuple_project (gsl_histogram * h, gsl_ntuple * ntuple, 
                         gsl_ntuple_value_fn *value_func,
                         gsl_ntuple_select_fn *select_func);
 
+int gsl_ntuple_project_multi (gsl_histogram * h[], const size_t nh,
+                              gsl_ntuple * ntuple,
+                              gsl_ntuple_value_fn * value_func[],
+                              gsl_ntuple_select_fn * select_func[]);
+
+int gsl_ntuple_project_batch (gsl_histogram * h[], const size_t nh,
+                              gsl_ntuple * ntuple,
+                              gsl_ntuple_batch_fn * batch_func[]);
+
 int gsl_ntuple_close (gsl_ntuple * ntuple);
 
 __END_DECLS
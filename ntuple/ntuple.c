@@ -21,16 +21,41 @@
 
 #include <config.h>
 #include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#define NTUPLE_MMAP 1
+#endif
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_ntuple.h>
 
-/* 
- * gsl_ntuple_open:
- * Initialize an ntuple structure and create the related file
- */
+/* size in bytes of the stdio buffer of an ntuple file, and of the
+   blocks of rows read by gsl_ntuple_project */
 
-gsl_ntuple *
-gsl_ntuple_create (char *filename, void *ntuple_data, size_t size)
+#define NTUPLE_BLOCK 65536
+
+/* size in bytes of a chunk of a columnar file.  It is large compared
+   with NTUPLE_BLOCK so that the columns which are not used can be
+   skipped without reading them. */
+
+#define NTUPLE_CHUNK 4194304
+
+/* A columnar file starts with the header
+
+     "GSLNTCOL", ncols, col_size[0] ... col_size[ncols-1], chunk_rows
+
+   followed by chunks of at most chunk_rows rows, each made of the
+   number of rows and then the values of each column in turn.  All
+   counts are stored as size_t, in the native format, like the rows
+   of an ordinary ntuple file. */
+
+static const char ntuple_magic[8] = { 'G', 'S', 'L', 'N', 'T', 'C', 'O', 'L' };
+
+static gsl_ntuple *
+ntuple_alloc (void *ntuple_data, size_t size)
 {
   gsl_ntuple *ntuple = (gsl_ntuple *)malloc (sizeof (gsl_ntuple));
 
@@ -40,17 +65,427 @@ gsl_ntuple_create (char *filename, void *ntuple_data, size_t size)
                      GSL_ENOMEM, 0);
     }
 
+  ntuple->file = 0;
   ntuple->ntuple_data = ntuple_data;
   ntuple->size = size;
+  ntuple->ncols = 0;
+  ntuple->col_size = 0;
+  ntuple->col_use = 0;
+  ntuple->chunk = 0;
+  ntuple->colbuf = 0;
+  ntuple->chunk_rows = 0;
+  ntuple->nrows = 0;
+  ntuple->pos = 0;
+  ntuple->writing = 0;
+  ntuple->map = 0;
+  ntuple->map_size = 0;
+  ntuple->map_pos = 0;
+
+  return ntuple;
+}
+
+static void
+ntuple_free (gsl_ntuple * ntuple)
+{
+#ifdef NTUPLE_MMAP
+  if (ntuple->map != 0)
+    munmap (ntuple->map, ntuple->map_size);
+#endif
+
+  free (ntuple->col_size);
+  free (ntuple->col_use);
+  free (ntuple->chunk);
+  free (ntuple->colbuf);
+  free (ntuple);
+}
+
+/* map a regular input file into memory, so that rows can be read
+   without copying them through stdio; on failure the file is read
+   with stdio */
+
+static void
+ntuple_map (gsl_ntuple * ntuple)
+{
+#ifdef NTUPLE_MMAP
+  struct stat st;
+  const int fd = fileno (ntuple->file);
+  void *map;
+
+  if (fstat (fd, &st) != 0 || !S_ISREG (st.st_mode) || st.st_size <= 0
+      || (off_t) (size_t) st.st_size != st.st_size)
+    {
+      return;
+    }
+
+  map = mmap (0, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  if (map == MAP_FAILED)
+    {
+      return;
+    }
+
+#ifdef MADV_SEQUENTIAL
+  madvise (map, (size_t) st.st_size, MADV_SEQUENTIAL);
+#endif
+
+  ntuple->map = map;
+  ntuple->map_size = (size_t) st.st_size;
+  ntuple->map_pos = 0;
+#else
+  (void) ntuple;
+#endif
+}
+
+/* get the next nbytes of the file, as a pointer into the mapped file
+   or read into buf; returns GSL_EOF at the end of the file and
+   GSL_EFAILED if the file ends early or cannot be read */
+
+static int
+ntuple_get (gsl_ntuple * ntuple, char * buf, size_t nbytes, const char ** p)
+{
+  if (ntuple->map != 0)
+    {
+      const size_t avail = ntuple->map_size - ntuple->map_pos;
+
+      if (avail == 0)
+        return GSL_EOF;
+
+      if (avail < nbytes)
+        return GSL_EFAILED;
+
+      *p = (const char *) ntuple->map + ntuple->map_pos;
+      ntuple->map_pos += nbytes;
+
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      const size_t nread = fread (buf, 1, nbytes, ntuple->file);
+
+      *p = buf;
+
+      if (nread == nbytes)
+        return GSL_SUCCESS;
+
+      if (nread == 0 && feof (ntuple->file))
+        return GSL_EOF;
+
+      return GSL_EFAILED;
+    }
+}
+
+static int
+ntuple_skip (gsl_ntuple * ntuple, size_t nbytes)
+{
+  if (ntuple->map != 0)
+    {
+      if (ntuple->map_size - ntuple->map_pos < nbytes)
+        return GSL_EFAILED;
+
+      ntuple->map_pos += nbytes;
+
+      return GSL_SUCCESS;
+    }
+
+  return fseek (ntuple->file, (long) nbytes, SEEK_CUR) ? GSL_EFAILED : GSL_SUCCESS;
+}
+
+/* read the next chunk of a columnar file into the row buffer, leaving
+   the columns which are not used as zero */
+
+static int
+ntuple_load_chunk (gsl_ntuple * ntuple)
+{
+  const size_t size = ntuple->size;
+  char head[sizeof (size_t)];
+  const char *p;
+  size_t nrows, i, j, offset = 0;
+  int status = ntuple_get (ntuple, head, sizeof (size_t), &p);
+
+  if (status)
+    return status;
+
+  memcpy (&nrows, p, sizeof (size_t));
+
+  if (nrows == 0 || nrows > ntuple->chunk_rows)
+    return GSL_EFAILED;
+
+  for (j = 0; j < ntuple->ncols; j++)
+    {
+      const size_t cs = ntuple->col_size[j];
+      char *row = ntuple->chunk + offset;
+
+      if (ntuple->col_use[j])
+        {
+          if (ntuple_get (ntuple, ntuple->colbuf, nrows * cs, &p))
+            return GSL_EFAILED;
+
+          for (i = 0; i < nrows; i++)
+            memcpy (row + i * size, p + i * cs, cs);
+        }
+      else
+        {
+          if (ntuple_skip (ntuple, nrows * cs))
+            return GSL_EFAILED;
+
+          for (i = 0; i < nrows; i++)
+            memset (row + i * size, 0, cs);
+        }
+
+      offset += cs;
+    }
+
+  ntuple->nrows = nrows;
+  ntuple->pos = 0;
+
+  return GSL_SUCCESS;
+}
+
+/* get up to n of the next rows, as a pointer into the mapped file or
+   the chunk buffer, or read into block; *nread is zero at the end of
+   the file */
+
+static int
+ntuple_next_rows (gsl_ntuple * ntuple, char * block, size_t n,
+                  const char ** p, size_t * nread)
+{
+  const size_t size = ntuple->size;
+
+  if (ntuple->ncols > 0)
+    {
+      if (ntuple->pos == ntuple->nrows)
+        {
+          int status = ntuple_load_chunk (ntuple);
+
+          if (status == GSL_EOF)
+            {
+              *nread = 0;
+              return GSL_SUCCESS;
+            }
+
+          if (status)
+            return status;
+        }
+
+      *nread = ntuple->nrows - ntuple->pos;
+
+      if (*nread > n)
+        *nread = n;
+
+      *p = ntuple->chunk + ntuple->pos * size;
+      ntuple->pos += *nread;
+    }
+  else if (ntuple->map != 0)
+    {
+      *nread = (ntuple->map_size - ntuple->map_pos) / size;
+
+      if (*nread > n)
+        *nread = n;
+
+      *p = (const char *) ntuple->map + ntuple->map_pos;
+      ntuple->map_pos += *nread * size;
+    }
+  else
+    {
+      *nread = fread (block, size, n, ntuple->file);
+      *p = block;
+
+      if (*nread < n && ferror (ntuple->file))
+        return GSL_EFAILED;
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* read up to n rows into rows, stopping early only at the end of the
+   file */
+
+static int
+ntuple_fill (gsl_ntuple * ntuple, char * rows, size_t n, size_t * nread)
+{
+  const size_t size = ntuple->size;
+  size_t k = 0;
+
+  while (k < n)
+    {
+      const char *p;
+      size_t m;
+      int status = ntuple_next_rows (ntuple, rows + k * size, n - k, &p, &m);
+
+      if (status)
+        return status;
+
+      if (m == 0)
+        break;
+
+      if (p != rows + k * size)
+        memcpy (rows + k * size, p, m * size);
+
+      k += m;
+    }
+
+  *nread = k;
+
+  return GSL_SUCCESS;
+}
+
+/* write the buffered rows of a columnar file as one chunk */
+
+static int
+ntuple_flush_chunk (gsl_ntuple * ntuple)
+{
+  const size_t size = ntuple->size;
+  const size_t nrows = ntuple->nrows;
+  size_t i, j, offset = 0;
+
+  if (nrows == 0)
+    return GSL_SUCCESS;
+
+  if (fwrite (&nrows, sizeof (size_t), 1, ntuple->file) != 1)
+    return GSL_EFAILED;
+
+  for (j = 0; j < ntuple->ncols; j++)
+    {
+      const size_t cs = ntuple->col_size[j];
+      const char *row = ntuple->chunk + offset;
+
+      for (i = 0; i < nrows; i++)
+        memcpy (ntuple->colbuf + i * cs, row + i * size, cs);
+
+      if (fwrite (ntuple->colbuf, cs, nrows, ntuple->file) != nrows)
+        return GSL_EFAILED;
+
+      offset += cs;
+    }
+
+  ntuple->nrows = 0;
+
+  return GSL_SUCCESS;
+}
+
+static int
+ntuple_put_rows (gsl_ntuple * ntuple, const char * rows, size_t n)
+{
+  const size_t size = ntuple->size;
+
+  while (n > 0)
+    {
+      size_t m = ntuple->chunk_rows - ntuple->nrows;
+
+      if (m > n)
+        m = n;
+
+      memcpy (ntuple->chunk + ntuple->nrows * size, rows, m * size);
+      ntuple->nrows += m;
+      rows += m * size;
+      n -= m;
+
+      if (ntuple->nrows == ntuple->chunk_rows)
+        {
+          int status = ntuple_flush_chunk (ntuple);
+
+          if (status)
+            return status;
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* set up the column layout and buffers of a columnar ntuple */
+
+static int
+ntuple_init_columns (gsl_ntuple * ntuple, const size_t col_size[],
+                     const size_t ncols, const size_t chunk_rows)
+{
+  size_t j, max_size = 0;
+
+  ntuple->col_size = (size_t *) malloc (ncols * sizeof (size_t));
+  ntuple->col_use = (int *) malloc (ncols * sizeof (int));
+
+  if (ntuple->col_size == 0 || ntuple->col_use == 0)
+    {
+      GSL_ERROR ("failed to allocate space for columns", GSL_ENOMEM);
+    }
+
+  for (j = 0; j < ncols; j++)
+    {
+      ntuple->col_size[j] = col_size[j];
+      ntuple->col_use[j] = 1;
+
+      if (col_size[j] > max_size)
+        max_size = col_size[j];
+    }
+
+  ntuple->ncols = ncols;
+  ntuple->chunk_rows = chunk_rows;
+
+  ntuple->chunk = (char *) malloc (chunk_rows * ntuple->size);
+  ntuple->colbuf = (char *) malloc (chunk_rows * max_size);
+
+  if (ntuple->chunk == 0 || ntuple->colbuf == 0)
+    {
+      GSL_ERROR ("failed to allocate space for ntuple chunk", GSL_ENOMEM);
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+ntuple_check_columns (size_t size, const size_t col_size[], const size_t ncols)
+{
+  size_t j, sum = 0;
+
+  if (ncols == 0)
+    {
+      GSL_ERROR ("number of columns must be positive", GSL_EINVAL);
+    }
+
+  for (j = 0; j < ncols; j++)
+    {
+      if (col_size[j] == 0)
+        {
+          GSL_ERROR ("column sizes must be positive", GSL_EINVAL);
+        }
+
+      sum += col_size[j];
+    }
+
+  if (sum != size)
+    {
+      GSL_ERROR ("column sizes must add up to the row size", GSL_EINVAL);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* 
+ * gsl_ntuple_open:
+ * Initialize an ntuple structure and create the related file
+ */
+
+gsl_ntuple *
+gsl_ntuple_create (char *filename, void *ntuple_data, size_t size)
+{
+  gsl_ntuple *ntuple = ntuple_alloc (ntuple_data, size);
+
+  if (ntuple == 0)
+    {
+      return 0;
+    }
 
   ntuple->file = fopen (filename, "wb");
 
   if (ntuple->file == 0)
     {
-      free (ntuple);
+      ntuple_free (ntuple);
       GSL_ERROR_VAL ("unable to create ntuple file", GSL_EFAILED, 0);
     }
 
+  setvbuf (ntuple->file, NULL, _IOFBF, NTUPLE_BLOCK);
+
+  ntuple->writing = 1;
+
   return ntuple;
 }
 
@@ -62,29 +497,170 @@ gsl_ntuple_create (char *filename, void *ntuple_data, size_t size)
 gsl_ntuple *
 gsl_ntuple_open (char *filename, void *ntuple_data, size_t size)
 {
-  gsl_ntuple *ntuple = (gsl_ntuple *)malloc (sizeof (gsl_ntuple));
+  gsl_ntuple *ntuple = ntuple_alloc (ntuple_data, size);
 
   if (ntuple == 0)
     {
-      GSL_ERROR_VAL ("failed to allocate space for ntuple struct",
-                     GSL_ENOMEM, 0);
+      return 0;
     }
 
-  ntuple->ntuple_data = ntuple_data;
-  ntuple->size = size;
-
   ntuple->file = fopen (filename, "rb");
 
   if (ntuple->file == 0)
     {
-      free (ntuple);
+      ntuple_free (ntuple);
       GSL_ERROR_VAL ("unable to open ntuple file for reading", 
                      GSL_EFAILED, 0);
     }
 
+  setvbuf (ntuple->file, NULL, _IOFBF, NTUPLE_BLOCK);
+
+  ntuple_map (ntuple);
+
   return ntuple;
 }
 
+/* 
+ * gsl_ntuple_create_columns:
+ * create an ntuple file in the columnar format, with rows made of
+ * ncols columns of the given sizes
+ */
+
+gsl_ntuple *
+gsl_ntuple_create_columns (char *filename, void *ntuple_data, size_t size,
+                           const size_t col_size[], const size_t ncols)
+{
+  gsl_ntuple *ntuple;
+  size_t chunk_rows = (size < NTUPLE_CHUNK) ? NTUPLE_CHUNK / size : 1;
+  int status = ntuple_check_columns (size, col_size, ncols);
+
+  if (status)
+    {
+      return 0;
+    }
+
+  ntuple = gsl_ntuple_create (filename, ntuple_data, size);
+
+  if (ntuple == 0)
+    {
+      return 0;
+    }
+
+  status = ntuple_init_columns (ntuple, col_size, ncols, chunk_rows);
+
+  if (status == GSL_SUCCESS
+      && (fwrite (ntuple_magic, 1, sizeof (ntuple_magic), ntuple->file) != sizeof (ntuple_magic)
+          || fwrite (&ncols, sizeof (size_t), 1, ntuple->file) != 1
+          || fwrite (col_size, sizeof (size_t), ncols, ntuple->file) != ncols
+          || fwrite (&chunk_rows, sizeof (size_t), 1, ntuple->file) != 1))
+    {
+      fclose (ntuple->file);
+      ntuple_free (ntuple);
+      GSL_ERROR_VAL ("failed to write ntuple header", GSL_EFAILED, 0);
+    }
+
+  if (status)
+    {
+      fclose (ntuple->file);
+      ntuple_free (ntuple);
+      return 0;
+    }
+
+  return ntuple;
+}
+
+/* 
+ * gsl_ntuple_open_columns:
+ * open an ntuple file in the columnar format, checking that its
+ * columns are the ones given
+ */
+
+gsl_ntuple *
+gsl_ntuple_open_columns (char *filename, void *ntuple_data, size_t size,
+                         const size_t col_size[], const size_t ncols)
+{
+  gsl_ntuple *ntuple;
+  char head[sizeof (ntuple_magic)];
+  size_t value = 0, j;
+  const char *p;
+  int status = ntuple_check_columns (size, col_size, ncols);
+
+  if (status)
+    {
+      return 0;
+    }
+
+  ntuple = gsl_ntuple_open (filename, ntuple_data, size);
+
+  if (ntuple == 0)
+    {
+      return 0;
+    }
+
+  /* the magic string, ncols, the column sizes and chunk_rows */
+
+  status = ntuple_get (ntuple, head, sizeof (ntuple_magic), &p);
+
+  if (status == GSL_SUCCESS && memcmp (p, ntuple_magic, sizeof (ntuple_magic)) != 0)
+    status = GSL_EFAILED;
+
+  for (j = 0; j < ncols + 2 && status == GSL_SUCCESS; j++)
+    {
+      status = ntuple_get (ntuple, head, sizeof (size_t), &p);
+
+      if (status)
+        break;
+
+      memcpy (&value, p, sizeof (size_t));
+
+      if ((j == 0 && value != ncols)
+          || (j > 0 && j <= ncols && value != col_size[j - 1])
+          || (j == ncols + 1 && value == 0))
+        status = GSL_EFAILED;
+    }
+
+  if (status)
+    {
+      gsl_ntuple_close (ntuple);
+      GSL_ERROR_VAL ("file is not a columnar ntuple with these columns",
+                     GSL_EFAILED, 0);
+    }
+
+  status = ntuple_init_columns (ntuple, col_size, ncols, value);
+
+  if (status)
+    {
+      gsl_ntuple_close (ntuple);
+      return 0;
+    }
+
+  return ntuple;
+}
+
+/* 
+ * gsl_ntuple_use_columns:
+ * select the columns of a columnar file which are read, the others
+ * are skipped and set to zero in the rows
+ */
+
+int
+gsl_ntuple_use_columns (gsl_ntuple * ntuple, const int use[])
+{
+  size_t j;
+
+  if (ntuple->ncols == 0)
+    {
+      GSL_ERROR ("ntuple file is not columnar", GSL_EINVAL);
+    }
+
+  for (j = 0; j < ntuple->ncols; j++)
+    {
+      ntuple->col_use[j] = (use[j] != 0);
+    }
+
+  return GSL_SUCCESS;
+}
+
 /* 
  * gsl_ntuple_write:
  * write to file a data row, must be used in a loop!
@@ -92,15 +668,40 @@ gsl_ntuple_open (char *filename, void *ntuple_data, size_t size)
 
 int
 gsl_ntuple_write (gsl_ntuple * ntuple)
+{
+  return gsl_ntuple_write_rows (ntuple, ntuple->ntuple_data, 1);
+}
+
+/* 
+ * gsl_ntuple_write_rows:
+ * write to file n data rows stored contiguously in rows
+ */
+
+int
+gsl_ntuple_write_rows (gsl_ntuple * ntuple, const void * rows, const size_t n)
 {
   size_t nwrite;
 
-  nwrite = fwrite (ntuple->ntuple_data, ntuple->size,
-                   1, ntuple->file);
+  if (n == 0)
+    {
+      return GSL_SUCCESS;
+    }
 
-  if (nwrite != 1)
+  if (ntuple->ncols > 0)
     {
-      GSL_ERROR ("failed to write ntuple entry to file", GSL_EFAILED);
+      if (ntuple_put_rows (ntuple, (const char *) rows, n))
+        {
+          GSL_ERROR ("failed to write ntuple entries to file", GSL_EFAILED);
+        }
+
+      return GSL_SUCCESS;
+    }
+
+  nwrite = fwrite (rows, ntuple->size, n, ntuple->file);
+
+  if (nwrite != n)
+    {
+      GSL_ERROR ("failed to write ntuple entries to file", GSL_EFAILED);
     }
 
   return GSL_SUCCESS;
@@ -123,17 +724,41 @@ int
 gsl_ntuple_read (gsl_ntuple * ntuple)
 {
   size_t nread;
+  int status = ntuple_fill (ntuple, (char *) ntuple->ntuple_data, 1, &nread);
 
-  nread = fread (ntuple->ntuple_data, ntuple->size, 1, ntuple->file);
+  if (status)
+    {
+      GSL_ERROR ("failed to read ntuple entry from file", GSL_EFAILED);
+    }
 
-  if (nread == 0 && feof(ntuple->file))
+  if (nread == 0)
     {
       return GSL_EOF;
     }
 
-  if (nread != 1)
+  return GSL_SUCCESS;
+}
+
+/* 
+ * gsl_ntuple_read_rows:
+ * read from file up to n data rows into rows, storing the number
+ * read in *nread
+ */
+
+int
+gsl_ntuple_read_rows (gsl_ntuple * ntuple, void * rows, const size_t n,
+                      size_t * nread)
+{
+  int status = ntuple_fill (ntuple, (char *) rows, n, nread);
+
+  if (status)
+    {
+      GSL_ERROR ("failed to read ntuple entries from file", GSL_EFAILED);
+    }
+
+  if (*nread == 0 && n > 0)
     {
-      GSL_ERROR ("failed to read ntuple entry from file", GSL_EFAILED);
+      return GSL_EOF;
     }
 
   return GSL_SUCCESS;
@@ -153,29 +778,124 @@ gsl_ntuple_project (gsl_histogram * h, gsl_ntuple * ntuple,
                     gsl_ntuple_value_fn * value_func, 
                     gsl_ntuple_select_fn * select_func)
 {
-  size_t nread;
+  return gsl_ntuple_project_multi (&h, 1, ntuple, &value_func, &select_func);
+}
+
+/* 
+ * gsl_ntuple_project_multi:
+ * fill nh histograms in a single pass over the ntuple file, each with
+ * its own value and selection functions
+ */
+
+int
+gsl_ntuple_project_multi (gsl_histogram * h[], const size_t nh,
+                          gsl_ntuple * ntuple,
+                          gsl_ntuple_value_fn * value_func[],
+                          gsl_ntuple_select_fn * select_func[])
+{
+  const size_t size = ntuple->size;
+  const size_t nrows = (size < NTUPLE_BLOCK) ? NTUPLE_BLOCK / size : 1;
+  char *block = (char *) malloc (nrows * size);
+  const char *rows;
+  size_t nread, i, k;
+
+  if (block == 0)
+    {
+      GSL_ERROR ("failed to allocate space for ntuple block", GSL_ENOMEM);
+    }
+
+  /* read the file a block of rows at a time, copying each row into
+     ntuple_data for the user functions */
 
   do
     {
-      nread = fread (ntuple->ntuple_data, ntuple->size,
-                     1, ntuple->file);
+      if (ntuple_next_rows (ntuple, block, nrows, &rows, &nread))
+        {
+          free (block);
+          GSL_ERROR ("failed to read ntuple for projection", GSL_EFAILED);
+        }
 
-      if (nread == 0 && feof(ntuple->file))
+      for (i = 0; i < nread; i++)
         {
-          break ;
+          memcpy (ntuple->ntuple_data, rows + i * size, size);
+
+          for (k = 0; k < nh; k++)
+            {
+              if (select_func[k] == 0 || EVAL(select_func[k], ntuple->ntuple_data))
+                {
+                  gsl_histogram_increment (h[k], EVAL(value_func[k], ntuple->ntuple_data));
+                }
+            }
         }
-      
-      if (nread != 1) 
+    }
+  while (nread > 0);
+
+  free (block);
+
+  return GSL_SUCCESS;
+}
+
+/* 
+ * gsl_ntuple_project_batch:
+ * fill nh histograms in a single pass over the ntuple file, calling
+ * each batch function once per block of rows.  Rows of a memory
+ * mapped file are passed to the batch functions without copying.
+ */
+
+int
+gsl_ntuple_project_batch (gsl_histogram * h[], const size_t nh,
+                          gsl_ntuple * ntuple,
+                          gsl_ntuple_batch_fn * batch_func[])
+{
+  const size_t size = ntuple->size;
+  const size_t nrows = (size < NTUPLE_BLOCK) ? NTUPLE_BLOCK / size : 1;
+  char *block = (char *) malloc (nrows * size);
+  double *values = (double *) malloc (nrows * sizeof (double));
+  const char *rows;
+  size_t nread, k;
+
+  if (block == 0 || values == 0)
+    {
+      free (block);
+      free (values);
+      GSL_ERROR ("failed to allocate space for ntuple block", GSL_ENOMEM);
+    }
+
+  for (;;)
+    {
+      if (ntuple_next_rows (ntuple, block, nrows, &rows, &nread))
         {
+          free (block);
+          free (values);
           GSL_ERROR ("failed to read ntuple for projection", GSL_EFAILED);
         }
 
-      if (EVAL(select_func, ntuple->ntuple_data))
+      if (nread == 0)
+        break;
+
+      for (k = 0; k < nh; k++)
         {
-          gsl_histogram_increment (h, EVAL(value_func, ntuple->ntuple_data));
+          int status = (*(batch_func[k]->function)) (rows, nread, values,
+                                                     batch_func[k]->params);
+
+          if (status)
+            {
+              free (block);
+              free (values);
+              GSL_ERROR ("batch function failed in ntuple projection", status);
+            }
+
+          /* values outside the histogram, including the NaNs of rows
+             which are not selected, are skipped */
+
+          gsl_histogram_increment_array (h[k], values, 1, nread);
         }
+
+      memcpy (ntuple->ntuple_data, rows + (nread - 1) * size, size);
     }
-  while (1);
+
+  free (block);
+  free (values);
 
   return GSL_SUCCESS;
 }
@@ -189,14 +909,21 @@ gsl_ntuple_project (gsl_histogram * h, gsl_ntuple * ntuple,
 int
 gsl_ntuple_close (gsl_ntuple * ntuple)
 {
-  int status = fclose (ntuple->file);
-  
-  if (status)
+  int flush = GSL_SUCCESS, status;
+
+  if (ntuple->writing && ntuple->ncols > 0)
     {
-      GSL_ERROR ("failed to close ntuple file", GSL_EFAILED);
+      flush = ntuple_flush_chunk (ntuple);
     }
 
-  free (ntuple);
+  status = fclose (ntuple->file);
+
+  ntuple_free (ntuple);
+
+  if (status || flush)
+    {
+      GSL_ERROR ("failed to close ntuple file", GSL_EFAILED);
+    }
 
   return GSL_SUCCESS;
 }
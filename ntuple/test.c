@@ -1,6 +1,8 @@
 #include <config.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_ntuple.h>
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_ieee_utils.h>
@@ -14,6 +16,8 @@ struct data
 };
 int sel_func (void *ntuple_data, void * params);
 double val_func (void *ntuple_data, void * params);
+double x_func (void *ntuple_data, void * params);
+int batch_func (const void *rows, size_t n, double values[], void * params);
 
 int
 main (void)
@@ -136,6 +140,260 @@ main (void)
     gsl_histogram_free (h);
   }
 
+  /* write and read the same rows in blocks, then project again */
+
+  {
+    struct data *rows = malloc (1000 * sizeof (struct data));
+    gsl_ntuple *ntuple;
+    size_t n, nread, total = 0;
+    int status = 0, s;
+
+    memset (rows, 0, 1000 * sizeof (struct data));
+
+    for (i = 0; i < 1000; i++)
+      {
+        rows[i].num = i;
+        rows[i].x = x[i];
+        rows[i].y = y[i];
+        rows[i].z = z[i];
+      }
+
+    ntuple = gsl_ntuple_create ("test.dat", &ntuple_row, sizeof (ntuple_row));
+
+    for (n = 0; n < 1000; n += 7)
+      {
+        s = gsl_ntuple_write_rows (ntuple, rows + n, (n + 7 <= 1000) ? 7 : 1000 - n);
+        status |= (s != GSL_SUCCESS);
+      }
+
+    gsl_ntuple_close (ntuple);
+
+    gsl_test (status, "writing ntuples in blocks");
+
+    memset (rows, 0, 1000 * sizeof (struct data));
+
+    ntuple = gsl_ntuple_open ("test.dat", &ntuple_row, sizeof (ntuple_row));
+
+    while ((s = gsl_ntuple_read_rows (ntuple, rows + total, 300, &nread)) == GSL_SUCCESS)
+      {
+        total += nread;
+
+        if (total > 700)
+          break;
+      }
+
+    s = gsl_ntuple_read_rows (ntuple, rows + total, 1000 - total, &nread);
+    total += nread;
+    status = (s != GSL_SUCCESS || total != 1000);
+
+    s = gsl_ntuple_read_rows (ntuple, rows, 1, &nread);
+    status |= (s != GSL_EOF || nread != 0);
+
+    for (i = 0; i < 1000; i++)
+      {
+        status |= (rows[i].num != i);
+        status |= (rows[i].x != x[i]);
+        status |= (rows[i].y != y[i]);
+        status |= (rows[i].z != z[i]);
+      }
+
+    gsl_ntuple_close (ntuple);
+
+    gsl_test (status, "reading ntuples in blocks");
+
+    {
+      gsl_histogram *h = gsl_histogram_calloc_uniform (100, 0., 1.);
+
+      ntuple = gsl_ntuple_open ("test.dat", &ntuple_row, sizeof (ntuple_row));
+      gsl_ntuple_project (h, ntuple, &V, &S);
+      gsl_ntuple_close (ntuple);
+
+      status = (ntuple_row.num != 999);
+
+      for (i = 0; i < 100; i++)
+        status |= (h->bin[i] != f[i]);
+
+      gsl_test (status, "histogramming ntuples written in blocks");
+
+      gsl_histogram_free (h);
+    }
+
+    free (rows);
+  }
+
+  /* several histograms filled in one pass, compared with separate
+     projections */
+
+  {
+    gsl_histogram *h[3], *g[3];
+    gsl_ntuple_value_fn X, *vf[3];
+    gsl_ntuple_select_fn *sf[3];
+    gsl_ntuple_batch_fn B, *bf[3];
+    gsl_ntuple *ntuple;
+    int k, status = 0;
+
+    X.function = &x_func;
+    X.params = &scale;
+
+    B.function = &batch_func;
+    B.params = &scale;
+
+    vf[0] = &V; sf[0] = &S;
+    vf[1] = &X; sf[1] = 0;
+    vf[2] = &X; sf[2] = &S;
+
+    for (k = 0; k < 3; k++)
+      {
+        h[k] = gsl_histogram_calloc_uniform (100, 0., 1.);
+        g[k] = gsl_histogram_calloc_uniform (100, 0., 1.);
+        bf[k] = &B;
+      }
+
+    ntuple = gsl_ntuple_open ("test.dat", &ntuple_row, sizeof (ntuple_row));
+    gsl_ntuple_project_multi (h, 3, ntuple, vf, sf);
+    gsl_ntuple_close (ntuple);
+
+    for (i = 0; i < 1000; i++)
+      {
+        gsl_histogram_increment (g[1], x[i] * scale);
+
+        if (x[i] * scale < 0.1)
+          gsl_histogram_increment (g[2], x[i] * scale);
+      }
+
+    for (i = 0; i < 100; i++)
+      {
+        status |= (h[0]->bin[i] != f[i]);
+        status |= (h[1]->bin[i] != g[1]->bin[i]);
+        status |= (h[2]->bin[i] != g[2]->bin[i]);
+      }
+
+    gsl_test (status, "gsl_ntuple_project_multi");
+
+    for (k = 0; k < 3; k++)
+      gsl_histogram_reset (h[k]);
+
+    ntuple_row.num = -1;
+
+    ntuple = gsl_ntuple_open ("test.dat", &ntuple_row, sizeof (ntuple_row));
+    gsl_ntuple_project_batch (h, 3, ntuple, bf);
+    gsl_ntuple_close (ntuple);
+
+    status = (ntuple_row.num != 999);
+
+    for (k = 0; k < 3; k++)
+      for (i = 0; i < 100; i++)
+        status |= (h[k]->bin[i] != f[i]);
+
+    gsl_test (status, "gsl_ntuple_project_batch");
+
+    for (k = 0; k < 3; k++)
+      {
+        gsl_histogram_free (h[k]);
+        gsl_histogram_free (g[k]);
+      }
+  }
+
+  /* the same rows in a columnar file, read back whole and with only
+     some of the columns */
+
+  {
+    const size_t col_size[4] = { offsetof (struct data, x), sizeof (double),
+                                 sizeof (double), sizeof (double) };
+    const int use[4] = { 0, 1, 0, 1 };
+    struct data *rows = malloc (1000 * sizeof (struct data));
+    gsl_histogram *h = gsl_histogram_calloc_uniform (100, 0., 1.);
+    gsl_ntuple *ntuple;
+    size_t nread;
+    int status = 0, s;
+
+    ntuple = gsl_ntuple_create_columns ("test.dat", &ntuple_row,
+                                        sizeof (ntuple_row), col_size, 4);
+
+    for (i = 0; i < 1000; i++)
+      {
+        ntuple_row.num = i;
+        ntuple_row.x = x[i];
+        ntuple_row.y = y[i];
+        ntuple_row.z = z[i];
+
+        if (i < 500)
+          status |= gsl_ntuple_write (ntuple);
+      }
+
+    memset (rows, 0, 1000 * sizeof (struct data));
+
+    for (i = 500; i < 1000; i++)
+      {
+        rows[i].num = i;
+        rows[i].x = x[i];
+        rows[i].y = y[i];
+        rows[i].z = z[i];
+      }
+
+    status |= gsl_ntuple_write_rows (ntuple, rows + 500, 500);
+    status |= gsl_ntuple_close (ntuple);
+
+    gsl_test (status, "writing columnar ntuples");
+
+    memset (rows, 0, 1000 * sizeof (struct data));
+
+    ntuple = gsl_ntuple_open_columns ("test.dat", &ntuple_row,
+                                      sizeof (ntuple_row), col_size, 4);
+
+    status = (gsl_ntuple_read (ntuple) != GSL_SUCCESS);
+    status |= (ntuple_row.num != 0 || ntuple_row.x != x[0]);
+
+    s = gsl_ntuple_read_rows (ntuple, rows + 1, 1000, &nread);
+    status |= (s != GSL_SUCCESS || nread != 999);
+    status |= (gsl_ntuple_read (ntuple) != GSL_EOF);
+
+    for (i = 1; i < 1000; i++)
+      {
+        status |= (rows[i].num != i);
+        status |= (rows[i].x != x[i]);
+        status |= (rows[i].y != y[i]);
+        status |= (rows[i].z != z[i]);
+      }
+
+    gsl_ntuple_close (ntuple);
+
+    gsl_test (status, "reading columnar ntuples");
+
+    ntuple = gsl_ntuple_open_columns ("test.dat", &ntuple_row,
+                                      sizeof (ntuple_row), col_size, 4);
+    gsl_ntuple_use_columns (ntuple, use);
+    gsl_ntuple_read_rows (ntuple, rows, 1000, &nread);
+    gsl_ntuple_close (ntuple);
+
+    status = (nread != 1000);
+
+    for (i = 0; i < 1000; i++)
+      {
+        status |= (rows[i].num != 0);
+        status |= (rows[i].x != x[i]);
+        status |= (rows[i].y != 0);
+        status |= (rows[i].z != z[i]);
+      }
+
+    gsl_test (status, "reading selected columns of columnar ntuples");
+
+    ntuple = gsl_ntuple_open_columns ("test.dat", &ntuple_row,
+                                      sizeof (ntuple_row), col_size, 4);
+    gsl_ntuple_project (h, ntuple, &V, &S);
+    gsl_ntuple_close (ntuple);
+
+    status = (ntuple_row.num != 999);
+
+    for (i = 0; i < 100; i++)
+      status |= (h->bin[i] != f[i]);
+
+    gsl_test (status, "histogramming columnar ntuples");
+
+    gsl_histogram_free (h);
+    free (rows);
+  }
+
   exit (gsl_test_summary());
 }
 
@@ -164,3 +422,32 @@ val_func (void *ntuple_data, void * params)
 
   return (x + y + z) * scale;
 }
+
+double
+x_func (void *ntuple_data, void * params)
+{
+  double scale = *(double *)params;
+
+  return ((struct data *) ntuple_data)->x * scale;
+}
+
+/* sel_func and val_func for a block of rows, with NaN for the rows
+   which are not selected */
+
+int
+batch_func (const void *rows, size_t n, double values[], void * params)
+{
+  const struct data *r = (const struct data *) rows;
+  double scale = *(double *)params;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      if (r[i].x * scale < 0.1)
+        values[i] = (r[i].x + r[i].y + r[i].z) * scale;
+      else
+        values[i] = GSL_NAN;
+    }
+
+  return GSL_SUCCESS;
+}
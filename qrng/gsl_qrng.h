@@ -20,6 +20,9 @@
 
 __BEGIN_DECLS
 
+/* the generators of gsl_rng.h, used for scrambling */
+struct gsl_rng_struct;
+
 
 /* Once again, more inane C-style OOP... kill me now. */
 
@@ -32,6 +35,9 @@ typedef struct
   size_t (*state_size) (unsigned int dimension);
   int (*init_state) (void * state, unsigned int dimension);
   int (*get) (void * state, unsigned int dimension, double x[]);
+  int (*get_block) (void * state, unsigned int dimension, size_t n, double x[]);
+  int (*skip_to) (void * state, unsigned int dimension, unsigned long int index);
+  int (*scramble) (void * state, unsigned int dimension, const struct gsl_rng_struct * r);
 }
 gsl_qrng_type;
 
@@ -55,6 +61,7 @@ GSL_VAR const gsl_qrng_type * gsl_qrng_niederreiter_2;
 GSL_VAR const gsl_qrng_type * gsl_qrng_sobol;
 GSL_VAR const gsl_qrng_type * gsl_qrng_halton;
 GSL_VAR const gsl_qrng_type * gsl_qrng_reversehalton;
+GSL_VAR const gsl_qrng_type * gsl_qrng_sobol_joe_kuo;
 
 
 /* Allocate and initialize a generator
@@ -93,6 +100,20 @@ size_t gsl_qrng_size (const gsl_qrng * q);
 void * gsl_qrng_state (const gsl_qrng * q);
 
 
+/* Fill x[] with the next n vectors, stored row by row. */
+int gsl_qrng_get_block (const gsl_qrng * q, size_t n, double x[]);
+
+
+/* Position the generator so that the next vector is the
+ * one with the given index, counting from zero.
+ */
+int gsl_qrng_skip_to (gsl_qrng * q, unsigned long int index);
+
+
+/* Randomize the sequence, for generators which support it. */
+int gsl_qrng_scramble (gsl_qrng * q, const struct gsl_rng_struct * r);
+
+
 /* Retrieve next vector in sequence. */
 INLINE_DECL int gsl_qrng_get (const gsl_qrng * q, double x[]);
 
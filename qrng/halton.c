@@ -39,7 +39,10 @@ static const gsl_qrng_type halton_type = {
   HALTON_MAX_DIMENSION,
   halton_state_size,
   halton_init,
-  halton_get
+  halton_get,
+  0,
+  0,
+  0
 };
 
 const gsl_qrng_type *gsl_qrng_halton = &halton_type;
@@ -37,7 +37,10 @@ static const gsl_qrng_type nied2_type =
   NIED2_MAX_DIMENSION,
   nied2_state_size,
   nied2_init,
-  nied2_get
+  nied2_get,
+  0,
+  0,
+  0
 };
 
 const gsl_qrng_type * gsl_qrng_niederreiter_2 = &nied2_type;
@@ -116,3 +116,71 @@ gsl_qrng_free (gsl_qrng * q)
   if(q->state != 0) free (q->state);
   free (q);
 }
+
+
+int
+gsl_qrng_get_block (const gsl_qrng * q, size_t n, double x[])
+{
+  size_t i;
+
+  if (q->type->get_block != 0)
+    {
+      return (q->type->get_block) (q->state, q->dimension, n, x);
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      int status = (q->type->get) (q->state, q->dimension, x + i * q->dimension);
+
+      if (status)
+        return status;
+    }
+
+  return GSL_SUCCESS;
+}
+
+
+int
+gsl_qrng_skip_to (gsl_qrng * q, unsigned long int index)
+{
+  double * x;
+  unsigned long int i;
+  int status = GSL_SUCCESS;
+
+  if (q->type->skip_to != 0)
+    {
+      return (q->type->skip_to) (q->state, q->dimension, index);
+    }
+
+  /* otherwise restart the sequence and step through it */
+
+  x = (double *) malloc (q->dimension * sizeof (double));
+
+  if (x == 0)
+    {
+      GSL_ERROR ("failed to allocate space for vector", GSL_ENOMEM);
+    }
+
+  (q->type->init_state) (q->state, q->dimension);
+
+  for (i = 0; i < index && status == GSL_SUCCESS; i++)
+    {
+      status = (q->type->get) (q->state, q->dimension, x);
+    }
+
+  free (x);
+
+  return status;
+}
+
+
+int
+gsl_qrng_scramble (gsl_qrng * q, const struct gsl_rng_struct * r)
+{
+  if (q->type->scramble == 0)
+    {
+      GSL_ERROR ("generator does not support scrambling", GSL_EUNIMPL);
+    }
+
+  return (q->type->scramble) (q->state, q->dimension, r);
+}
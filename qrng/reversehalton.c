@@ -41,7 +41,10 @@ static const gsl_qrng_type reversehalton_type = {
   REVERSEHALTON_MAX_DIMENSION,
   reversehalton_state_size,
   reversehalton_init,
-  reversehalton_get
+  reversehalton_get,
+  0,
+  0,
+  0
 };
 const gsl_qrng_type *gsl_qrng_reversehalton = &reversehalton_type;
 
@@ -19,6 +19,7 @@
 static size_t sobol_state_size(unsigned int dimension);
 static int sobol_init(void * state, unsigned int dimension);
 static int sobol_get(void * state, unsigned int dimension, double * v);
+static int sobol_skip_to(void * state, unsigned int dimension, unsigned long int index);
 
 /* global Sobol generator type object */
 static const gsl_qrng_type sobol_type = 
@@ -27,7 +28,10 @@ static const gsl_qrng_type sobol_type =
   SOBOL_MAX_DIMENSION,
   sobol_state_size,
   sobol_init,
-  sobol_get
+  sobol_get,
+  0,
+  sobol_skip_to,
+  0
 };
 const gsl_qrng_type * gsl_qrng_sobol = &sobol_type;
 
@@ -229,3 +233,34 @@ static int sobol_get(void * state, unsigned int dimension, double * v)
 
   return GSL_SUCCESS;
 }
+
+
+/* The numerator after n steps is the XOR of the direction numbers
+ * selected by the bits of the Gray code n ^ (n >> 1), so any point
+ * can be reached directly.
+ */
+static int sobol_skip_to(void * state, unsigned int dimension, unsigned long int index)
+{
+  sobol_state_t * s_state = (sobol_state_t *) state;
+  unsigned long int gray;
+  unsigned int i_dimension;
+  int k;
+
+  if(index >= (1UL << SOBOL_BIT_COUNT)) {
+    GSL_ERROR ("index out of range", GSL_EINVAL);
+  }
+
+  gray = index ^ (index >> 1);
+
+  for(i_dimension=0; i_dimension<dimension; i_dimension++) {
+    int numerator = 0;
+    for(k=0; k<SOBOL_BIT_COUNT; k++) {
+      if((gray >> k) & 1) numerator ^= s_state->v_direction[k][i_dimension];
+    }
+    s_state->last_numerator_vec[i_dimension] = numerator;
+  }
+
+  s_state->sequence_count = index;
+
+  return GSL_SUCCESS;
+}
@@ -0,0 +1,365 @@
+/* qrng/sobol_joe_kuo.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Sobol sequence with the direction numbers of Joe and Kuo (SIAM J
+   Sci Comput 30, 2635--2654 (2008)), which cover many more dimensions
+   than the Bratley-Fox tables used by gsl_qrng_sobol and have better
+   two-dimensional projections.
+
+   The points are generated in Gray code order (Antonov and Saleev),
+   with 32-bit direction numbers held in unsigned long ints.  As in
+   the reference implementation of Joe and Kuo the sequence starts with
+   point 0, the origin, so that the first 2^m points form a complete
+   net.  The numerator of each coordinate of point n is the XOR of the
+   direction numbers selected by the bits of n ^ (n >> 1), so skipping
+   to any index takes O(32) operations per dimension.
+
+   Scrambling applies a random lower triangular binary matrix to the
+   direction numbers of each dimension followed by a random digital
+   shift (Matousek, J Complexity 14, 527--556 (1998)).  The scrambled
+   points keep the net properties of the sequence and are uniformly
+   distributed over the unit cube.
+
+   The state is an array of unsigned long ints: the index of the next
+   point, then for each dimension the digital shift, the numerator of
+   the next point and the 32 direction numbers.  It contains no
+   pointers, so gsl_qrng_memcpy and gsl_qrng_clone can copy it
+   directly. */
+
+#include <config.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_qrng.h>
+
+#include "sobol_joe_kuo_data.c"
+
+#define SOBOL_JK_MAX_DIMENSION \
+  (1 + sizeof (sobol_jk_poly) / sizeof (sobol_jk_poly[0]))
+
+#define SOBOL_JK_BIT_COUNT 32
+#define SOBOL_JK_MASK 0xffffffffUL
+
+static size_t sobol_jk_state_size (unsigned int dimension);
+static int sobol_jk_init (void *state, unsigned int dimension);
+static int sobol_jk_get (void *state, unsigned int dimension, double *v);
+static int sobol_jk_get_block (void *state, unsigned int dimension,
+                               size_t n, double *v);
+static int sobol_jk_skip_to (void *state, unsigned int dimension,
+                             unsigned long int index);
+static int sobol_jk_scramble (void *state, unsigned int dimension,
+                              const gsl_rng * r);
+
+static const gsl_qrng_type sobol_jk_type = {
+  "sobol-joe-kuo",
+  SOBOL_JK_MAX_DIMENSION,
+  sobol_jk_state_size,
+  sobol_jk_init,
+  sobol_jk_get,
+  sobol_jk_get_block,
+  sobol_jk_skip_to,
+  sobol_jk_scramble
+};
+
+const gsl_qrng_type *gsl_qrng_sobol_joe_kuo = &sobol_jk_type;
+
+/* 2^-32 */
+static const double sobol_jk_scale = 1.0 / 4294967296.0;
+
+/* layout of the state array */
+#define JK_COUNT(s)      ((s)[0])
+#define JK_SHIFT(s, d)   ((s) + 1)
+#define JK_X(s, d)       ((s) + 1 + (d))
+#define JK_V(s, d)       ((s) + 1 + 2 * (d))   /* V[k * d + i] */
+
+static size_t
+sobol_jk_state_size (unsigned int dimension)
+{
+  return (1 + (2 + SOBOL_JK_BIT_COUNT) * (size_t) dimension)
+    * sizeof (unsigned long int);
+}
+
+static int
+sobol_jk_init (void *state, unsigned int dimension)
+{
+  unsigned long int *s = (unsigned long int *) state;
+  unsigned long int *V = JK_V (s, dimension);
+  const unsigned long int *m = sobol_jk_minit;
+  unsigned int i;
+  int k, j;
+
+  if (dimension < 1 || dimension > SOBOL_JK_MAX_DIMENSION)
+    {
+      return GSL_EINVAL;
+    }
+
+  /* the first dimension is the van der Corput sequence */
+
+  for (k = 0; k < SOBOL_JK_BIT_COUNT; k++)
+    {
+      V[k * dimension] = 1UL << (SOBOL_JK_BIT_COUNT - 1 - k);
+    }
+
+  for (i = 1; i < dimension; i++)
+    {
+      const unsigned long int poly = sobol_jk_poly[i - 1];
+      int deg = 0;
+
+      while ((poly >> (deg + 1)) != 0)
+        deg++;
+
+      /* V_k = m_k 2^(32-k) for k <= deg, then the recurrence
+         V_k = a_1 V_{k-1} ^ ... ^ a_{deg-1} V_{k-deg+1}
+               ^ V_{k-deg} ^ (V_{k-deg} >> deg) */
+
+      for (k = 0; k < deg && k < SOBOL_JK_BIT_COUNT; k++)
+        {
+          V[k * dimension + i] =
+            ((unsigned long int) m[k]) << (SOBOL_JK_BIT_COUNT - 1 - k);
+        }
+
+      for (k = deg; k < SOBOL_JK_BIT_COUNT; k++)
+        {
+          unsigned long int v = V[(k - deg) * dimension + i];
+
+          v ^= v >> deg;
+
+          for (j = 1; j < deg; j++)
+            {
+              if ((poly >> (deg - j)) & 1)
+                v ^= V[(k - j) * dimension + i];
+            }
+
+          V[k * dimension + i] = v;
+        }
+
+      m += deg;
+    }
+
+  for (i = 0; i < dimension; i++)
+    {
+      JK_SHIFT (s, dimension)[i] = 0;
+      JK_X (s, dimension)[i] = 0;
+    }
+
+  JK_COUNT (s) = 0;
+
+  return GSL_SUCCESS;
+}
+
+/* index of the lowest zero bit of c */
+static int
+lowest_zero_bit (unsigned long int c)
+{
+  int k = 0;
+
+  while (c & 1)
+    {
+      c >>= 1;
+      k++;
+    }
+
+  return k;
+}
+
+static int
+sobol_jk_get (void *state, unsigned int dimension, double *v)
+{
+  unsigned long int *s = (unsigned long int *) state;
+  unsigned long int *x = JK_X (s, dimension);
+  const int k = lowest_zero_bit (JK_COUNT (s));
+  const unsigned long int *Vk;
+  unsigned int i;
+
+  /* sequence exhausted after 2^32 - 1 points */
+  if (k >= SOBOL_JK_BIT_COUNT)
+    return GSL_EFAILED;
+
+  Vk = JK_V (s, dimension) + k * dimension;
+
+  for (i = 0; i < dimension; i++)
+    {
+      v[i] = x[i] * sobol_jk_scale;
+      x[i] ^= Vk[i];
+    }
+
+  JK_COUNT (s)++;
+
+  return GSL_SUCCESS;
+}
+
+static int
+sobol_jk_get_block (void *state, unsigned int dimension, size_t n, double *v)
+{
+  unsigned long int *s = (unsigned long int *) state;
+  unsigned long int *x = JK_X (s, dimension);
+  const unsigned long int *V = JK_V (s, dimension);
+  unsigned long int c = JK_COUNT (s);
+  size_t j;
+  unsigned int i;
+
+  for (j = 0; j < n; j++)
+    {
+      const int k = lowest_zero_bit (c);
+      double *vj = v + j * dimension;
+      const unsigned long int *Vk;
+
+      if (k >= SOBOL_JK_BIT_COUNT)
+        {
+          JK_COUNT (s) = c;
+          return GSL_EFAILED;
+        }
+
+      Vk = V + k * dimension;
+
+      for (i = 0; i < dimension; i++)
+        {
+          vj[i] = x[i] * sobol_jk_scale;
+          x[i] ^= Vk[i];
+        }
+
+      c++;
+    }
+
+  JK_COUNT (s) = c;
+
+  return GSL_SUCCESS;
+}
+
+static int
+sobol_jk_skip_to (void *state, unsigned int dimension, unsigned long int index)
+{
+  unsigned long int *s = (unsigned long int *) state;
+  const unsigned long int *shift = JK_SHIFT (s, dimension);
+  unsigned long int *x = JK_X (s, dimension);
+  const unsigned long int *V = JK_V (s, dimension);
+  unsigned long int gray;
+  unsigned int i;
+  int k;
+
+  /* the shift is split so that it is defined for 32-bit longs */
+  if (((index >> 16) >> 16) != 0)
+    {
+      GSL_ERROR ("index out of range", GSL_EINVAL);
+    }
+
+  gray = index ^ (index >> 1);
+
+  for (i = 0; i < dimension; i++)
+    {
+      x[i] = shift[i];
+    }
+
+  for (k = 0; k < SOBOL_JK_BIT_COUNT; k++)
+    {
+      if ((gray >> k) & 1)
+        {
+          const unsigned long int *Vk = V + k * dimension;
+
+          for (i = 0; i < dimension; i++)
+            x[i] ^= Vk[i];
+        }
+    }
+
+  JK_COUNT (s) = index;
+
+  return GSL_SUCCESS;
+}
+
+/* 32 random bits, built a byte at a time so that any generator can be
+   used whatever its range */
+static unsigned long int
+random_word (const gsl_rng * r)
+{
+  unsigned long int w = 0;
+  int b;
+
+  for (b = 0; b < 4; b++)
+    {
+      w = (w << 8) | gsl_rng_uniform_int (r, 256);
+    }
+
+  return w;
+}
+
+static unsigned long int
+parity (unsigned long int w)
+{
+  w ^= w >> 16;
+  w ^= w >> 8;
+  w ^= w >> 4;
+  w ^= w >> 2;
+  w ^= w >> 1;
+
+  return w & 1;
+}
+
+static int
+sobol_jk_scramble (void *state, unsigned int dimension, const gsl_rng * r)
+{
+  unsigned long int *s = (unsigned long int *) state;
+  unsigned long int *shift = JK_SHIFT (s, dimension);
+  unsigned long int *x = JK_X (s, dimension);
+  unsigned long int *V = JK_V (s, dimension);
+  unsigned long int L[SOBOL_JK_BIT_COUNT];
+  unsigned int i;
+  int k, b;
+
+  /* start from the unscrambled direction numbers, so scrambling twice
+     does not compound */
+
+  int status = sobol_jk_init (state, dimension);
+
+  if (status)
+    return status;
+
+  for (i = 0; i < dimension; i++)
+    {
+      /* Row b of L gives output bit b (counting from the least
+         significant end) as the parity of the masked input.  The
+         diagonal is one and the entries above it, for the more
+         significant input bits, are random, so the matrix is lower
+         triangular in digit order and nonsingular. */
+
+      for (b = 0; b < SOBOL_JK_BIT_COUNT; b++)
+        {
+          const unsigned long int above =
+            (b == SOBOL_JK_BIT_COUNT - 1) ? 0 : (SOBOL_JK_MASK << (b + 1)) & SOBOL_JK_MASK;
+
+          L[b] = (1UL << b) | (random_word (r) & above);
+        }
+
+      for (k = 0; k < SOBOL_JK_BIT_COUNT; k++)
+        {
+          const unsigned long int v = V[k * dimension + i];
+          unsigned long int y = 0;
+
+          for (b = 0; b < SOBOL_JK_BIT_COUNT; b++)
+            {
+              y |= parity (L[b] & v) << b;
+            }
+
+          V[k * dimension + i] = y;
+        }
+
+      shift[i] = random_word (r);
+      x[i] = shift[i];
+    }
+
+  return GSL_SUCCESS;
+}
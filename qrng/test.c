@@ -4,6 +4,7 @@
 #include <stdlib.h>
 #include <gsl/gsl_ieee_utils.h>
 
+#include <gsl/gsl_rng.h>
 #include <gsl/gsl_qrng.h>
 #include <gsl/gsl_test.h>
 #include <math.h>
@@ -232,6 +233,133 @@ void test_nied2(void)
   gsl_test (status, "Niederreiter d=3 (reinitialized)");
 }
 
+/* each coordinate of the first 2^m points of a Sobol sequence, scrambled
+   or not, falls exactly once in each interval [k/2^m, (k+1)/2^m) */
+int check_stratified(gsl_qrng * g, unsigned int m)
+{
+  const unsigned int d = g->dimension;
+  const size_t n = (size_t) 1 << m;
+  double * x = (double *) malloc(n * d * sizeof(double));
+  char * seen = (char *) malloc(n);
+  unsigned int i;
+  size_t j;
+  int status = 0;
+
+  gsl_qrng_skip_to(g, 0);
+  gsl_qrng_get_block(g, n, x);
+
+  for(i=0; i<d; i++) {
+    for(j=0; j<n; j++) seen[j] = 0;
+    for(j=0; j<n; j++) {
+      const double v = x[j * d + i];
+      const size_t bin = (size_t) (v * n);
+      if(v < 0.0 || v >= 1.0 || seen[bin]) status = 1;
+      else seen[bin] = 1;
+    }
+  }
+
+  free(seen);
+  free(x);
+
+  return status;
+}
+
+void test_sobol_joe_kuo(void)
+{
+  int status = 0;
+  double v[100];
+  unsigned int dmax = gsl_qrng_sobol_joe_kuo->max_dimension;
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+
+  /* test in dimension 3, starting from the origin */
+  gsl_qrng * g = gsl_qrng_alloc(gsl_qrng_sobol_joe_kuo, 3);
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.0 || v[1] != 0.0 || v[2] != 0.0 );
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.5 || v[1] != 0.5 || v[2] != 0.5 );
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.75 || v[1] != 0.25 || v[2] != 0.25 );
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.25 || v[1] != 0.75 || v[2] != 0.75 );
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.375 || v[1] != 0.375 || v[2] != 0.625 );
+
+  gsl_test (status, "Sobol Joe-Kuo d=3");
+
+  status = 0;
+  gsl_qrng_skip_to(g, 3);
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.25 || v[1] != 0.75 || v[2] != 0.75 );
+  gsl_qrng_free(g);
+
+  gsl_test (status, "Sobol Joe-Kuo d=3 (skip)");
+
+  gsl_test (dmax != 21201, "Sobol Joe-Kuo max dimension %u", dmax);
+
+  /* dimensions beyond the first 3667 use polynomials of degree > 15
+     and initial direction numbers of more than 16 bits */
+  g = gsl_qrng_alloc(gsl_qrng_sobol_joe_kuo, 3668);
+  gsl_test (g == 0 || check_stratified(g, 10),
+            "Sobol Joe-Kuo d=3668 stratified");
+  gsl_qrng_free(g);
+
+  g = gsl_qrng_alloc(gsl_qrng_sobol_joe_kuo, dmax);
+  gsl_test (g == 0 || check_stratified(g, 6),
+            "Sobol Joe-Kuo d=%u stratified", dmax);
+  gsl_qrng_free(g);
+
+  g = gsl_qrng_alloc(gsl_qrng_sobol_joe_kuo, 100);
+  gsl_qrng_scramble(g, r);
+  gsl_test (check_stratified(g, 12), "Sobol Joe-Kuo d=100 scrambled stratified");
+
+  gsl_qrng_skip_to(g, 0);
+  gsl_qrng_get(g, v);
+  status = ( v[0] == 0.0 && v[1] == 0.0 && v[2] == 0.0 );
+  gsl_test (status, "Sobol Joe-Kuo d=100 scrambled origin moved");
+  gsl_qrng_free(g);
+
+  gsl_rng_free(r);
+}
+
+/* gsl_qrng_get_block and gsl_qrng_skip_to must agree with calls to
+   gsl_qrng_get */
+void test_block(const gsl_qrng_type * T, unsigned int d)
+{
+  const size_t n = 1000, k = 357;
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  gsl_qrng * g = gsl_qrng_alloc(T, d);
+  gsl_qrng * h;
+  double * x = (double *) malloc(n * d * sizeof(double));
+  double * y = (double *) malloc(n * d * sizeof(double));
+  size_t i;
+  int status = 0;
+
+  if(T->scramble != 0) gsl_qrng_scramble(g, r);
+
+  h = gsl_qrng_clone(g);
+
+  for(i=0; i<n; i++) gsl_qrng_get(g, x + i * d);
+  gsl_qrng_get_block(h, n, y);
+
+  for(i=0; i<n*d; i++) status |= (x[i] != y[i]);
+
+  gsl_test (status, "%s d=%u get_block", gsl_qrng_name(g), d);
+
+  status = 0;
+  gsl_qrng_skip_to(h, k);
+  gsl_qrng_get_block(h, n - k, y);
+
+  for(i=0; i<(n-k)*d; i++) status |= (x[k * d + i] != y[i]);
+
+  gsl_test (status, "%s d=%u skip_to", gsl_qrng_name(g), d);
+
+  free(y);
+  free(x);
+  gsl_qrng_free(h);
+  gsl_qrng_free(g);
+  gsl_rng_free(r);
+}
+
 
 int main()
 {
@@ -242,6 +370,13 @@ int main()
 	test_halton();
 	test_reversehalton();
   test_nied2();
+  test_sobol_joe_kuo();
+
+  test_block(gsl_qrng_sobol, 5);
+  test_block(gsl_qrng_niederreiter_2, 5);
+  test_block(gsl_qrng_halton, 5);
+  test_block(gsl_qrng_sobol_joe_kuo, 5);
+  test_block(gsl_qrng_sobol_joe_kuo, 1000);
 
   exit (gsl_test_summary ());
 }
@@ -0,0 +1,159 @@
+/* randist/benchmark.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Compare the speed of the single variate samplers with the bulk
+   versions, in samples per second, for the generator given by
+   GSL_RNG_TYPE (default mt19937). */
+
+#include <config.h>
+#include <time.h>
+#include <stdio.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+
+#define N  100000
+#define NBUF 4096
+
+double dsum;
+double buf[NBUF];
+
+static gsl_rng *r;
+
+static double
+single_gaussian (void)
+{
+  return gsl_ran_gaussian_ziggurat (r, 1.0);
+}
+
+static void
+fill_gaussian (double x[], size_t n)
+{
+  gsl_ran_gaussian_fill (r, 1.0, x, n);
+}
+
+static double
+single_exponential (void)
+{
+  return gsl_ran_exponential (r, 1.0);
+}
+
+static void
+fill_exponential (double x[], size_t n)
+{
+  gsl_ran_exponential_fill (r, 1.0, x, n);
+}
+
+static double
+single_flat (void)
+{
+  return gsl_ran_flat (r, -1.0, 1.0);
+}
+
+static void
+fill_flat (double x[], size_t n)
+{
+  gsl_ran_flat_fill (r, -1.0, 1.0, x, n);
+}
+
+static double
+single_gamma (void)
+{
+  return gsl_ran_gamma (r, 2.5, 1.0);
+}
+
+static void
+fill_gamma (double x[], size_t n)
+{
+  gsl_ran_gamma_fill (r, 2.5, 1.0, x, n);
+}
+
+static double
+single_gamma_small (void)
+{
+  return gsl_ran_gamma (r, 0.5, 1.0);
+}
+
+static void
+fill_gamma_small (double x[], size_t n)
+{
+  gsl_ran_gamma_fill (r, 0.5, 1.0, x, n);
+}
+
+void benchmark (double (*single) (void), void (*fill) (double x[], size_t n),
+                const char *name);
+
+int
+main (void)
+{
+  gsl_rng_env_setup ();
+  r = gsl_rng_alloc (gsl_rng_default);
+
+  printf ("generator %s\n", gsl_rng_name (r));
+
+  benchmark (&single_gaussian, &fill_gaussian, "gaussian (ziggurat)");
+  benchmark (&single_exponential, &fill_exponential, "exponential");
+  benchmark (&single_flat, &fill_flat, "flat");
+  benchmark (&single_gamma, &fill_gamma, "gamma, a = 2.5");
+  benchmark (&single_gamma_small, &fill_gamma_small, "gamma, a = 0.5");
+
+  gsl_rng_free (r);
+
+  return 0;
+}
+
+void
+benchmark (double (*single) (void), void (*fill) (double x[], size_t n),
+           const char *name)
+{
+  clock_t start, end;
+  long int s = 0, b = 0;
+  double t1, t2;
+
+  start = clock ();
+  do
+    {
+      int j;
+      for (j = 0; j < N; j++)
+        dsum += single ();
+
+      s += N;
+      end = clock ();
+    }
+  while (end < start + CLOCKS_PER_SEC/10);
+
+  t1 = (end - start) / (double) CLOCKS_PER_SEC;
+
+  start = clock ();
+  do
+    {
+      int j;
+      fill (buf, NBUF);
+      for (j = 0; j < NBUF; j++)
+        dsum += buf[j];
+
+      b += NBUF;
+      end = clock ();
+    }
+  while (end < start + CLOCKS_PER_SEC/10);
+
+  t2 = (end - start) / (double) CLOCKS_PER_SEC;
+
+  printf ("%8.0f k samples/sec, %8.0f k samples/sec (fill), %s\n",
+          s / t1 / 1000.0, b / t2 / 1000.0, name);
+}
@@ -18,7 +18,9 @@
  */
 
 #include <config.h>
+#include <stdlib.h>
 #include <math.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
 #include <gsl/gsl_pow_int.h>
@@ -87,37 +89,110 @@ Stirling (double y1)
   return s;
 }
 
-unsigned int
-gsl_ran_binomial_tpe (const gsl_rng * rng, double p, unsigned int n)
-{
-  return gsl_ran_binomial (rng, p, n);
-}
+/* The setup constants depend only on p and n, so they are computed
+   once by binomial_init and kept in a gsl_ran_binomial_workspace.
+   gsl_ran_binomial uses a workspace on the stack, which gives exactly
+   the same variates as a cached workspace for the same p and n. */
 
-unsigned int
-gsl_ran_binomial (const gsl_rng * rng, double p, unsigned int n)
+static void
+binomial_init (gsl_ran_binomial_workspace * w, double p, unsigned int n)
 {
-  int ix;                       /* return value */
-  int flipped = 0;
-  double q, s, np;
-
-  if (n == 0)
-    return 0;
+  w->n = n;
+  w->flipped = 0;
 
   if (p > 0.5)
     {
       p = 1.0 - p;              /* work with small p */
-      flipped = 1;
+      w->flipped = 1;
     }
 
-  q = 1 - p;
-  s = p / q;
-  np = n * p;
+  w->p = p;
+  w->q = 1 - p;
+  w->s = p / w->q;
+  w->np = n * p;
+
+  if (n == 0)
+    return;
+
+  if (w->np < SMALL_MEAN)
+    {
+      w->f0 = gsl_pow_uint (w->q, n);   /* f(x), starting with x=0 */
+    }
+  else
+    {
+      /* Compute the constants for the BTPE algorithm */
+
+      const double q = w->q;
+      const double np = w->np;
+
+      double ffm = np + p;      /* ffm = n*p+p             */
+      int m = (int) ffm;        /* m = int floor[n*p+p]    */
+      double fm = m;            /* fm = double m;          */
+      double xm = fm + 0.5;     /* xm = half integer mean (tip of triangle)  */
+      double npq = np * q;      /* npq = n*p*q            */
+
+      /* Compute cumulative area of tri, para, exp tails */
+
+      /* p1: radius of triangle region; since height=1, also: area of region */
+      /* p2: p1 + area of parallelogram region */
+      /* p3: p2 + area of left tail */
+      /* p4: p3 + area of right tail */
+      /* pi/p4: probability of i'th area (i=1,2,3,4) */
+
+      /* Note: magic numbers 2.195, 4.6, 0.134, 20.5, 15.3 */
+      /* These magic numbers are not adjustable...at least not easily! */
+
+      double p1 = floor (2.195 * sqrt (npq) - 4.6 * q) + 0.5;
+
+      /* xl, xr: left and right edges of triangle */
+      double xl = xm - p1;
+      double xr = xm + p1;
+
+      /* Parameter of exponential tails */
+      /* Left tail:  t(x) = c*exp(-lambda_l*[xl - (x+0.5)]) */
+      /* Right tail: t(x) = c*exp(-lambda_r*[(x+0.5) - xr]) */
+
+      double c = 0.134 + 20.5 / (15.3 + fm);
+      double p2 = p1 * (1.0 + c + c);
+
+      double al = (ffm - xl) / (ffm - xl * p);
+      double lambda_l = al * (1.0 + 0.5 * al);
+      double ar = (xr - ffm) / (xr * q);
+      double lambda_r = ar * (1.0 + 0.5 * ar);
+      double p3 = p2 + c / lambda_l;
+      double p4 = p3 + c / lambda_r;
+
+      w->m = m;
+      w->fm = fm;
+      w->xm = xm;
+      w->npq = npq;
+      w->p1 = p1;
+      w->xl = xl;
+      w->xr = xr;
+      w->c = c;
+      w->p2 = p2;
+      w->lambda_l = lambda_l;
+      w->lambda_r = lambda_r;
+      w->p3 = p3;
+      w->p4 = p4;
+    }
+}
+
+static unsigned int
+binomial_draw (const gsl_rng * rng, const gsl_ran_binomial_workspace * w)
+{
+  int ix;                       /* return value */
+  const unsigned int n = w->n;
+  const double p = w->p, q = w->q, s = w->s;
+
+  if (n == 0)
+    return 0;
 
   /* Inverse cdf logic for small mean (BINV in K+S) */
 
-  if (np < SMALL_MEAN)
+  if (w->np < SMALL_MEAN)
     {
-      double f0 = gsl_pow_uint (q, n);   /* f(x), starting with x=0 */
+      const double f0 = w->f0;
 
       while (1)
         {
@@ -168,42 +243,11 @@ gsl_ran_binomial (const gsl_rng * rng, double p, unsigned int n)
 
       int k;
 
-      double ffm = np + p;      /* ffm = n*p+p             */
-      int m = (int) ffm;        /* m = int floor[n*p+p]    */
-      double fm = m;            /* fm = double m;          */
-      double xm = fm + 0.5;     /* xm = half integer mean (tip of triangle)  */
-      double npq = np * q;      /* npq = n*p*q            */
-
-      /* Compute cumulative area of tri, para, exp tails */
-
-      /* p1: radius of triangle region; since height=1, also: area of region */
-      /* p2: p1 + area of parallelogram region */
-      /* p3: p2 + area of left tail */
-      /* p4: p3 + area of right tail */
-      /* pi/p4: probability of i'th area (i=1,2,3,4) */
-
-      /* Note: magic numbers 2.195, 4.6, 0.134, 20.5, 15.3 */
-      /* These magic numbers are not adjustable...at least not easily! */
-
-      double p1 = floor (2.195 * sqrt (npq) - 4.6 * q) + 0.5;
-
-      /* xl, xr: left and right edges of triangle */
-      double xl = xm - p1;
-      double xr = xm + p1;
-
-      /* Parameter of exponential tails */
-      /* Left tail:  t(x) = c*exp(-lambda_l*[xl - (x+0.5)]) */
-      /* Right tail: t(x) = c*exp(-lambda_r*[(x+0.5) - xr]) */
-
-      double c = 0.134 + 20.5 / (15.3 + fm);
-      double p2 = p1 * (1.0 + c + c);
-
-      double al = (ffm - xl) / (ffm - xl * p);
-      double lambda_l = al * (1.0 + 0.5 * al);
-      double ar = (xr - ffm) / (xr * q);
-      double lambda_r = ar * (1.0 + 0.5 * ar);
-      double p3 = p2 + c / lambda_l;
-      double p4 = p3 + c / lambda_r;
+      const int m = w->m;
+      const double fm = w->fm, xm = w->xm, npq = w->npq;
+      const double p1 = w->p1, xl = w->xl, xr = w->xr, c = w->c;
+      const double p2 = w->p2, p3 = w->p3, p4 = w->p4;
+      const double lambda_l = w->lambda_l, lambda_r = w->lambda_r;
 
       double var, accept;
       double u, v;              /* random variates */
@@ -377,5 +421,81 @@ gsl_ran_binomial (const gsl_rng * rng, double p, unsigned int n)
 
 Finish:
 
-  return (flipped) ? (n - ix) : (unsigned int)ix;
+  return (w->flipped) ? (n - ix) : (unsigned int)ix;
+}
+
+unsigned int
+gsl_ran_binomial_tpe (const gsl_rng * rng, double p, unsigned int n)
+{
+  return gsl_ran_binomial (rng, p, n);
+}
+
+unsigned int
+gsl_ran_binomial (const gsl_rng * rng, double p, unsigned int n)
+{
+  gsl_ran_binomial_workspace w;
+
+  binomial_init (&w, p, n);
+
+  return binomial_draw (rng, &w);
+}
+
+gsl_ran_binomial_workspace *
+gsl_ran_binomial_alloc (double p, unsigned int n)
+{
+  gsl_ran_binomial_workspace *w;
+
+  if (!(p >= 0.0 && p <= 1.0))
+    {
+      GSL_ERROR_NULL ("p must be in the range [0,1]", GSL_EDOM);
+    }
+
+  w = (gsl_ran_binomial_workspace *) malloc (sizeof (gsl_ran_binomial_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  binomial_init (w, p, n);
+
+  return w;
+}
+
+int
+gsl_ran_binomial_set (gsl_ran_binomial_workspace * w, double p, unsigned int n)
+{
+  if (!(p >= 0.0 && p <= 1.0))
+    {
+      GSL_ERROR ("p must be in the range [0,1]", GSL_EDOM);
+    }
+
+  binomial_init (w, p, n);
+
+  return GSL_SUCCESS;
+}
+
+void
+gsl_ran_binomial_free (gsl_ran_binomial_workspace * w)
+{
+  RETURN_IF_NULL (w);
+  free (w);
+}
+
+unsigned int
+gsl_ran_binomial_sample (const gsl_rng * rng, const gsl_ran_binomial_workspace * w)
+{
+  return binomial_draw (rng, w);
+}
+
+void
+gsl_ran_binomial_fill (const gsl_rng * rng, const gsl_ran_binomial_workspace * w,
+                       unsigned int x[], const size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      x[i] = binomial_draw (rng, w);
+    }
 }
@@ -0,0 +1,237 @@
+/* randist/discrete_dynamic.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Discrete distribution with weights that can be changed after the
+   table has been built.  The Walker tables used by gsl_ran_discrete
+   have to be rebuilt from scratch, at O(K) cost, whenever a single
+   weight changes.  Here the weights are kept at the leaves of a
+   complete binary tree in which every internal node holds the sum of
+   its two children, as in the partial sum trees of Wong and Easton
+   (An efficient method for weighted sampling without replacement,
+   SIAM J Comput 9, 111--113 (1980)).
+
+   The tree is stored implicitly in an array of length 2K: node i has
+   children 2i and 2i+1, and the leaf for event k is node K+k.  Node 1
+   is the root and holds the total weight.  A sample takes one uniform
+   deviate and a descent from the root, and changing a weight updates
+   the sums on the path back up, so both are O(log K).  The internal
+   sums are recomputed from their children rather than adjusted by the
+   change in weight, so rounding errors do not accumulate however many
+   updates are made.  */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+
+static void
+dynamic_build (gsl_ran_discrete_dynamic_t * g)
+{
+  const size_t K = g->K;
+  double *t = g->tree;
+  size_t i;
+
+  for (i = K - 1; i > 0; i--)
+    {
+      t[i] = t[2 * i] + t[2 * i + 1];
+    }
+}
+
+gsl_ran_discrete_dynamic_t *
+gsl_ran_discrete_dynamic_alloc (size_t K, const double *P)
+{
+  gsl_ran_discrete_dynamic_t *g;
+  size_t k;
+
+  if (K == 0)
+    {
+      GSL_ERROR_VAL ("number of events must be positive integer",
+                     GSL_EINVAL, 0);
+    }
+
+  if (P != NULL)
+    {
+      for (k = 0; k < K; k++)
+        {
+          if (!(P[k] >= 0.0) || !gsl_finite (P[k]))
+            {
+              GSL_ERROR_VAL ("probabilities must be non-negative and finite",
+                             GSL_EINVAL, 0);
+            }
+        }
+    }
+
+  g = (gsl_ran_discrete_dynamic_t *) malloc (sizeof (gsl_ran_discrete_dynamic_t));
+
+  if (g == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
+    }
+
+  g->K = K;
+  g->tree = (double *) malloc (2 * K * sizeof (double));
+
+  if (g->tree == 0)
+    {
+      free (g);
+      GSL_ERROR_VAL ("failed to allocate tree", GSL_ENOMEM, 0);
+    }
+
+  g->tree[0] = 0.0;             /* unused */
+
+  for (k = 0; k < K; k++)
+    {
+      g->tree[K + k] = (P != NULL) ? P[k] : 0.0;
+    }
+
+  dynamic_build (g);
+
+  return g;
+}
+
+void
+gsl_ran_discrete_dynamic_free (gsl_ran_discrete_dynamic_t * g)
+{
+  RETURN_IF_NULL (g);
+  free (g->tree);
+  free (g);
+}
+
+int
+gsl_ran_discrete_dynamic_set (gsl_ran_discrete_dynamic_t * g, size_t k,
+                              double weight)
+{
+  double *t = g->tree;
+  size_t i;
+
+  if (k >= g->K)
+    {
+      GSL_ERROR ("index k out of range", GSL_EINVAL);
+    }
+
+  if (!(weight >= 0.0) || !gsl_finite (weight))
+    {
+      GSL_ERROR ("weight must be non-negative and finite", GSL_EINVAL);
+    }
+
+  i = g->K + k;
+  t[i] = weight;
+
+  for (i /= 2; i > 0; i /= 2)
+    {
+      t[i] = t[2 * i] + t[2 * i + 1];
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_ran_discrete_dynamic_set_all (gsl_ran_discrete_dynamic_t * g,
+                                  const double *P)
+{
+  const size_t K = g->K;
+  size_t k;
+
+  for (k = 0; k < K; k++)
+    {
+      if (!(P[k] >= 0.0) || !gsl_finite (P[k]))
+        {
+          GSL_ERROR ("probabilities must be non-negative and finite",
+                     GSL_EINVAL);
+        }
+    }
+
+  for (k = 0; k < K; k++)
+    {
+      g->tree[K + k] = P[k];
+    }
+
+  dynamic_build (g);
+
+  return GSL_SUCCESS;
+}
+
+double
+gsl_ran_discrete_dynamic_get (const gsl_ran_discrete_dynamic_t * g, size_t k)
+{
+  if (k >= g->K)
+    {
+      GSL_ERROR_VAL ("index k out of range", GSL_EINVAL, 0.0);
+    }
+
+  return g->tree[g->K + k];
+}
+
+double
+gsl_ran_discrete_dynamic_total (const gsl_ran_discrete_dynamic_t * g)
+{
+  /* for K = 1 the root is also the only leaf */
+  return g->tree[1];
+}
+
+size_t
+gsl_ran_discrete_dynamic (const gsl_rng * r,
+                          const gsl_ran_discrete_dynamic_t * g)
+{
+  const size_t K = g->K;
+  const double *t = g->tree;
+  double u;
+  size_t i = 1;
+
+  if (t[1] == 0.0)
+    {
+      GSL_ERROR_VAL ("total weight is zero", GSL_EDOM, 0);
+    }
+
+  u = gsl_rng_uniform (r) * t[1];
+
+  while (i < K)
+    {
+      const double left = t[2 * i];
+
+      /* Rounding in the sums can leave u just above the weight of the
+         left subtree when the right subtree is empty, so an empty
+         subtree is never entered. */
+
+      if (u < left || t[2 * i + 1] == 0.0)
+        {
+          i = 2 * i;
+        }
+      else
+        {
+          u -= left;
+          i = 2 * i + 1;
+        }
+    }
+
+  return i - K;
+}
+
+double
+gsl_ran_discrete_dynamic_pdf (size_t k, const gsl_ran_discrete_dynamic_t * g)
+{
+  if (k >= g->K || g->tree[1] == 0.0)
+    {
+      return 0.0;
+    }
+
+  return g->tree[g->K + k] / g->tree[1];
+}
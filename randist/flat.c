@@ -39,6 +39,18 @@ gsl_ran_flat (const gsl_rng * r, const double a, const double b)
   return a * (1 - u) + b * u;
 }
 
+void
+gsl_ran_flat_fill (const gsl_rng * r, const double a, const double b,
+                   double x[], const size_t n)
+{
+  size_t i;
+
+  gsl_rng_uniform_fill (r, x, n);
+
+  for (i = 0; i < n; i++)
+    x[i] = a * (1 - x[i]) + b * x[i];
+}
+
 double
 gsl_ran_flat_pdf (double x, const double a, const double b)
 {
@@ -227,3 +227,90 @@ gsl_ran_gamma (const gsl_rng * r, const double a, const double b)
     return b * d * v;
   }
 }
+
+/* Bulk version of the Marsaglia-Tsang method.  The normal and uniform
+   deviates for a block of trials are generated together, and the
+   squeeze test, which accepts about 98% of the trials for a >= 1, is
+   applied over the whole block.  Trials which fail the squeeze are
+   completed afterwards with the logarithmic test, and rejected trials
+   are replaced by a fresh call to gsl_ran_gamma. */
+
+#define GAMMA_BLOCK 256
+
+void
+gsl_ran_gamma_fill (const gsl_rng * r, const double a, const double b,
+                    double x[], const size_t n)
+{
+  double g[GAMMA_BLOCK], u[GAMMA_BLOCK];
+  size_t i, done = 0;
+
+  if (a < 1)
+    {
+      const double ainv = 1.0 / a;
+
+      gsl_ran_gamma_fill (r, 1.0 + a, b, x, n);
+
+      while (done < n)
+        {
+          const size_t m = (n - done < GAMMA_BLOCK) ? n - done : GAMMA_BLOCK;
+
+          gsl_rng_uniform_fill (r, u, m);
+
+          for (i = 0; i < m; i++)
+            {
+              const double ui = (u[i] > 0) ? u[i] : gsl_rng_uniform_pos (r);
+              x[done + i] *= pow (ui, ainv);
+            }
+
+          done += m;
+        }
+
+      return;
+    }
+
+  {
+    const double d = a - 1.0 / 3.0;
+    const double c = (1.0 / 3.0) / sqrt (d);
+
+    while (done < n)
+      {
+        const size_t m = (n - done < GAMMA_BLOCK) ? n - done : GAMMA_BLOCK;
+        double *const y = x + done;
+        size_t nslow = 0;
+
+        gsl_ran_gaussian_fill (r, 1.0, g, m);
+        gsl_rng_uniform_fill (r, u, m);
+
+        for (i = 0; i < m; i++)
+          {
+            const double xi = g[i];
+            const double v = 1.0 + c * xi;
+            const double v3 = v * v * v;
+            const int accept = (v > 0) & (u[i] > 0)
+              & (u[i] < 1 - 0.0331 * xi * xi * xi * xi);
+
+            y[i] = b * d * v3;
+            nslow += !accept;
+          }
+
+        if (nslow > 0)
+          {
+            for (i = 0; i < m; i++)
+              {
+                const double xi = g[i];
+                const double v = 1.0 + c * xi;
+                const double v3 = v * v * v;
+
+                if (v > 0 && u[i] > 0 && u[i] < 1 - 0.0331 * xi * xi * xi * xi)
+                  continue;
+
+                if (!(v > 0 && u[i] > 0
+                      && log (u[i]) < 0.5 * xi * xi + d * (1 - v3 + log (v3))))
+                  y[i] = gsl_ran_gamma (r, a, b);
+              }
+          }
+
+        done += m;
+      }
+  }
+}
@@ -225,3 +225,84 @@ gsl_ran_gaussian_ziggurat (const gsl_rng * r, const double sigma)
 
   return sign * sigma * x;
 }
+
+/* Bulk version.  The random words for a block of samples are drawn at
+   once with gsl_rng_get_fill, so the fast path (a point inside one of
+   the rectangles, about 99% of the time) needs no calls through the
+   generator.  The remaining points are finished out of line by
+   zig_slow, which continues the same trial and restarts the whole
+   algorithm if it is rejected. */
+
+#define ZIG_BLOCK 256
+
+static double
+zig_slow (const gsl_rng * r, unsigned long int i, unsigned long int j,
+          const double sign, const double sigma)
+{
+  double x = j * wtab[i], y;
+
+  if (i < 127)
+    {
+      double y0, y1, U1;
+      y0 = ytab[i];
+      y1 = ytab[i + 1];
+      U1 = gsl_rng_uniform (r);
+      y = y1 + (y0 - y1) * U1;
+    }
+  else
+    {
+      double U1, U2;
+      U1 = 1.0 - gsl_rng_uniform (r);
+      U2 = gsl_rng_uniform (r);
+      x = PARAM_R - log (U1) / PARAM_R;
+      y = exp (-PARAM_R * (x - 0.5 * PARAM_R)) * U2;
+    }
+
+  if (y < exp (-0.5 * x * x))
+    return sign * sigma * x;
+
+  return gsl_ran_gaussian_ziggurat (r, sigma);
+}
+
+void
+gsl_ran_gaussian_fill (const gsl_rng * r, const double sigma, double x[],
+                       const size_t n)
+{
+  const unsigned long int range = r->type->max - r->type->min;
+  const unsigned long int offset = r->type->min;
+  unsigned long int k[ZIG_BLOCK];
+  size_t i, done = 0;
+
+  if (range < 0xFFFFFFFF)
+    {
+      /* the generator does not give 32 random bits per call */
+
+      for (i = 0; i < n; i++)
+        x[i] = gsl_ran_gaussian_ziggurat (r, sigma);
+
+      return;
+    }
+
+  while (done < n)
+    {
+      const size_t m = (n - done < ZIG_BLOCK) ? n - done : ZIG_BLOCK;
+      double *const y = x + done;
+
+      gsl_rng_get_fill (r, k, m);
+
+      for (i = 0; i < m; i++)
+        {
+          const unsigned long int w = k[i] - offset;
+          const unsigned long int s = w & 0x7f;
+          const unsigned long int j = (w >> 8) & 0xFFFFFF;
+          const double sign = (double) ((w >> 6) & 2) - 1.0;  /* bit 7 */
+
+          if (j < ktab[s])
+            y[i] = sign * sigma * (j * wtab[s]);
+          else
+            y[i] = zig_slow (r, s, j, sign, sigma);
+        }
+
+      done += m;
+    }
+}
@@ -46,8 +46,24 @@ unsigned int gsl_ran_binomial_knuth (const gsl_rng * r, double p, unsigned int n
 unsigned int gsl_ran_binomial_tpe (const gsl_rng * r, double p, unsigned int n);
 double gsl_ran_binomial_pdf (const unsigned int k, const double p, const unsigned int n);
 
+typedef struct {                /* cached constants for BINV/BTPE */
+    unsigned int n;
+    int flipped;                /* p > 0.5 was replaced by 1 - p */
+    double p, q, s, np;
+    double f0;                  /* BINV: probability of 0 */
+    int m;                      /* BTPE: mode */
+    double fm, xm, npq, p1, xl, xr, c, p2, p3, p4, lambda_l, lambda_r;
+} gsl_ran_binomial_workspace;
+
+gsl_ran_binomial_workspace * gsl_ran_binomial_alloc (double p, unsigned int n);
+int gsl_ran_binomial_set (gsl_ran_binomial_workspace * w, double p, unsigned int n);
+void gsl_ran_binomial_free (gsl_ran_binomial_workspace * w);
+unsigned int gsl_ran_binomial_sample (const gsl_rng * r, const gsl_ran_binomial_workspace * w);
+void gsl_ran_binomial_fill (const gsl_rng * r, const gsl_ran_binomial_workspace * w, unsigned int x[], const size_t n);
+
 double gsl_ran_exponential (const gsl_rng * r, const double mu);
 double gsl_ran_exponential_pdf (const double x, const double mu);
+void gsl_ran_exponential_fill (const gsl_rng * r, const double mu, double x[], const size_t n);
 
 double gsl_ran_exppow (const gsl_rng * r, const double a, const double b);
 double gsl_ran_exppow_pdf (const double x, const double a, const double b);
@@ -70,16 +86,19 @@ double gsl_ran_fdist_pdf (const double x, const double nu1, const double nu2);
 
 double gsl_ran_flat (const gsl_rng * r, const double a, const double b);
 double gsl_ran_flat_pdf (double x, const double a, const double b);
+void gsl_ran_flat_fill (const gsl_rng * r, const double a, const double b, double x[], const size_t n);
 
 double gsl_ran_gamma (const gsl_rng * r, const double a, const double b);
 double gsl_ran_gamma_int (const gsl_rng * r, const unsigned int a);
 double gsl_ran_gamma_pdf (const double x, const double a, const double b);
 double gsl_ran_gamma_mt (const gsl_rng * r, const double a, const double b);
 double gsl_ran_gamma_knuth (const gsl_rng * r, const double a, const double b);
+void gsl_ran_gamma_fill (const gsl_rng * r, const double a, const double b, double x[], const size_t n);
 
 double gsl_ran_gaussian (const gsl_rng * r, const double sigma);
 double gsl_ran_gaussian_ratio_method (const gsl_rng * r, const double sigma);
 double gsl_ran_gaussian_ziggurat (const gsl_rng * r, const double sigma);
+void gsl_ran_gaussian_fill (const gsl_rng * r, const double sigma, double x[], const size_t n);
 double gsl_ran_gaussian_pdf (const double x, const double sigma);
 
 double gsl_ran_ugaussian (const gsl_rng * r);
@@ -106,6 +125,15 @@ int gsl_ran_multivariate_gaussian_pdf (const gsl_vector * x,
                                        const gsl_matrix * L,
                                        double * result,
                                        gsl_vector * work);
+int gsl_ran_multivariate_gaussian_array (const gsl_rng * r,
+                                         const gsl_vector * mu,
+                                         const gsl_matrix * L,
+                                         gsl_matrix * result);
+int gsl_ran_multivariate_gaussian_log_pdf_array (const gsl_matrix * X,
+                                                 const gsl_vector * mu,
+                                                 const gsl_matrix * L,
+                                                 gsl_vector * result,
+                                                 gsl_matrix * work);
 int gsl_ran_multivariate_gaussian_mean (const gsl_matrix * X, gsl_vector * mu_hat);
 int gsl_ran_multivariate_gaussian_vcov (const gsl_matrix * X, gsl_matrix * sigma_hat);
 
@@ -126,6 +154,16 @@ int gsl_ran_wishart_pdf (const gsl_matrix * X,
                          const gsl_matrix * L,
                          double * result,
                          gsl_matrix * work);
+int gsl_ran_wishart_array (const gsl_rng * r,
+                           const double df,
+                           const gsl_matrix * L,
+                           gsl_matrix * result,
+                           gsl_matrix * work);
+int gsl_ran_wishart_log_pdf_array (const gsl_matrix * L_X,
+                                   const double df,
+                                   const gsl_matrix * L,
+                                   gsl_vector * result,
+                                   gsl_matrix * work);
 
 double gsl_ran_landau (const gsl_rng * r);
 double gsl_ran_landau_pdf (const double x);
@@ -174,6 +212,18 @@ void gsl_ran_poisson_array (const gsl_rng * r, size_t n, unsigned int array[],
                             double mu);
 double gsl_ran_poisson_pdf (const unsigned int k, const double mu);
 
+typedef struct {                /* cached constants for inversion/PTRS */
+    double mu;
+    double emu;                 /* inversion: exp(-mu) */
+    double log_mu, b, a, inv_alpha, vr;   /* PTRS, for mu >= 10 */
+} gsl_ran_poisson_workspace;
+
+gsl_ran_poisson_workspace * gsl_ran_poisson_alloc (double mu);
+int gsl_ran_poisson_set (gsl_ran_poisson_workspace * w, double mu);
+void gsl_ran_poisson_free (gsl_ran_poisson_workspace * w);
+unsigned int gsl_ran_poisson_sample (const gsl_rng * r, const gsl_ran_poisson_workspace * w);
+void gsl_ran_poisson_fill (const gsl_rng * r, const gsl_ran_poisson_workspace * w, unsigned int x[], const size_t n);
+
 double gsl_ran_rayleigh (const gsl_rng * r, const double sigma);
 double gsl_ran_rayleigh_pdf (const double x, const double sigma);
 
@@ -198,9 +248,47 @@ void gsl_ran_dir_3d (const gsl_rng * r, double * x, double * y, double * z);
 void gsl_ran_dir_nd (const gsl_rng * r, size_t n, double * x);
 
 void gsl_ran_shuffle (const gsl_rng * r, void * base, size_t nmembm, size_t size);
+void gsl_ran_shuffle_merge (const gsl_rng * r, void * base, size_t nmembm, size_t size);
 int gsl_ran_choose (const gsl_rng * r, void * dest, size_t k, void * src, size_t n, size_t size) ;
 void gsl_ran_sample (const gsl_rng * r, void * dest, size_t k, void * src, size_t n, size_t size) ;
 
+typedef struct {                /* Algorithm L reservoir */
+    size_t k;                   /* capacity of the reservoir */
+    size_t size;                /* size of each item in bytes */
+    size_t n;                   /* number of items held */
+    size_t count;               /* number of items seen */
+    double W;
+    size_t skip;                /* items to pass over before the next replacement */
+    char *data;
+} gsl_ran_reservoir_workspace;
+
+gsl_ran_reservoir_workspace * gsl_ran_reservoir_alloc (const size_t k, const size_t size);
+void gsl_ran_reservoir_free (gsl_ran_reservoir_workspace * w);
+int gsl_ran_reservoir_reset (gsl_ran_reservoir_workspace * w);
+int gsl_ran_reservoir_add (const gsl_rng * r, gsl_ran_reservoir_workspace * w, const void * x);
+int gsl_ran_reservoir_add_array (const gsl_rng * r, gsl_ran_reservoir_workspace * w, const void * src, const size_t n);
+size_t gsl_ran_reservoir_get (void * dest, const gsl_ran_reservoir_workspace * w);
+size_t gsl_ran_reservoir_count (const gsl_ran_reservoir_workspace * w);
+
+typedef struct {                /* Algorithm A-ExpJ weighted reservoir */
+    size_t k;                   /* capacity of the reservoir */
+    size_t size;                /* size of each item in bytes */
+    size_t n;                   /* number of items held */
+    size_t count;               /* number of items seen */
+    double skip;                /* weight to pass over before the next insertion */
+    double *key;                /* min-heap of log keys */
+    size_t *slot;               /* data slot of each heap entry */
+    char *data;
+} gsl_ran_reservoir_weighted_workspace;
+
+gsl_ran_reservoir_weighted_workspace * gsl_ran_reservoir_weighted_alloc (const size_t k, const size_t size);
+void gsl_ran_reservoir_weighted_free (gsl_ran_reservoir_weighted_workspace * w);
+int gsl_ran_reservoir_weighted_reset (gsl_ran_reservoir_weighted_workspace * w);
+int gsl_ran_reservoir_weighted_add (const gsl_rng * r, gsl_ran_reservoir_weighted_workspace * w, const void * x, const double weight);
+int gsl_ran_reservoir_weighted_add_array (const gsl_rng * r, gsl_ran_reservoir_weighted_workspace * w, const void * src, const double weight[], const size_t n);
+size_t gsl_ran_reservoir_weighted_get (void * dest, const gsl_ran_reservoir_weighted_workspace * w);
+size_t gsl_ran_reservoir_weighted_count (const gsl_ran_reservoir_weighted_workspace * w);
+
 
 typedef struct {                /* struct for Walker algorithm */
     size_t K;
@@ -213,6 +301,20 @@ void gsl_ran_discrete_free(gsl_ran_discrete_t *g);
 size_t gsl_ran_discrete (const gsl_rng *r, const gsl_ran_discrete_t *g);
 double gsl_ran_discrete_pdf (size_t k, const gsl_ran_discrete_t *g);
 
+typedef struct {                /* partial sum tree for dynamic weights */
+    size_t K;
+    double *tree;
+} gsl_ran_discrete_dynamic_t;
+
+gsl_ran_discrete_dynamic_t * gsl_ran_discrete_dynamic_alloc (size_t K, const double *P);
+void gsl_ran_discrete_dynamic_free (gsl_ran_discrete_dynamic_t *g);
+int gsl_ran_discrete_dynamic_set (gsl_ran_discrete_dynamic_t *g, size_t k, double weight);
+int gsl_ran_discrete_dynamic_set_all (gsl_ran_discrete_dynamic_t *g, const double *P);
+double gsl_ran_discrete_dynamic_get (const gsl_ran_discrete_dynamic_t *g, size_t k);
+double gsl_ran_discrete_dynamic_total (const gsl_ran_discrete_dynamic_t *g);
+size_t gsl_ran_discrete_dynamic (const gsl_rng *r, const gsl_ran_discrete_dynamic_t *g);
+double gsl_ran_discrete_dynamic_pdf (size_t k, const gsl_ran_discrete_dynamic_t *g);
+
 
 __END_DECLS
 
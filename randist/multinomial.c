@@ -62,7 +62,12 @@ gsl_ran_multinomial (const gsl_rng * r, const size_t K,
 
   for (k = 0; k < K; k++)
     {
-      if (p[k] > 0.0)
+      /* once all N trials are assigned the remaining counts are zero,
+         so no more binomial variates are needed (gsl_ran_binomial
+         uses no random numbers for zero trials either, so this does
+         not change the output) */
+
+      if (p[k] > 0.0 && sum_n < N)
         {
           n[k] = gsl_ran_binomial (r, p[k] / (norm - sum_p), N - sum_n);
         }
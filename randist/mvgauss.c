@@ -162,6 +162,154 @@ gsl_ran_multivariate_gaussian_pdf (const gsl_vector * x,
   return status;
 }
 
+/* Generate n random vectors from a multivariate Gaussian distribution at
+ * once.  The standard normal deviates are drawn in bulk and transformed by
+ * a single triangular matrix multiplication, X = Z L^T, so the cost is
+ * dominated by a level-3 BLAS call.
+ *
+ * mu      mean vector (dimension d)
+ * L       matrix resulting from the Cholesky decomposition of
+ *         variance-covariance matrix Sigma = L L^T (dimension d x d)
+ * result  output matrix, one sample per row (dimension n x d)
+ */
+int
+gsl_ran_multivariate_gaussian_array (const gsl_rng * r,
+                                     const gsl_vector * mu,
+                                     const gsl_matrix * L,
+                                     gsl_matrix * result)
+{
+  const size_t M = L->size1;
+  const size_t N = L->size2;
+
+  if (M != N)
+    {
+      GSL_ERROR("requires square matrix", GSL_ENOTSQR);
+    }
+  else if (mu->size != M)
+    {
+      GSL_ERROR("incompatible dimension of mean vector with variance-covariance matrix", GSL_EBADLEN);
+    }
+  else if (result->size2 != M)
+    {
+      GSL_ERROR("incompatible dimension of result matrix", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t n = result->size1;
+      size_t i;
+
+      if (n == 0)
+        return GSL_SUCCESS;
+
+      /* fill Z with standard normal deviates */
+      if (result->tda == M)
+        {
+          gsl_ran_gaussian_fill(r, 1.0, result->data, n * M);
+        }
+      else
+        {
+          for (i = 0; i < n; ++i)
+            gsl_ran_gaussian_fill(r, 1.0, result->data + i * result->tda, M);
+        }
+
+      /* compute: X = Z L^T */
+      gsl_blas_dtrmm(CblasRight, CblasLower, CblasTrans, CblasNonUnit, 1.0,
+                     L, result);
+
+      for (i = 0; i < n; ++i)
+        {
+          gsl_vector_view row = gsl_matrix_row(result, i);
+          gsl_vector_add(&row.vector, mu);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* Compute the log of the probability density function at n quantile
+ * vectors at once.  The vectors are whitened together by one triangular
+ * solve, Y = (X - 1 mu^T) L^{-T}, and the log determinant is computed once.
+ *
+ * X       matrix of quantiles, one per row (dimension n x d)
+ * mu      mean vector (dimension d)
+ * L       matrix resulting from the Cholesky decomposition of
+ *         variance-covariance matrix Sigma = L L^T (dimension d x d)
+ * result  output vector of log densities (dimension n)
+ * work    matrix used for intermediate computations (dimension n x d)
+ */
+int
+gsl_ran_multivariate_gaussian_log_pdf_array (const gsl_matrix * X,
+                                             const gsl_vector * mu,
+                                             const gsl_matrix * L,
+                                             gsl_vector * result,
+                                             gsl_matrix * work)
+{
+  const size_t M = L->size1;
+  const size_t N = L->size2;
+
+  if (M != N)
+    {
+      GSL_ERROR("requires square matrix", GSL_ENOTSQR);
+    }
+  else if (mu->size != M)
+    {
+      GSL_ERROR("incompatible dimension of mean vector with variance-covariance matrix", GSL_EBADLEN);
+    }
+  else if (X->size2 != M)
+    {
+      GSL_ERROR("incompatible dimension of quantile matrix", GSL_EBADLEN);
+    }
+  else if (result->size != X->size1)
+    {
+      GSL_ERROR("incompatible dimension of result vector", GSL_EBADLEN);
+    }
+  else if (work->size1 != X->size1 || work->size2 != M)
+    {
+      GSL_ERROR("incompatible dimensions of work matrix", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t n = X->size1;
+      size_t i;
+      double logSqrtDetSigma, c;
+
+      if (n == 0)
+        return GSL_SUCCESS;
+
+      /* compute: work = X - 1 mu^T */
+      gsl_matrix_memcpy(work, X);
+      for (i = 0; i < n; ++i)
+        {
+          gsl_vector_view row = gsl_matrix_row(work, i);
+          gsl_vector_sub(&row.vector, mu);
+        }
+
+      /* compute: work = (X - 1 mu^T) L^{-T} */
+      gsl_blas_dtrsm(CblasRight, CblasLower, CblasTrans, CblasNonUnit, 1.0,
+                     L, work);
+
+      /* compute: log [ sqrt(|Sigma|) ] = sum_i log L_{ii} */
+      logSqrtDetSigma = 0.0;
+      for (i = 0; i < M; ++i)
+        {
+          double Lii = gsl_matrix_get(L, i, i);
+          logSqrtDetSigma += log(Lii);
+        }
+
+      c = -logSqrtDetSigma - 0.5*M*log(2.0*M_PI);
+
+      for (i = 0; i < n; ++i)
+        {
+          gsl_vector_const_view row = gsl_matrix_const_row(work, i);
+          double quadForm;
+          gsl_blas_ddot(&row.vector, &row.vector, &quadForm);
+          gsl_vector_set(result, i, -0.5*quadForm + c);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
 /* Compute the maximum-likelihood estimate of the mean vector of samples
  * from a multivariate Gaussian distribution.
  *
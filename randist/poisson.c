@@ -18,7 +18,11 @@
  */
 
 #include <config.h>
+#include <stdlib.h>
+#include <limits.h>
 #include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_sf_gamma.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
@@ -82,6 +86,150 @@ gsl_ran_poisson_array (const gsl_rng * r, size_t n, unsigned int array[],
   return;
 }
 
+/* Workspace sampler for repeated draws with the same mean.  Small
+   means use inversion, searching up from 0 with the cached value of
+   exp(-mu).  Means of 10 or more use the transformed rejection method
+   with squeeze, PTRS, of W. Hormann (The transformed rejection method
+   for generating Poisson random variables, Insurance: Mathematics and
+   Economics 12, 39-45 (1993)), whose constants are cached.  Both use
+   O(1) random numbers per variate on average for large mu, compared
+   with O(log mu) gamma variates in gsl_ran_poisson, so the variates
+   differ from those of gsl_ran_poisson for the same generator state. */
+
+#define PTRS_MIN_MU 10.0
+#define INV_CUTOFF 200          /* retry inversion if roundoff runs past this */
+
+/* the variates are returned as unsigned int, so leave a margin of
+   16 standard deviations (2^20 > 16 sqrt(UINT_MAX)) below UINT_MAX */
+#define MAX_MU ((double) UINT_MAX - 1048576.0)
+
+static void
+poisson_init (gsl_ran_poisson_workspace * w, double mu)
+{
+  w->mu = mu;
+  w->emu = exp (-mu);
+  w->log_mu = log (mu);
+
+  if (mu >= PTRS_MIN_MU)
+    {
+      const double smu = sqrt (mu);
+      w->b = 0.931 + 2.53 * smu;
+      w->a = -0.059 + 0.02483 * w->b;
+      w->inv_alpha = 1.1239 + 1.1328 / (w->b - 3.4);
+      w->vr = 0.9277 - 3.6224 / (w->b - 2);
+    }
+}
+
+gsl_ran_poisson_workspace *
+gsl_ran_poisson_alloc (double mu)
+{
+  gsl_ran_poisson_workspace *w;
+
+  if (!(mu >= 0.0) || !gsl_finite (mu))
+    {
+      GSL_ERROR_NULL ("mu must be non-negative and finite", GSL_EDOM);
+    }
+
+  if (mu > MAX_MU)
+    {
+      GSL_ERROR_NULL ("mu is too large for an unsigned int sample", GSL_EDOM);
+    }
+
+  w = (gsl_ran_poisson_workspace *) malloc (sizeof (gsl_ran_poisson_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  poisson_init (w, mu);
+
+  return w;
+}
+
+int
+gsl_ran_poisson_set (gsl_ran_poisson_workspace * w, double mu)
+{
+  if (!(mu >= 0.0) || !gsl_finite (mu))
+    {
+      GSL_ERROR ("mu must be non-negative and finite", GSL_EDOM);
+    }
+
+  if (mu > MAX_MU)
+    {
+      GSL_ERROR ("mu is too large for an unsigned int sample", GSL_EDOM);
+    }
+
+  poisson_init (w, mu);
+
+  return GSL_SUCCESS;
+}
+
+void
+gsl_ran_poisson_free (gsl_ran_poisson_workspace * w)
+{
+  RETURN_IF_NULL (w);
+  free (w);
+}
+
+unsigned int
+gsl_ran_poisson_sample (const gsl_rng * r, const gsl_ran_poisson_workspace * w)
+{
+  const double mu = w->mu;
+
+  if (mu < PTRS_MIN_MU)
+    {
+      for (;;)
+        {
+          double u = gsl_rng_uniform (r);
+          double f = w->emu;
+          unsigned int k;
+
+          for (k = 0; k <= INV_CUTOFF; k++)
+            {
+              if (u < f)
+                return k;
+              u -= f;
+              f *= mu / (k + 1);
+            }
+        }
+    }
+  else
+    {
+      const double a = w->a, b = w->b;
+
+      for (;;)
+        {
+          const double u = gsl_rng_uniform (r) - 0.5;
+          const double v = gsl_rng_uniform_pos (r);
+          const double us = 0.5 - fabs (u);
+          const double k = floor ((2 * a / us + b) * u + mu + 0.43);
+
+          if (us >= 0.07 && v <= w->vr)
+            return (unsigned int) k;
+
+          if (k < 0 || (us < 0.013 && v > us))
+            continue;
+
+          if (log (v * w->inv_alpha / (a / (us * us) + b))
+              <= -mu + k * w->log_mu - gsl_sf_lnfact ((unsigned int) k))
+            return (unsigned int) k;
+        }
+    }
+}
+
+void
+gsl_ran_poisson_fill (const gsl_rng * r, const gsl_ran_poisson_workspace * w,
+                      unsigned int x[], const size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      x[i] = gsl_ran_poisson_sample (r, w);
+    }
+}
+
 double
 gsl_ran_poisson_pdf (const unsigned int k, const double mu)
 {
@@ -0,0 +1,427 @@
+/* randist/reservoir.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Reservoir sampling: choose k items from a stream of unknown length,
+   keeping only the k items of the current sample in memory.
+
+   The unweighted sampler is Algorithm L of Li (Reservoir-sampling
+   algorithms of time complexity O(n(1 + log(N/n))), ACM TOMS 20,
+   481--493 (1994)).  Instead of drawing a random number for every
+   item it draws the number of items to skip before the next
+   replacement from a geometric distribution, so the expected number
+   of random numbers used for a stream of length N is O(k (1 +
+   log(N/k))).
+
+   The weighted sampler is Algorithm A-ExpJ of Efraimidis and Spirakis
+   (Weighted random sampling with a reservoir, Inf Proc Lett 97,
+   181--185 (2006)).  Each item gets the key u^(1/w) and the sample is
+   the k items with the largest keys, held in a min-heap.  The
+   exponential jump draws the total weight to skip before the next
+   insertion, again using O(k log(N/k)) random numbers.  The keys are
+   stored as logarithms, log(u)/w, to avoid underflow for small
+   weights. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+
+gsl_ran_reservoir_workspace *
+gsl_ran_reservoir_alloc (const size_t k, const size_t size)
+{
+  gsl_ran_reservoir_workspace *w;
+
+  if (k == 0)
+    {
+      GSL_ERROR_NULL ("reservoir size k must be positive", GSL_EINVAL);
+    }
+
+  if (size == 0)
+    {
+      GSL_ERROR_NULL ("item size must be positive", GSL_EINVAL);
+    }
+
+  w = (gsl_ran_reservoir_workspace *) malloc (sizeof (gsl_ran_reservoir_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->data = (char *) malloc (k * size);
+
+  if (w->data == 0)
+    {
+      free (w);
+      GSL_ERROR_NULL ("failed to allocate space for reservoir", GSL_ENOMEM);
+    }
+
+  w->k = k;
+  w->size = size;
+
+  gsl_ran_reservoir_reset (w);
+
+  return w;
+}
+
+void
+gsl_ran_reservoir_free (gsl_ran_reservoir_workspace * w)
+{
+  RETURN_IF_NULL (w);
+  free (w->data);
+  free (w);
+}
+
+int
+gsl_ran_reservoir_reset (gsl_ran_reservoir_workspace * w)
+{
+  w->n = 0;
+  w->count = 0;
+  w->W = 1.0;
+  w->skip = 0;
+
+  return GSL_SUCCESS;
+}
+
+/* draw the next value of W and the number of items to skip before the
+   next replacement */
+
+static void
+reservoir_next (const gsl_rng * r, gsl_ran_reservoir_workspace * w)
+{
+  double s;
+
+  w->W *= exp (log (gsl_rng_uniform_pos (r)) / (double) w->k);
+
+  s = floor (log (gsl_rng_uniform_pos (r)) / log1p (-w->W));
+
+  /* once W is tiny the skips exceed any stream length */
+  w->skip = (s < (double) ((size_t) -1)) ? (size_t) s : (size_t) -1;
+}
+
+int
+gsl_ran_reservoir_add_array (const gsl_rng * r,
+                             gsl_ran_reservoir_workspace * w,
+                             const void *src, const size_t n)
+{
+  const size_t size = w->size;
+  const char *x = (const char *) src;
+  size_t i = 0;
+
+  /* fill the reservoir with the first k items */
+
+  if (w->n < w->k)
+    {
+      size_t m = GSL_MIN (w->k - w->n, n);
+
+      memcpy (w->data + w->n * size, x, m * size);
+      w->n += m;
+      i = m;
+
+      if (w->n == w->k)
+        reservoir_next (r, w);
+    }
+
+  /* then jump from one replacement to the next */
+
+  while (i < n)
+    {
+      if (w->skip >= n - i)
+        {
+          w->skip -= n - i;
+          break;
+        }
+
+      i += w->skip;
+
+      {
+        size_t j = gsl_rng_uniform_int (r, w->k);
+        memcpy (w->data + j * size, x + i * size, size);
+      }
+
+      i++;
+      reservoir_next (r, w);
+    }
+
+  w->count += n;
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_ran_reservoir_add (const gsl_rng * r, gsl_ran_reservoir_workspace * w,
+                       const void *x)
+{
+  return gsl_ran_reservoir_add_array (r, w, x, 1);
+}
+
+size_t
+gsl_ran_reservoir_get (void *dest, const gsl_ran_reservoir_workspace * w)
+{
+  memcpy (dest, w->data, w->n * w->size);
+  return w->n;
+}
+
+size_t
+gsl_ran_reservoir_count (const gsl_ran_reservoir_workspace * w)
+{
+  return w->count;
+}
+
+gsl_ran_reservoir_weighted_workspace *
+gsl_ran_reservoir_weighted_alloc (const size_t k, const size_t size)
+{
+  gsl_ran_reservoir_weighted_workspace *w;
+
+  if (k == 0)
+    {
+      GSL_ERROR_NULL ("reservoir size k must be positive", GSL_EINVAL);
+    }
+
+  if (size == 0)
+    {
+      GSL_ERROR_NULL ("item size must be positive", GSL_EINVAL);
+    }
+
+  w = (gsl_ran_reservoir_weighted_workspace *)
+    malloc (sizeof (gsl_ran_reservoir_weighted_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->data = (char *) malloc (k * size);
+
+  if (w->data == 0)
+    {
+      free (w);
+      GSL_ERROR_NULL ("failed to allocate space for reservoir", GSL_ENOMEM);
+    }
+
+  w->key = (double *) malloc (k * sizeof (double));
+
+  if (w->key == 0)
+    {
+      free (w->data);
+      free (w);
+      GSL_ERROR_NULL ("failed to allocate space for keys", GSL_ENOMEM);
+    }
+
+  w->slot = (size_t *) malloc (k * sizeof (size_t));
+
+  if (w->slot == 0)
+    {
+      free (w->key);
+      free (w->data);
+      free (w);
+      GSL_ERROR_NULL ("failed to allocate space for heap", GSL_ENOMEM);
+    }
+
+  w->k = k;
+  w->size = size;
+
+  gsl_ran_reservoir_weighted_reset (w);
+
+  return w;
+}
+
+void
+gsl_ran_reservoir_weighted_free (gsl_ran_reservoir_weighted_workspace * w)
+{
+  RETURN_IF_NULL (w);
+  free (w->slot);
+  free (w->key);
+  free (w->data);
+  free (w);
+}
+
+int
+gsl_ran_reservoir_weighted_reset (gsl_ran_reservoir_weighted_workspace * w)
+{
+  w->n = 0;
+  w->count = 0;
+  w->skip = 0.0;
+
+  return GSL_SUCCESS;
+}
+
+/* The keys form a min-heap, key[0] being the smallest.  Item slot[i]
+   of the data array has key key[i]. */
+
+static void
+heap_sift_up (gsl_ran_reservoir_weighted_workspace * w, size_t i)
+{
+  double *key = w->key;
+  size_t *slot = w->slot;
+  const double ki = key[i];
+  const size_t si = slot[i];
+
+  while (i > 0)
+    {
+      size_t p = (i - 1) / 2;
+
+      if (key[p] <= ki)
+        break;
+
+      key[i] = key[p];
+      slot[i] = slot[p];
+      i = p;
+    }
+
+  key[i] = ki;
+  slot[i] = si;
+}
+
+static void
+heap_sift_down (gsl_ran_reservoir_weighted_workspace * w)
+{
+  double *key = w->key;
+  size_t *slot = w->slot;
+  const size_t n = w->n;
+  const double k0 = key[0];
+  const size_t s0 = slot[0];
+  size_t i = 0;
+
+  for (;;)
+    {
+      size_t c = 2 * i + 1;
+
+      if (c >= n)
+        break;
+
+      if (c + 1 < n && key[c + 1] < key[c])
+        c++;
+
+      if (k0 <= key[c])
+        break;
+
+      key[i] = key[c];
+      slot[i] = slot[c];
+      i = c;
+    }
+
+  key[i] = k0;
+  slot[i] = s0;
+}
+
+/* draw the total weight to pass over before the next insertion; the
+   smallest log key is negative, so the result is positive */
+
+static void
+weighted_next (const gsl_rng * r, gsl_ran_reservoir_weighted_workspace * w)
+{
+  if (w->key[0] < 0.0)
+    w->skip = log (gsl_rng_uniform_pos (r)) / w->key[0];
+  else
+    w->skip = GSL_POSINF;       /* no key can exceed log(1) = 0 */
+}
+
+int
+gsl_ran_reservoir_weighted_add_array (const gsl_rng * r,
+                                      gsl_ran_reservoir_weighted_workspace * w,
+                                      const void *src, const double weight[],
+                                      const size_t n)
+{
+  const size_t size = w->size;
+  const char *x = (const char *) src;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      if (!(weight[i] >= 0.0) || !gsl_finite (weight[i]))
+        {
+          GSL_ERROR ("weights must be non-negative and finite", GSL_EINVAL);
+        }
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      const double wi = weight[i];
+
+      /* items of zero weight are never sampled */
+
+      if (wi == 0.0)
+        continue;
+
+      if (w->n < w->k)
+        {
+          const size_t j = w->n++;
+
+          memcpy (w->data + j * size, x + i * size, size);
+          w->key[j] = log (gsl_rng_uniform_pos (r)) / wi;
+          w->slot[j] = j;
+          heap_sift_up (w, j);
+
+          if (w->n == w->k)
+            weighted_next (r, w);
+
+          continue;
+        }
+
+      w->skip -= wi;
+
+      if (w->skip > 0.0)
+        continue;
+
+      /* the new key is conditioned to exceed the smallest key T, i.e.
+         u is drawn uniformly from (T^wi, 1) */
+
+      {
+        const double t = exp (w->key[0] * wi);
+        const double u = t + (1.0 - t) * gsl_rng_uniform_pos (r);
+
+        memcpy (w->data + w->slot[0] * size, x + i * size, size);
+        w->key[0] = log (u) / wi;
+        heap_sift_down (w);
+      }
+
+      weighted_next (r, w);
+    }
+
+  w->count += n;
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_ran_reservoir_weighted_add (const gsl_rng * r,
+                                gsl_ran_reservoir_weighted_workspace * w,
+                                const void *x, const double weight)
+{
+  return gsl_ran_reservoir_weighted_add_array (r, w, x, &weight, 1);
+}
+
+size_t
+gsl_ran_reservoir_weighted_get (void *dest,
+                                const gsl_ran_reservoir_weighted_workspace * w)
+{
+  memcpy (dest, w->data, w->n * w->size);
+  return w->n;
+}
+
+size_t
+gsl_ran_reservoir_weighted_count (const gsl_ran_reservoir_weighted_workspace * w)
+{
+  return w->count;
+}
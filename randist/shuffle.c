@@ -19,11 +19,21 @@
 
 #include <config.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
 
-/* Inline swap and copy functions for moving objects around */
+/* Inline swap and copy functions for moving objects around.  Objects
+   of 4, 8 and 16 bytes are moved with fixed-size memcpy calls, which
+   the compiler turns into word loads and stores; the switch on size is
+   the same for every call in a loop, so it is perfectly predicted.
+   SWAP_FIXED may be called with a == b (see merge_flips), so the copy
+   between the two objects uses memmove, which is compiled to the same
+   loads and stores at fixed size. */
+
+#define SWAP_FIXED(a, b, n) \
+  do { char tmp[n]; memcpy (tmp, a, n); memmove (a, b, n); memcpy (b, tmp, n); } while (0)
 
 static inline 
 void swap (void * base, size_t size, size_t i, size_t j)
@@ -34,6 +44,19 @@ void swap (void * base, size_t size, size_t i, size_t j)
 
   if (i == j)
     return ;
+
+  switch (size)
+    {
+    case 4:
+      SWAP_FIXED (a, b, 4);
+      return;
+    case 8:
+      SWAP_FIXED (a, b, 8);
+      return;
+    case 16:
+      SWAP_FIXED (a, b, 16);
+      return;
+    }
   
   do                                            
     {                                           
@@ -50,6 +73,19 @@ copy (void * dest, size_t i, void * src, size_t j, size_t size)
   register char * a = size * i + (char *) dest ;
   register char * b = size * j + (char *) src ;
   register size_t s = size ;
+
+  switch (size)
+    {
+    case 4:
+      memcpy (a, b, 4);
+      return;
+    case 8:
+      memcpy (a, b, 8);
+      return;
+    case 16:
+      memcpy (a, b, 16);
+      return;
+    }
   
   do                                            
     {                                           
@@ -78,6 +114,218 @@ gsl_ran_shuffle (const gsl_rng * r, void * base, size_t n, size_t size)
     }
 }
 
+/* Cache-friendly shuffle of large arrays, using the MergeShuffle
+   algorithm of Bacher, Bodini, Hollender and Lumbroso (MergeShuffle: a
+   very fast, parallel random permutation algorithm, arXiv:1508.03167).
+
+   The array is split into 2^p blocks which fit in the cache, and each
+   block is shuffled by Fisher-Yates.  Neighbouring blocks are then
+   merged pairwise, level by level.  Given two uniformly shuffled runs,
+   the merge picks the source of each output element by a fair coin,
+   swapping elements from the right run forward, until one run is used
+   up.  The elements that remain are inserted at random positions in
+   the output so far, by Fisher-Yates steps.  The coin-flipping phase
+   only accesses memory sequentially, and the expected number of
+   leftover elements is O(sqrt(n)), so almost all of the random access
+   happens inside cache-sized blocks.  The result is a uniform random
+   permutation, like gsl_ran_shuffle, although it is a different
+   permutation for the same generator state. */
+
+#define MERGE_BLOCK_BYTES 1048576
+
+typedef struct
+{
+  unsigned long int min;        /* minimum of the generator */
+  unsigned long int n;          /* 2^bits for gsl_rng_uniform_int, or 0 */
+  unsigned long int word;       /* unused random bits */
+  int bits;                     /* bits per word */
+  int left;                     /* number of unused bits in word */
+}
+coin_t;
+
+static void
+coin_init (const gsl_rng * r, coin_t * c)
+{
+  const unsigned long int range = r->type->max - r->type->min;
+  int b = 0;
+
+  c->min = r->type->min;
+  c->left = 0;
+  c->word = 0;
+
+  if ((range & (range + 1)) == 0)
+    {
+      /* all the bits of each output are uniform, use them directly */
+      while (b < 32 && ((range >> b) & 1UL))
+        b++;
+
+      c->n = 0;
+    }
+  else
+    {
+      /* use the largest b with 2^b - 1 <= range, up to 30 bits */
+      b = 1;
+      while (b < 30 && ((1UL << (b + 1)) - 1) <= range)
+        b++;
+
+      c->n = 1UL << b;
+    }
+
+  c->bits = b;
+}
+
+static inline int
+coin_flip (const gsl_rng * r, coin_t * c)
+{
+  int bit;
+
+  if (c->left == 0)
+    {
+      c->word = c->n ? gsl_rng_uniform_int (r, c->n) : gsl_rng_get (r) - c->min;
+      c->left = c->bits;
+    }
+
+  bit = c->word & 1UL;
+  c->word >>= 1;
+  c->left--;
+
+  return bit;
+}
+
+/* start of block i when n items are split into 2^p blocks */
+
+static inline size_t
+block_start (size_t n, int p, size_t i)
+{
+  const size_t nblocks = (size_t) 1 << p;
+  return (n / nblocks) * i + ((n % nblocks) * i >> p);
+}
+
+/* The coin-flipping phase swaps element i with element j when the coin
+   shows 1 and with itself otherwise, so there is no unpredictable
+   branch.  It is inlined separately for the common object sizes so
+   the swaps are done with fixed-size moves. */
+
+static inline size_t
+merge_flips (const gsl_rng * r, coin_t * c, char * base, const size_t size,
+             size_t i, size_t * j, const size_t end)
+{
+  size_t jj = *j;
+
+  while (i < jj && jj < end)
+    {
+      char *a = base + i * size;
+      char *b = base + jj * size;
+      const int bit = coin_flip (r, c);
+      char *q = a + (size_t) bit * (size_t) (b - a);   /* avoids a branch */
+
+      switch (size)
+        {
+        case 4:
+          SWAP_FIXED (a, q, 4);
+          break;
+        case 8:
+          SWAP_FIXED (a, q, 8);
+          break;
+        case 16:
+          SWAP_FIXED (a, q, 16);
+          break;
+        default:
+          if (bit)
+            swap (base, size, i, jj);
+        }
+
+      jj += bit;
+      i++;
+    }
+
+  *j = jj;
+  return i;
+}
+
+static void
+shuffle_merge (const gsl_rng * r, coin_t * c, char * base, size_t size,
+               size_t start, size_t mid, size_t end)
+{
+  size_t i = start, j = mid;
+
+  switch (size)
+    {
+    case 4:
+      i = merge_flips (r, c, base, 4, i, &j, end);
+      break;
+    case 8:
+      i = merge_flips (r, c, base, 8, i, &j, end);
+      break;
+    case 16:
+      i = merge_flips (r, c, base, 16, i, &j, end);
+      break;
+    default:
+      i = merge_flips (r, c, base, size, i, &j, end);
+    }
+
+  /* one of the runs is used up, finish the flips as in the paper */
+
+  for (;;)
+    {
+      if (coin_flip (r, c))
+        {
+          if (j == end)
+            break;
+          swap (base, size, i, j);
+          j++;
+        }
+      else if (i == j)
+        {
+          break;
+        }
+
+      i++;
+    }
+
+  for (; i < end; i++)
+    {
+      size_t k = start + gsl_rng_uniform_int (r, i - start + 1);
+      swap (base, size, i, k);
+    }
+}
+
+void
+gsl_ran_shuffle_merge (const gsl_rng * r, void * base, size_t n, size_t size)
+{
+  char *b = (char *) base;
+  coin_t c;
+  size_t i;
+  int p = 0, level;
+
+  while ((n >> p) * size > MERGE_BLOCK_BYTES)
+    p++;
+
+  for (i = 0; i < ((size_t) 1 << p); i++)
+    {
+      const size_t s = block_start (n, p, i);
+      const size_t e = block_start (n, p, i + 1);
+
+      if (e - s > 1)
+        gsl_ran_shuffle (r, b + s * size, e - s, size);
+    }
+
+  coin_init (r, &c);
+
+  for (level = 0; level < p; level++)
+    {
+      const size_t step = (size_t) 1 << level;
+
+      for (i = 0; i < ((size_t) 1 << p); i += 2 * step)
+        {
+          shuffle_merge (r, &c, b, size,
+                         block_start (n, p, i),
+                         block_start (n, p, i + step),
+                         block_start (n, p, i + 2 * step));
+        }
+    }
+}
+
 int
 gsl_ran_choose (const gsl_rng * r, void * dest, size_t k, void * src, 
                  size_t n, size_t size)
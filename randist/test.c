@@ -48,6 +48,9 @@ void testDiscretePDF (double (*f) (void), double (*pdf) (unsigned int),
 
 void test_shuffle (void);
 void test_choose (void);
+void test_reservoir (void);
+void test_shuffle_merge (void);
+void test_reservoir_weighted (void);
 double test_beta (void);
 double test_beta_pdf (double x);
 double test_bernoulli (void);
@@ -74,6 +77,11 @@ double test_binomial_large_knuth (void);
 double test_binomial_large_knuth_pdf (unsigned int n);
 double test_binomial_huge_knuth (void);
 double test_binomial_huge_knuth_pdf (unsigned int n);
+double test_binomial_sample (void);
+double test_binomial_sample_pdf (unsigned int n);
+double test_binomial_fill (void);
+double test_binomial_fill_pdf (unsigned int n);
+void test_binomial_workspace (void);
 
 double test_cauchy (void);
 double test_cauchy_pdf (double x);
@@ -92,6 +100,8 @@ double test_discrete2 (void);
 double test_discrete2_pdf (unsigned int n);
 double test_discrete3 (void);
 double test_discrete3_pdf (unsigned int n);
+double test_discrete_dynamic (void);
+double test_discrete_dynamic_pdf (unsigned int n);
 double test_erlang (void);
 double test_erlang_pdf (double x);
 double test_exponential (void);
@@ -144,6 +154,18 @@ double test_gaussian_ratio_method (void);
 double test_gaussian_ratio_method_pdf (double x);
 double test_gaussian_ziggurat (void);
 double test_gaussian_ziggurat_pdf (double x);
+double test_gaussian_fill (void);
+double test_gaussian_fill_pdf (double x);
+double test_exponential_fill (void);
+double test_exponential_fill_pdf (double x);
+double test_flat_fill (void);
+double test_flat_fill_pdf (double x);
+double test_gamma_fill (void);
+double test_gamma_fill_pdf (double x);
+double test_gamma_fill1 (void);
+double test_gamma_fill1_pdf (double x);
+double test_gamma_fill_small (void);
+double test_gamma_fill_small_pdf (double x);
 double test_gaussian_tail (void);
 double test_gaussian_tail_pdf (double x);
 double test_gaussian_tail1 (void);
@@ -170,6 +192,10 @@ void test_multivariate_gaussian (void);
 void test_wishart_log_pdf (void);
 void test_wishart_pdf (void);
 void test_wishart (void);
+void test_multivariate_gaussian_array (void);
+void test_multivariate_gaussian_log_pdf_array (void);
+void test_wishart_array (void);
+void test_wishart_log_pdf_array (void);
 double test_gumbel1 (void);
 double test_gumbel1_pdf (double x);
 double test_gumbel2 (void);
@@ -233,6 +259,10 @@ double test_poisson (void);
 double test_poisson_pdf (unsigned int x);
 double test_poisson_large (void);
 double test_poisson_large_pdf (unsigned int x);
+double test_poisson_sample (void);
+double test_poisson_sample_pdf (unsigned int n);
+double test_poisson_fill (void);
+double test_poisson_fill_pdf (unsigned int n);
 double test_dir2d (void);
 double test_dir2d_pdf (double x);
 double test_dir2d_trig_method (void);
@@ -263,6 +293,7 @@ gsl_rng *r_global;
 static gsl_ran_discrete_t *g1 = NULL;
 static gsl_ran_discrete_t *g2 = NULL;
 static gsl_ran_discrete_t *g3 = NULL;
+static gsl_ran_discrete_dynamic_t *gd = NULL;
 
 int
 main (void)
@@ -412,10 +443,39 @@ main (void)
   testDiscretePDF (FUNC2 (negative_binomial));
   testDiscretePDF (FUNC2 (pascal));
 
+  /* bulk samplers */
+
+  testPDF (FUNC2 (gaussian_fill));
+  testPDF (FUNC2 (exponential_fill));
+  testPDF (FUNC2 (flat_fill));
+  testPDF (FUNC2 (gamma_fill));
+  testPDF (FUNC2 (gamma_fill1));
+  testPDF (FUNC2 (gamma_fill_small));
+
+  /* dynamic discrete sampler, after changing the weights */
+
+  testDiscretePDF (FUNC2 (discrete_dynamic));
+
+  test_reservoir ();
+  test_reservoir_weighted ();
+  test_shuffle_merge ();
+
+  test_multivariate_gaussian_array ();
+  test_multivariate_gaussian_log_pdf_array ();
+  test_wishart_array ();
+  test_wishart_log_pdf_array ();
+
+  testDiscretePDF (FUNC2 (poisson_sample));
+  testDiscretePDF (FUNC2 (poisson_fill));
+  testDiscretePDF (FUNC2 (binomial_sample));
+  testDiscretePDF (FUNC2 (binomial_fill));
+  test_binomial_workspace ();
+
   gsl_rng_free (r_global);
   gsl_ran_discrete_free (g1);
   gsl_ran_discrete_free (g2);
   gsl_ran_discrete_free (g3);
+  gsl_ran_discrete_dynamic_free (gd);
 
   exit (gsl_test_summary ());
 }
@@ -509,6 +569,215 @@ test_choose (void)
 
 }
 
+void
+test_shuffle_merge (void)
+{
+  /* large enough to be split into blocks which are then merged */
+
+  const size_t n = 400000, trials = 20;
+  double *x = (double *) malloc (n * sizeof (double));
+  double count[8][8];
+  size_t i, j, t;
+  int status = 0;
+
+  for (i = 0; i < 8; i++)
+    for (j = 0; j < 8; j++)
+      count[i][j] = 0;
+
+  for (t = 0; t < trials; t++)
+    {
+      for (i = 0; i < n; i++)
+        x[i] = i;
+
+      gsl_ran_shuffle_merge (r_global, x, n, sizeof (double));
+
+      /* count moves from each eighth of the array to each eighth */
+
+      for (i = 0; i < n; i++)
+        count[(size_t) x[i] * 8 / n][i * 8 / n]++;
+    }
+
+  for (i = 0; i < 8; i++)
+    {
+      for (j = 0; j < 8; j++)
+        {
+          double expected = trials * (n / 8.0) / 8.0;
+          double d = fabs (count[i][j] - expected);
+          double sigma = d / sqrt (expected);
+          if (sigma > 5 && d > 1)
+            {
+              status = 1;
+              gsl_test (status,
+                        "gsl_ran_shuffle_merge %d,%d (%g observed vs %g expected)",
+                        i, j, count[i][j] / (trials * n / 8.0), 0.125);
+            }
+        }
+    }
+
+  gsl_test (status, "gsl_ran_shuffle_merge on %d elements", (int) n);
+
+  free (x);
+}
+
+void
+test_reservoir (void)
+{
+  const size_t trials = N / 10;
+  gsl_ran_reservoir_workspace *w = gsl_ran_reservoir_alloc (5, sizeof (int));
+  double count[100];
+  int x[100], y[5];
+  size_t i, j, n;
+  int status = 0;
+
+  for (i = 0; i < 100; i++)
+    {
+      x[i] = i;
+      count[i] = 0;
+    }
+
+  for (i = 0; i < trials; i++)
+    {
+      gsl_ran_reservoir_reset (w);
+
+      /* the first items one at a time, the rest in uneven batches */
+
+      for (j = 0; j < 7; j++)
+        gsl_ran_reservoir_add (r_global, w, &x[j]);
+
+      for (j = 7; j < 100; j += 13)
+        gsl_ran_reservoir_add_array (r_global, w, &x[j], GSL_MIN (13, 100 - j));
+
+      n = gsl_ran_reservoir_get (y, w);
+
+      status |= (n != 5) || (gsl_ran_reservoir_count (w) != 100);
+
+      for (j = 0; j < n; j++)
+        count[y[j]]++;
+    }
+
+  gsl_test (status, "gsl_ran_reservoir returns 5 items after 100");
+
+  status = 0;
+
+  for (i = 0; i < 100; i++)
+    {
+      double expected = 5.0 * trials / 100.0;
+      double d = fabs (count[i] - expected);
+      double sigma = d / sqrt (expected);
+      if (sigma > 5 && d > 1)
+        {
+          status = 1;
+          gsl_test (status,
+                    "gsl_ran_reservoir %d (%g observed vs %g expected)",
+                    i, count[i] / trials, 0.05);
+        }
+    }
+
+  gsl_test (status, "gsl_ran_reservoir (5) on {0, 1, ..., 99}");
+
+  gsl_ran_reservoir_free (w);
+}
+
+void
+test_reservoir_weighted (void)
+{
+  const size_t trials = N / 10;
+  gsl_ran_reservoir_weighted_workspace *w;
+  double count[12], weight[12];
+  int x[12], y[3];
+  size_t i, j, n;
+  int status = 0;
+
+  /* with k = 1 item i is chosen with probability weight[i]/sum */
+
+  w = gsl_ran_reservoir_weighted_alloc (1, sizeof (int));
+
+  for (i = 0; i < 12; i++)
+    {
+      x[i] = i;
+      weight[i] = (i == 3) ? 0.0 : 0.5 + i;
+      count[i] = 0;
+    }
+
+  for (i = 0; i < trials; i++)
+    {
+      gsl_ran_reservoir_weighted_reset (w);
+
+      if (i % 2)
+        {
+          gsl_ran_reservoir_weighted_add_array (r_global, w, x, weight, 12);
+        }
+      else
+        {
+          for (j = 0; j < 12; j++)
+            gsl_ran_reservoir_weighted_add (r_global, w, &x[j], weight[j]);
+        }
+
+      n = gsl_ran_reservoir_weighted_get (y, w);
+      status |= (n != 1);
+      count[y[0]]++;
+    }
+
+  for (i = 0; i < 12; i++)
+    {
+      double p = weight[i] / 68.5;
+      double expected = p * trials;
+      double d = fabs (count[i] - expected);
+      int status_i = (p == 0) ? (count[i] != 0) : (d / sqrt (expected) > 5 && d > 1);
+      status |= status_i;
+      if (status_i)
+        gsl_test (status_i,
+                  "gsl_ran_reservoir_weighted (1) %d (%g observed vs %g expected)",
+                  i, count[i] / trials, p);
+    }
+
+  gsl_test (status, "gsl_ran_reservoir_weighted (1) on weights {0.5, 1.5, ...}");
+
+  gsl_ran_reservoir_weighted_free (w);
+
+  /* with equal weights every item is included with probability k/n */
+
+  w = gsl_ran_reservoir_weighted_alloc (3, sizeof (int));
+
+  for (i = 0; i < 12; i++)
+    {
+      weight[i] = 2.0;
+      count[i] = 0;
+    }
+
+  status = 0;
+
+  for (i = 0; i < trials; i++)
+    {
+      gsl_ran_reservoir_weighted_reset (w);
+      gsl_ran_reservoir_weighted_add_array (r_global, w, x, weight, 12);
+      n = gsl_ran_reservoir_weighted_get (y, w);
+
+      status |= (n != 3);
+
+      for (j = 0; j < n; j++)
+        count[y[j]]++;
+    }
+
+  for (i = 0; i < 12; i++)
+    {
+      double expected = 3.0 * trials / 12.0;
+      double d = fabs (count[i] - expected);
+      double sigma = d / sqrt (expected);
+      if (sigma > 5 && d > 1)
+        {
+          status = 1;
+          gsl_test (status,
+                    "gsl_ran_reservoir_weighted (3) %d (%g observed vs %g expected)",
+                    i, count[i] / trials, 0.25);
+        }
+    }
+
+  gsl_test (status, "gsl_ran_reservoir_weighted (3) with equal weights");
+
+  gsl_ran_reservoir_weighted_free (w);
+}
+
 
 
 
@@ -1217,6 +1486,27 @@ test_discrete3_pdf (unsigned int n)
   return gsl_ran_discrete_pdf ((size_t) n, g3);
 }
 
+double
+test_discrete_dynamic (void)
+{
+  static double P[11] = { 1, 9, 3, 4, 5, 8, 6, 7, 2, 0, 3 };
+  if (gd == NULL)
+    {
+      gd = gsl_ran_discrete_dynamic_alloc (11, P);
+      gsl_ran_discrete_dynamic_set (gd, 1, 0.0);
+      gsl_ran_discrete_dynamic_set (gd, 9, 2.5);
+      gsl_ran_discrete_dynamic_set (gd, 4, 0.5);
+      gsl_ran_discrete_dynamic_set (gd, 10, 0.0);
+    }
+  return gsl_ran_discrete_dynamic (r_global, gd);
+}
+
+double
+test_discrete_dynamic_pdf (unsigned int n)
+{
+  return gsl_ran_discrete_dynamic_pdf ((size_t) n, gd);
+}
+
 
 double
 test_erlang (void)
@@ -1553,6 +1843,248 @@ test_gaussian_ziggurat_pdf (double x)
   return gsl_ran_gaussian_pdf (x, 3.12);
 }
 
+/* The bulk samplers are tested one value at a time through a buffer,
+   whose length is chosen not to be a multiple of their block sizes */
+
+#define FILL_N 997
+
+static double
+fill_next (void (*fill) (double x[], size_t n))
+{
+  static double buf[FILL_N];
+  static size_t pos = FILL_N;
+  static void (*last) (double x[], size_t n) = 0;
+
+  if (fill != last || pos == FILL_N)
+    {
+      fill (buf, FILL_N);
+      pos = 0;
+      last = fill;
+    }
+
+  return buf[pos++];
+}
+
+static void
+fill_gaussian (double x[], size_t n)
+{
+  gsl_ran_gaussian_fill (r_global, 3.12, x, n);
+}
+
+double
+test_gaussian_fill (void)
+{
+  return fill_next (&fill_gaussian);
+}
+
+double
+test_gaussian_fill_pdf (double x)
+{
+  return gsl_ran_gaussian_pdf (x, 3.12);
+}
+
+/* workspace samplers, small and large parameters */
+
+double
+test_poisson_sample (void)
+{
+  static gsl_ran_poisson_workspace *w = NULL;
+  if (w == NULL)
+    w = gsl_ran_poisson_alloc (5.0);
+  return gsl_ran_poisson_sample (r_global, w);
+}
+
+double
+test_poisson_sample_pdf (unsigned int n)
+{
+  return gsl_ran_poisson_pdf (n, 5.0);
+}
+
+static void
+fill_poisson (double x[], size_t n)
+{
+  static gsl_ran_poisson_workspace *w = NULL;
+  static unsigned int k[FILL_N];
+  size_t i;
+  if (w == NULL)
+    w = gsl_ran_poisson_alloc (47.5);
+  gsl_ran_poisson_fill (r_global, w, k, n);
+  for (i = 0; i < n; i++)
+    x[i] = k[i];
+}
+
+double
+test_poisson_fill (void)
+{
+  return fill_next (&fill_poisson);
+}
+
+double
+test_poisson_fill_pdf (unsigned int n)
+{
+  return gsl_ran_poisson_pdf (n, 47.5);
+}
+
+double
+test_binomial_sample (void)
+{
+  static gsl_ran_binomial_workspace *w = NULL;
+  if (w == NULL)
+    w = gsl_ran_binomial_alloc (0.3, 5);
+  return gsl_ran_binomial_sample (r_global, w);
+}
+
+double
+test_binomial_sample_pdf (unsigned int n)
+{
+  return gsl_ran_binomial_pdf (n, 0.3, 5);
+}
+
+static void
+fill_binomial (double x[], size_t n)
+{
+  static gsl_ran_binomial_workspace *w = NULL;
+  static unsigned int k[FILL_N];
+  size_t i;
+  if (w == NULL)
+    w = gsl_ran_binomial_alloc (0.7, 90);
+  gsl_ran_binomial_fill (r_global, w, k, n);
+  for (i = 0; i < n; i++)
+    x[i] = k[i];
+}
+
+double
+test_binomial_fill (void)
+{
+  return fill_next (&fill_binomial);
+}
+
+double
+test_binomial_fill_pdf (unsigned int n)
+{
+  return gsl_ran_binomial_pdf (n, 0.7, 90);
+}
+
+/* A cached binomial workspace must give the same variates as
+   gsl_ran_binomial with the same parameters. */
+void
+test_binomial_workspace (void)
+{
+  const double p[4] = { 0.1, 0.45, 0.8, 0.999 };
+  const unsigned int n[4] = { 7, 200, 5000, 100000 };
+  gsl_rng *r2 = gsl_rng_clone (r_global);
+  gsl_ran_binomial_workspace *w = gsl_ran_binomial_alloc (0.5, 1);
+  size_t i, j;
+  int status = 0;
+
+  for (i = 0; i < 4; i++)
+    {
+      gsl_ran_binomial_set (w, p[i], n[i]);
+
+      for (j = 0; j < 1000; j++)
+        {
+          unsigned int x = gsl_ran_binomial_sample (r_global, w);
+          unsigned int y = gsl_ran_binomial (r2, p[i], n[i]);
+          status |= (x != y);
+        }
+    }
+
+  gsl_test (status, "gsl_ran_binomial_sample agrees with gsl_ran_binomial");
+
+  gsl_ran_binomial_free (w);
+  gsl_rng_free (r2);
+}
+
+static void
+fill_exponential (double x[], size_t n)
+{
+  gsl_ran_exponential_fill (r_global, 2.0, x, n);
+}
+
+double
+test_exponential_fill (void)
+{
+  return fill_next (&fill_exponential);
+}
+
+double
+test_exponential_fill_pdf (double x)
+{
+  return gsl_ran_exponential_pdf (x, 2.0);
+}
+
+static void
+fill_flat (double x[], size_t n)
+{
+  gsl_ran_flat_fill (r_global, 3.0, 4.0, x, n);
+}
+
+double
+test_flat_fill (void)
+{
+  return fill_next (&fill_flat);
+}
+
+double
+test_flat_fill_pdf (double x)
+{
+  return gsl_ran_flat_pdf (x, 3.0, 4.0);
+}
+
+static void
+fill_gamma (double x[], size_t n)
+{
+  gsl_ran_gamma_fill (r_global, 2.5, 2.17, x, n);
+}
+
+double
+test_gamma_fill (void)
+{
+  return fill_next (&fill_gamma);
+}
+
+double
+test_gamma_fill_pdf (double x)
+{
+  return gsl_ran_gamma_pdf (x, 2.5, 2.17);
+}
+
+static void
+fill_gamma1 (double x[], size_t n)
+{
+  gsl_ran_gamma_fill (r_global, 1.0, 2.17, x, n);
+}
+
+double
+test_gamma_fill1 (void)
+{
+  return fill_next (&fill_gamma1);
+}
+
+double
+test_gamma_fill1_pdf (double x)
+{
+  return gsl_ran_gamma_pdf (x, 1.0, 2.17);
+}
+
+static void
+fill_gamma_small (double x[], size_t n)
+{
+  gsl_ran_gamma_fill (r_global, 0.92, 2.17, x, n);
+}
+
+double
+test_gamma_fill_small (void)
+{
+  return fill_next (&fill_gamma_small);
+}
+
+double
+test_gamma_fill_small_pdf (double x)
+{
+  return gsl_ran_gamma_pdf (x, 0.92, 2.17);
+}
+
 double
 test_gaussian_tail (void)
 {
@@ -2004,6 +2536,209 @@ test_wishart (void)
 }
 
 
+/* Draw N random vectors in one call and check the sample mean and
+ * variance-covariance matrix against the true parameters. */
+void
+test_multivariate_gaussian_array (void)
+{
+  size_t d = 2, i, j;
+  gsl_vector * mu = gsl_vector_calloc(d);
+  gsl_matrix * Sigma = gsl_matrix_calloc(d, d);
+  gsl_matrix * L = gsl_matrix_calloc(d, d);
+  gsl_matrix * samples = gsl_matrix_calloc(N, d);
+  gsl_vector * mu_hat = gsl_vector_calloc(d);
+  gsl_matrix * Sigma_hat = gsl_matrix_calloc(d, d);
+
+  gsl_vector_set(mu, 0, 1);
+  gsl_vector_set(mu, 1, 2);
+  gsl_matrix_set(Sigma, 0, 0, 4);
+  gsl_matrix_set(Sigma, 1, 1, 3);
+  gsl_matrix_set(Sigma, 0, 1, 2);
+  gsl_matrix_set(Sigma, 1, 0, 2);
+
+  gsl_matrix_memcpy(L, Sigma);
+  gsl_linalg_cholesky_decomp1(L);
+  gsl_ran_multivariate_gaussian_array(r_global, mu, L, samples);
+
+  gsl_ran_multivariate_gaussian_mean (samples, mu_hat);
+  gsl_ran_multivariate_gaussian_vcov (samples, Sigma_hat);
+
+  for (i = 0; i < d; ++i)
+    {
+      gsl_test_abs(gsl_vector_get(mu_hat, i), gsl_vector_get(mu, i), 0.05,
+                   "gsl_ran_multivariate_gaussian_array, mean %d", (int) i);
+
+      for (j = 0; j < d; ++j)
+        gsl_test_rel(gsl_matrix_get(Sigma_hat, i, j), gsl_matrix_get(Sigma, i, j),
+                     0.05, "gsl_ran_multivariate_gaussian_array, vcov %d,%d",
+                     (int) i, (int) j);
+    }
+
+  gsl_vector_free(mu);
+  gsl_matrix_free(Sigma);
+  gsl_matrix_free(L);
+  gsl_matrix_free(samples);
+  gsl_vector_free(mu_hat);
+  gsl_matrix_free(Sigma_hat);
+}
+
+/* Compare the log densities at several points with single evaluations */
+void
+test_multivariate_gaussian_log_pdf_array (void)
+{
+  const size_t d = 3, n = 5;
+  const double S[] = { 4.0, 2.0, 0.5,
+                       2.0, 3.0, -0.3,
+                       0.5, -0.3, 2.0 };
+  size_t i, j;
+  gsl_vector * mu = gsl_vector_alloc(d);
+  gsl_matrix * L = gsl_matrix_alloc(d, d);
+  gsl_matrix * X = gsl_matrix_alloc(n, d);
+  gsl_vector * res = gsl_vector_alloc(n);
+  gsl_matrix * work = gsl_matrix_alloc(n, d);
+  gsl_vector * work1 = gsl_vector_alloc(d);
+
+  for (i = 0; i < d; ++i)
+    {
+      gsl_vector_set(mu, i, 1.0 - 0.5 * i);
+      for (j = 0; j < d; ++j)
+        gsl_matrix_set(L, i, j, S[i * d + j]);
+    }
+  gsl_linalg_cholesky_decomp1(L);
+
+  for (i = 0; i < n; ++i)
+    for (j = 0; j < d; ++j)
+      gsl_matrix_set(X, i, j, sin(1.0 + i + 3.0 * j) * (i + 1.0));
+
+  gsl_ran_multivariate_gaussian_log_pdf_array(X, mu, L, res, work);
+
+  for (i = 0; i < n; ++i)
+    {
+      gsl_vector_const_view x = gsl_matrix_const_row(X, i);
+      double expected;
+      gsl_ran_multivariate_gaussian_log_pdf(&x.vector, mu, L, &expected, work1);
+      gsl_test_rel(gsl_vector_get(res, i), expected, 1.0e-12,
+                   "gsl_ran_multivariate_gaussian_log_pdf_array %d", (int) i);
+    }
+
+  gsl_vector_free(mu);
+  gsl_matrix_free(L);
+  gsl_matrix_free(X);
+  gsl_vector_free(res);
+  gsl_matrix_free(work);
+  gsl_vector_free(work1);
+}
+
+/* The batched sampler uses the random numbers in the same order as
+ * repeated calls to gsl_ran_wishart, so the results must agree. */
+void
+test_wishart_array (void)
+{
+  const size_t d = 3, k = 4;
+  const double df = 4.5;
+  const double V[] = { 2.0, 0.3, -0.4,
+                       0.3, 1.0, 0.2,
+                       -0.4, 0.2, 1.5 };
+  size_t i, j, m;
+  int status = 0;
+  gsl_rng * r2 = gsl_rng_clone(r_global);
+  gsl_matrix * L = gsl_matrix_alloc(d, d);
+  gsl_matrix * X = gsl_matrix_alloc(d, k * d);
+  gsl_matrix * work = gsl_matrix_alloc(d, k * d);
+  gsl_matrix * X1 = gsl_matrix_alloc(d, d);
+  gsl_matrix * work1 = gsl_matrix_alloc(d, d);
+
+  for (i = 0; i < d; ++i)
+    for (j = 0; j < d; ++j)
+      gsl_matrix_set(L, i, j, V[i * d + j]);
+  gsl_linalg_cholesky_decomp1(L);
+
+  gsl_ran_wishart_array(r_global, df, L, X, work);
+
+  for (m = 0; m < k; ++m)
+    {
+      gsl_ran_wishart(r2, df, L, X1, work1);
+
+      for (i = 0; i < d; ++i)
+        for (j = 0; j < d; ++j)
+          {
+            double x = gsl_matrix_get(X, i, m * d + j);
+            double y = gsl_matrix_get(X1, i, j);
+            status |= (fabs(x - y) > 1.0e-12 * (1.0 + fabs(y)));
+          }
+    }
+
+  gsl_test(status, "gsl_ran_wishart_array agrees with gsl_ran_wishart");
+
+  gsl_rng_free(r2);
+  gsl_matrix_free(L);
+  gsl_matrix_free(X);
+  gsl_matrix_free(work);
+  gsl_matrix_free(X1);
+  gsl_matrix_free(work1);
+}
+
+/* Compare the log densities of several matrices with single evaluations */
+void
+test_wishart_log_pdf_array (void)
+{
+  const size_t d = 2, k = 3;
+  const double df = 3;
+  const double Xs[3][4] = { { 2.213322, 1.453357, 1.453357, 3.285779 },
+                            { 1.0, 0.2, 0.2, 0.5 },
+                            { 4.0, -1.0, -1.0, 2.0 } };
+  size_t i, j, m;
+  gsl_matrix * L = gsl_matrix_calloc(d, d);
+  gsl_matrix * L_X = gsl_matrix_alloc(d, k * d);
+  gsl_vector * res = gsl_vector_alloc(k);
+  gsl_matrix * work = gsl_matrix_alloc(d, k * d);
+  gsl_matrix * X1 = gsl_matrix_alloc(d, d);
+  gsl_matrix * L1 = gsl_matrix_alloc(d, d);
+  gsl_matrix * work1 = gsl_matrix_alloc(d, d);
+
+  gsl_matrix_set(L, 0, 0, 1);
+  gsl_matrix_set(L, 1, 1, 1);
+  gsl_matrix_set(L, 0, 1, 0.3);
+  gsl_matrix_set(L, 1, 0, 0.3);
+  gsl_linalg_cholesky_decomp1(L);
+
+  for (m = 0; m < k; ++m)
+    {
+      gsl_matrix_view B = gsl_matrix_submatrix(L_X, 0, m * d, d, d);
+      for (i = 0; i < d; ++i)
+        for (j = 0; j < d; ++j)
+          gsl_matrix_set(&B.matrix, i, j, Xs[m][i * d + j]);
+      gsl_linalg_cholesky_decomp1(&B.matrix);
+    }
+
+  gsl_ran_wishart_log_pdf_array(L_X, df, L, res, work);
+
+  for (m = 0; m < k; ++m)
+    {
+      double expected;
+      for (i = 0; i < d; ++i)
+        for (j = 0; j < d; ++j)
+          gsl_matrix_set(X1, i, j, Xs[m][i * d + j]);
+      gsl_matrix_memcpy(L1, X1);
+      gsl_linalg_cholesky_decomp1(L1);
+      gsl_ran_wishart_log_pdf(X1, L1, df, L, &expected, work1);
+      gsl_test_rel(gsl_vector_get(res, m), expected, 1.0e-12,
+                   "gsl_ran_wishart_log_pdf_array %d", (int) m);
+    }
+
+  gsl_test_rel(gsl_vector_get(res, 0), -4.931913612377813, 1.0e-10,
+               "gsl_ran_wishart_log_pdf_array, R value");
+
+  gsl_matrix_free(L);
+  gsl_matrix_free(L_X);
+  gsl_vector_free(res);
+  gsl_matrix_free(work);
+  gsl_matrix_free(X1);
+  gsl_matrix_free(L1);
+  gsl_matrix_free(work1);
+}
+
+
 double
 test_geometric (void)
 {
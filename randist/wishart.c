@@ -218,3 +218,188 @@ gsl_ran_wishart_pdf (const gsl_matrix * X,
 
   return status;
 }
+
+/* Generate k random matrices from a Wishart distribution at once.  The
+ * Bartlett factors A_1, ..., A_k are stored side by side so that all of
+ * the products L A_i are formed by a single triangular matrix
+ * multiplication.  The random numbers are drawn in the same order as k
+ * calls to gsl_ran_wishart, so the results are identical.
+ *
+ * df      degrees of freedom
+ * L       matrix resulting from the Cholesky decomposition of
+ *         the scale matrix V = L L^T (dimension d x d)
+ * result  output matrices X_i side by side (dimension d x kd)
+ * work    matrix used for intermediate computations (dimension d x kd)
+ */
+int
+gsl_ran_wishart_array (const gsl_rng * r,
+                       const double df,
+                       const gsl_matrix * L,
+                       gsl_matrix * result,
+                       gsl_matrix * work)
+{
+  if (L->size1 != L->size2)
+    {
+      GSL_ERROR("L should be a square matrix", GSL_ENOTSQR);
+    }
+  else if (result->size1 != L->size1 || result->size2 % L->size1 != 0)
+    {
+      GSL_ERROR("incompatible dimensions of result matrix", GSL_EBADLEN);
+    }
+  else if (work->size1 != result->size1 || work->size2 != result->size2)
+    {
+      GSL_ERROR("incompatible dimensions of work matrix", GSL_EBADLEN);
+    }
+  else if (df <= L->size1 - 1)
+    {
+      GSL_ERROR("incompatible degrees of freedom", GSL_EDOM);
+    }
+  else
+    {
+      /* result: X_i = L A_i A_i^T L^T */
+
+      const size_t d = L->size1, k = result->size2 / d;
+      size_t i, j, m;
+
+      gsl_matrix_set_zero(work);
+      for (m = 0; m < k; ++m)
+        {
+          for (i = 0; i < d; ++i)
+            {
+              gsl_matrix_set(work, i, m * d + i, sqrt(gsl_ran_chisq(r, df - i)));
+
+              for (j = 0; j < i; ++j)
+                {
+                  gsl_matrix_set(work, i, m * d + j, gsl_ran_ugaussian(r));
+                }
+            }
+        }
+
+      /* compute [L A_1, ..., L A_k] */
+      gsl_blas_dtrmm(CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit, 1.0,
+                     L, work);
+
+      /* compute (L A_i) (L A_i)^T */
+      for (m = 0; m < k; ++m)
+        {
+          gsl_matrix_const_view B = gsl_matrix_const_submatrix(work, 0, m * d, d, d);
+          gsl_matrix_view X = gsl_matrix_submatrix(result, 0, m * d, d, d);
+
+          gsl_blas_dsyrk(CblasUpper, CblasNoTrans, 1.0, &B.matrix, 0.0, &X.matrix);
+          for (i = 0; i < d; ++i)
+            {
+              for (j = 0; j < i; ++j)
+                {
+                  gsl_matrix_set(&X.matrix, i, j, gsl_matrix_get(&X.matrix, j, i));
+                }
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* Compute the log of the probability density function at k quantile
+ * matrices at once, given their Cholesky factors.  With X_i = L_i L_i^T
+ * the trace term is tr(V^(-1) X_i) = ||L^(-1) L_i||_F^2, so all of the
+ * traces come from one triangular solve, and the terms which depend only
+ * on the scale matrix are computed once.
+ *
+ * L_X     Cholesky factors L_i of the quantile matrices side by side, only
+ *         the lower triangle of each is used (dimension d x kd)
+ * df      degrees of freedom
+ * L       matrix resulting from the Cholesky decomposition of
+ *         the scale matrix V = L L^T (dimension d x d)
+ * result  output vector of log densities (dimension k)
+ * work    matrix used for intermediate computations (dimension d x kd)
+ */
+int
+gsl_ran_wishart_log_pdf_array (const gsl_matrix * L_X,
+                               const double df,
+                               const gsl_matrix * L,
+                               gsl_vector * result,
+                               gsl_matrix * work)
+{
+  if (L->size1 != L->size2)
+    {
+      GSL_ERROR("L should be a square matrix", GSL_ENOTSQR);
+    }
+  else if (L_X->size1 != L->size1 || L_X->size2 % L->size1 != 0)
+    {
+      GSL_ERROR("incompatible dimensions of L_X matrix", GSL_EBADLEN);
+    }
+  else if (result->size * L->size1 != L_X->size2)
+    {
+      GSL_ERROR("incompatible dimension of result vector", GSL_EBADLEN);
+    }
+  else if (work->size1 != L_X->size1 || work->size2 != L_X->size2)
+    {
+      GSL_ERROR("incompatible dimensions of work matrix", GSL_EBADLEN);
+    }
+  else if (df <= L->size1 - 1)
+    {
+      GSL_ERROR("incompatible degrees of freedom", GSL_EDOM);
+    }
+  else
+    {
+      const size_t d = L->size1, k = result->size;
+      size_t i, j, m;
+      double log_mv_Ga, log_det_V, c;
+
+      /* compute the log of the multivariate Gamma */
+      log_mv_Ga = d * (d-1) * 0.25 * log(M_PI);
+      for (i = 0; i < d; ++i)
+        {
+          log_mv_Ga += gsl_sf_lngamma((df - i + 1) * 0.5);
+        }
+
+      /* compute the log of the determinant of the scale matrix */
+      log_det_V = 0.0;
+      for (i = 0; i < d; ++i)
+        {
+          log_det_V += log(gsl_matrix_get(L, i, i));
+        }
+      log_det_V = 2 * log_det_V;
+
+      c = - (0.5 * df * d) * log(2.0) - (0.5 * df) * log_det_V - log_mv_Ga;
+
+      /* copy the lower triangles of the L_i */
+      for (i = 0; i < d; ++i)
+        {
+          for (m = 0; m < k; ++m)
+            {
+              for (j = 0; j < d; ++j)
+                {
+                  double Lij = (j <= i) ? gsl_matrix_get(L_X, i, m * d + j) : 0.0;
+                  gsl_matrix_set(work, i, m * d + j, Lij);
+                }
+            }
+        }
+
+      /* compute [L^(-1) L_1, ..., L^(-1) L_k] */
+      gsl_blas_dtrsm(CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit, 1.0,
+                     L, work);
+
+      for (m = 0; m < k; ++m)
+        {
+          double log_det_X = 0.0, tr_Vinv_X = 0.0;
+
+          for (i = 0; i < d; ++i)
+            {
+              log_det_X += log(gsl_matrix_get(L_X, i, m * d + i));
+
+              for (j = 0; j <= i; ++j)
+                {
+                  double y = gsl_matrix_get(work, i, m * d + j);
+                  tr_Vinv_X += y * y;
+                }
+            }
+          log_det_X = 2 * log_det_X;
+
+          gsl_vector_set(result, m, c + 0.5 * (df - d - 1) * log_det_X
+                                      - 0.5 * tr_Vinv_X);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
@@ -26,8 +26,10 @@
 void benchmark (const gsl_rng_type * T);
 
 #define N  1000000
+#define NBUF 4096
 int isum;
 double dsum;
+double buf[NBUF];
 
 int
 main (void)
@@ -46,6 +48,7 @@ main (void)
   benchmark(gsl_rng_minstd);
   benchmark(gsl_rng_mrg);
   benchmark(gsl_rng_mt19937);
+  benchmark(gsl_rng_philox4x32);
   benchmark(gsl_rng_r250);
   benchmark(gsl_rng_ran0);
   benchmark(gsl_rng_ran1);
@@ -84,6 +87,7 @@ main (void)
   benchmark(gsl_rng_slatec);
   benchmark(gsl_rng_taus);
   benchmark(gsl_rng_taus113);
+  benchmark(gsl_rng_threefry4x32);
   benchmark(gsl_rng_transputer);
   benchmark(gsl_rng_tt800);
   benchmark(gsl_rng_uni);
@@ -99,8 +103,8 @@ void
 benchmark (const gsl_rng_type * T)
 {
   int start, end;
-  int i = 0, d = 0 ;
-  double t1, t2;
+  int i = 0, d = 0, b = 0 ;
+  double t1, t2, t3;
 
   gsl_rng *r = gsl_rng_alloc (T);
 
@@ -132,9 +136,23 @@ benchmark (const gsl_rng_type * T)
 
   t2 = (end - start) / (double) CLOCKS_PER_SEC;
 
+  start = clock ();
+  do
+    {
+      int j;
+      gsl_rng_uniform_fill (r, buf, NBUF);
+      for (j = 0; j < NBUF; j++)
+        dsum += buf[j];
+
+      b += NBUF;
+      end = clock ();
+    }
+  while (end < start + CLOCKS_PER_SEC/10);
+
+  t3 = (end - start) / (double) CLOCKS_PER_SEC;
 
-  printf ("%6.0f k ints/sec, %6.0f k doubles/sec, %s\n",
-          i / t1 / 1000.0, d / t2 / 1000.0, gsl_rng_name (r));
+  printf ("%6.0f k ints/sec, %6.0f k doubles/sec, %6.0f k doubles/sec (fill), %s\n",
+          i / t1 / 1000.0, d / t2 / 1000.0, b / t3 / 1000.0, gsl_rng_name (r));
 
   gsl_rng_free (r);
 }
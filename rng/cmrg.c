@@ -21,6 +21,8 @@
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
 
+#include "schrage.c"
+
 /* This is a combined multiple recursive generator. The sequence is,
 
    z_n = (x_n - y_n) mod m1
@@ -74,6 +76,7 @@
 static inline unsigned long int cmrg_get (void *vstate);
 static double cmrg_get_double (void *vstate);
 static void cmrg_set (void *state, unsigned long int s);
+static void cmrg_jump (void *state, unsigned long int n);
 
 static const long int m1 = 2147483647, m2 = 2145483479;
 
@@ -185,6 +188,51 @@ cmrg_set (void *vstate, unsigned long int s)
   cmrg_get (state);
 }
 
+static void
+cmrg_jump (void *vstate, unsigned long int n)
+{
+  cmrg_state_t *state = (cmrg_state_t *) vstate;
+
+  /* companion matrices of the two components, with the negative
+     coefficients a3 and b3 reduced modulo m1 and m2 */
+
+  static const unsigned long int A[9] = {
+    0, 63308, 2147483647UL - 183326,
+    1, 0, 0,
+    0, 1, 0
+  };
+
+  static const unsigned long int B[9] = {
+    86098, 0, 2145483479UL - 539608,
+    1, 0, 0,
+    0, 1, 0
+  };
+
+  const unsigned long int sqrtm1 = 46341;  /* ceil(sqrt(m1)) */
+  const unsigned long int sqrtm2 = 46320;  /* ceil(sqrt(m2)) */
+
+  unsigned long int x[3], y[3];
+
+  x[0] = state->x1;
+  x[1] = state->x2;
+  x[2] = state->x3;
+
+  y[0] = state->y1;
+  y[1] = state->y2;
+  y[2] = state->y3;
+
+  schrage_matrix_jump (A, 3, n, m1, sqrtm1, x);
+  schrage_matrix_jump (B, 3, n, m2, sqrtm2, y);
+
+  state->x1 = x[0];
+  state->x2 = x[1];
+  state->x3 = x[2];
+
+  state->y1 = y[0];
+  state->y2 = y[1];
+  state->y3 = y[2];
+}
+
 static const gsl_rng_type cmrg_type =
 {"cmrg",                        /* name */
  2147483646,                    /* RAND_MAX */
@@ -192,6 +240,10 @@ static const gsl_rng_type cmrg_type =
  sizeof (cmrg_state_t),
  &cmrg_set,
  &cmrg_get,
- &cmrg_get_double};
+ &cmrg_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ &cmrg_jump,
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_cmrg = &cmrg_type;
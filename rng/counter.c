@@ -0,0 +1,155 @@
+/* rng/counter.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Common code for counter-based generators (Salmon et al, "Parallel
+   Random Numbers: As Easy as 1, 2, 3", SC11).  The n-th output is
+   word n%4 of block_function(key, counter = n/4), where the counter is
+   a 128-bit integer held in four 32-bit words, least significant
+   first.  Since the outputs depend only on the counter, skipping ahead
+   is O(1) and distinct keys give independent streams.
+
+   All words are 32-bit values held in unsigned long ints, so the code
+   works when unsigned long is 32 bits wide. */
+
+#define CTR_MASK 0xffffffffUL
+
+typedef void counter_block_fn (const unsigned long int ctr[4],
+                               const unsigned long int key[4],
+                               unsigned long int out[4]);
+
+typedef struct
+  {
+    unsigned long int ctr[4];   /* counter of the current block */
+    unsigned long int key[4];   /* key, unused words are zero */
+    unsigned long int out[4];   /* current block of output */
+    unsigned int pos;           /* next word of out, 4 if used up */
+  }
+counter_state_t;
+
+/* add (hi * 2^32 + lo) to the 128-bit counter, lo and hi < 2^32 */
+static inline void
+counter_add (unsigned long int ctr[4], unsigned long int lo, unsigned long int hi)
+{
+  unsigned long int t, carry;
+  int i;
+
+  t = (ctr[0] + lo) & CTR_MASK;
+  carry = (t < lo);
+  ctr[0] = t;
+
+  t = (ctr[1] + hi) & CTR_MASK;
+  i = (t < hi);
+  ctr[1] = (t + carry) & CTR_MASK;
+  carry = i + (ctr[1] < carry);
+
+  for (i = 2; i < 4 && carry; i++)
+    {
+      ctr[i] = (ctr[i] + 1) & CTR_MASK;
+      carry = (ctr[i] == 0);
+    }
+}
+
+static inline void
+counter_set (counter_state_t * state, counter_block_fn * block,
+             unsigned long int seed, unsigned long int stream,
+             const int nkey)
+{
+  /* The seed fills the first two key words; the stream number goes into
+     the remaining key words if the generator has them, or otherwise
+     into the upper half of the counter. The shifts are split so they
+     are defined when unsigned long is 32 bits. */
+
+  const unsigned long int seed_hi = (seed >> 16) >> 16;
+  const unsigned long int stream_hi = (stream >> 16) >> 16;
+
+  state->key[0] = seed & CTR_MASK;
+  state->key[1] = seed_hi & CTR_MASK;
+  state->key[2] = 0;
+  state->key[3] = 0;
+
+  state->ctr[0] = 0;
+  state->ctr[1] = 0;
+  state->ctr[2] = 0;
+  state->ctr[3] = 0;
+
+  if (nkey == 4)
+    {
+      state->key[2] = stream & CTR_MASK;
+      state->key[3] = stream_hi & CTR_MASK;
+    }
+  else
+    {
+      state->ctr[2] = stream & CTR_MASK;
+      state->ctr[3] = stream_hi & CTR_MASK;
+    }
+
+  (*block) (state->ctr, state->key, state->out);
+  state->pos = 0;
+}
+
+static inline unsigned long int
+counter_get (counter_state_t * state, counter_block_fn * block)
+{
+  if (state->pos == 4)
+    {
+      counter_add (state->ctr, 1, 0);
+      (*block) (state->ctr, state->key, state->out);
+      state->pos = 0;
+    }
+
+  return state->out[state->pos++];
+}
+
+static inline void
+counter_fill (counter_state_t * state, counter_block_fn * block,
+              unsigned long int x[], size_t n)
+{
+  size_t i = 0;
+
+  /* use up the current block */
+  while (i < n && state->pos < 4)
+    x[i++] = state->out[state->pos++];
+
+  /* whole blocks are written straight to the output */
+  while (n - i >= 4)
+    {
+      counter_add (state->ctr, 1, 0);
+      (*block) (state->ctr, state->key, x + i);
+      i += 4;
+    }
+
+  while (i < n)
+    x[i++] = counter_get (state, block);
+}
+
+static inline void
+counter_jump (counter_state_t * state, counter_block_fn * block,
+              unsigned long int n)
+{
+  const unsigned long int r = state->pos + (n % 4);
+  const unsigned long int blocks = n / 4 + r / 4;
+
+  if (blocks > 0)
+    {
+      counter_add (state->ctr, blocks & CTR_MASK, ((blocks >> 16) >> 16) & CTR_MASK);
+      (*block) (state->ctr, state->key, state->out);
+    }
+
+  state->pos = r % 4;
+}
@@ -44,6 +44,7 @@
 static inline unsigned long int ran_get (void *vstate);
 static double ran_get_double (void *vstate);
 static void ran_set (void *state, unsigned long int s);
+static void ran_jump (void *state, unsigned long int n);
 
 typedef struct
 {
@@ -82,6 +83,15 @@ ran_set (void *vstate, unsigned long int s)
   return;
 }
 
+static void
+ran_jump (void *vstate, unsigned long int n)
+{
+  ran_state_t *state = (ran_state_t *) vstate;
+
+  state->x = schrage_mult (schrage_pow (AA, n, MM, CEIL_SQRT_MM), state->x,
+                           MM, CEIL_SQRT_MM);
+}
+
 static const gsl_rng_type ran_type = {
   "fishman18",                  /* name */
   MM - 1,                       /* RAND_MAX */
@@ -89,7 +99,11 @@ static const gsl_rng_type ran_type = {
   sizeof (ran_state_t),
   &ran_set,
   &ran_get,
-  &ran_get_double
+  &ran_get_double,
+  0,                            /* get_fill */
+  0,                            /* get_double_fill */
+  &ran_jump,
+  0                             /* set_stream */
 };
 
 const gsl_rng_type *gsl_rng_fishman18 = &ran_type;
@@ -35,9 +35,12 @@
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
 
+#include "schrage.c"
+
 static inline unsigned long int ran_get (void *vstate);
 static double ran_get_double (void *vstate);
 static void ran_set (void *state, unsigned long int s);
+static void ran_jump (void *state, unsigned long int n);
 
 static const long int m = 2147483647, a = 48271, q = 44488, r = 3399;
 
@@ -90,6 +93,16 @@ ran_set (void *vstate, unsigned long int s)
   return;
 }
 
+static void
+ran_jump (void *vstate, unsigned long int n)
+{
+  ran_state_t *state = (ran_state_t *) vstate;
+
+  const unsigned long int sqrtm = 46341;  /* ceil(sqrt(m)) */
+
+  state->x = schrage_mult (schrage_pow (a, n, m, sqrtm), state->x, m, sqrtm);
+}
+
 static const gsl_rng_type ran_type = {
   "fishman20",                  /* name */
   2147483646,                   /* RAND_MAX */
@@ -97,7 +110,11 @@ static const gsl_rng_type ran_type = {
   sizeof (ran_state_t),
   &ran_set,
   &ran_get,
-  &ran_get_double
+  &ran_get_double,
+  0,                            /* get_fill */
+  0,                            /* get_double_fill */
+  &ran_jump,
+  0                             /* set_stream */
 };
 
 const gsl_rng_type *gsl_rng_fishman20 = &ran_type;
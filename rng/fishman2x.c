@@ -115,7 +115,11 @@ static const gsl_rng_type ran_type = {
   sizeof (ran_state_t),
   &ran_set,
   &ran_get,
-  &ran_get_double
+  &ran_get_double,
+  0,                            /* get_fill */
+  0,                            /* get_double_fill */
+  0,                            /* jump */
+  0                             /* set_stream */
 };
 
 const gsl_rng_type *gsl_rng_fishman2x = &ran_type;
@@ -157,6 +157,9 @@ static const gsl_rng_type g05faf_type =
  &g05faf_set,
  &g05faf_get,
  &g05faf_get_double
-};
+,
+ 0,                             /* get_double_fill */
+ 0,                             /* jump */
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_g05faf = &g05faf_type;
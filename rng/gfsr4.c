@@ -54,6 +54,8 @@
 
 static inline unsigned long int gfsr4_get (void *vstate);
 static double gfsr4_get_double (void *vstate);
+static void gfsr4_get_fill (void *vstate, unsigned long int x[], size_t n);
+static void gfsr4_get_double_fill (void *vstate, double x[], size_t n);
 static void gfsr4_set (void *state, unsigned long int s);
 
 /* Magic numbers */
@@ -91,6 +93,44 @@ gfsr4_get_double (void * vstate)
   return gfsr4_get (vstate) / 4294967296.0 ;
 }
 
+static void
+gfsr4_get_fill (void *vstate, unsigned long int x[], size_t n)
+{
+  gfsr4_state_t *state = (gfsr4_state_t *) vstate;
+  unsigned long *const ra = state->ra;
+  int nd = state->nd;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      nd = (nd + 1) & M;
+      x[i] = ra[nd] = ra[(nd + (M+1-A)) & M] ^ ra[(nd + (M+1-B)) & M]
+        ^ ra[(nd + (M+1-C)) & M] ^ ra[(nd + (M+1-D)) & M];
+    }
+
+  state->nd = nd;
+}
+
+static void
+gfsr4_get_double_fill (void *vstate, double x[], size_t n)
+{
+  gfsr4_state_t *state = (gfsr4_state_t *) vstate;
+  unsigned long *const ra = state->ra;
+  int nd = state->nd;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      unsigned long k;
+      nd = (nd + 1) & M;
+      k = ra[nd] = ra[(nd + (M+1-A)) & M] ^ ra[(nd + (M+1-B)) & M]
+        ^ ra[(nd + (M+1-C)) & M] ^ ra[(nd + (M+1-D)) & M];
+      x[i] = k / 4294967296.0;
+    }
+
+  state->nd = nd;
+}
+
 static void
 gfsr4_set (void *vstate, unsigned long int s)
 {
@@ -155,7 +195,11 @@ static const gsl_rng_type gfsr4_type =
  sizeof (gfsr4_state_t),
  &gfsr4_set,
  &gfsr4_get,
- &gfsr4_get_double};
+ &gfsr4_get_double,
+ &gfsr4_get_fill,
+ &gfsr4_get_double_fill,
+ 0,                             /* jump */
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_gfsr4 = &gfsr4_type;
 
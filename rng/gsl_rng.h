@@ -45,10 +45,14 @@ typedef struct
     void (*set) (void *state, unsigned long int seed);
     unsigned long int (*get) (void *state);
     double (*get_double) (void *state);
+    void (*get_fill) (void *state, unsigned long int x[], size_t n);
+    void (*get_double_fill) (void *state, double x[], size_t n);
+    void (*jump) (void *state, unsigned long int n);
+    void (*set_stream) (void *state, unsigned long int seed, unsigned long int stream);
   }
 gsl_rng_type;
 
-typedef struct
+typedef struct gsl_rng_struct
   {
     const gsl_rng_type * type;
     void *state;
@@ -75,6 +79,7 @@ GSL_VAR const gsl_rng_type *gsl_rng_mrg;
 GSL_VAR const gsl_rng_type *gsl_rng_mt19937;
 GSL_VAR const gsl_rng_type *gsl_rng_mt19937_1999;
 GSL_VAR const gsl_rng_type *gsl_rng_mt19937_1998;
+GSL_VAR const gsl_rng_type *gsl_rng_philox4x32;
 GSL_VAR const gsl_rng_type *gsl_rng_r250;
 GSL_VAR const gsl_rng_type *gsl_rng_ran0;
 GSL_VAR const gsl_rng_type *gsl_rng_ran1;
@@ -114,6 +119,7 @@ GSL_VAR const gsl_rng_type *gsl_rng_slatec;
 GSL_VAR const gsl_rng_type *gsl_rng_taus;
 GSL_VAR const gsl_rng_type *gsl_rng_taus2;
 GSL_VAR const gsl_rng_type *gsl_rng_taus113;
+GSL_VAR const gsl_rng_type *gsl_rng_threefry4x32;
 GSL_VAR const gsl_rng_type *gsl_rng_transputer;
 GSL_VAR const gsl_rng_type *gsl_rng_tt800;
 GSL_VAR const gsl_rng_type *gsl_rng_uni;
@@ -146,6 +152,13 @@ void * gsl_rng_state (const gsl_rng * r);
 
 void gsl_rng_print_state (const gsl_rng * r);
 
+void gsl_rng_get_fill (const gsl_rng * r, unsigned long int x[], const size_t n);
+void gsl_rng_uniform_fill (const gsl_rng * r, double x[], const size_t n);
+
+int gsl_rng_jump (const gsl_rng * r, unsigned long int n);
+int gsl_rng_set_stream (const gsl_rng * r, unsigned long int seed,
+                        unsigned long int stream);
+
 const gsl_rng_type * gsl_rng_env_setup (void);
 
 INLINE_DECL unsigned long int gsl_rng_get (const gsl_rng * r);
@@ -0,0 +1,172 @@
+/* rng/jump.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Helper functions for jumping ahead in generators whose transition
+   function is linear.  A jump of n steps is done by raising the
+   transition to the n-th power by repeated squaring, in O(log n)
+   operations.  For generators with a prime modulus see schrage_pow
+   and schrage_matrix_jump in schrage.c. */
+
+static inline unsigned long int
+lcg_jump (unsigned long int x, unsigned long int a, unsigned long int c,
+          unsigned long int n, const unsigned long int mask)
+{
+  /* Apply n steps of x -> (a x + c) mod 2^k to x, where mask = 2^k - 1
+   * and k <= 32.  The composition of two steps is the map
+   * x -> (a^2 x + (a + 1) c), so the multiplier and increment are
+   * squared together.  Only the low k bits of each product are needed,
+   * which are correct whether unsigned long is 32 or 64 bits wide.
+   */
+  while (n > 0)
+    {
+      if (n & 1UL)
+        x = (a * x + c) & mask;
+      c = ((a + 1) * c) & mask;
+      a = (a * a) & mask;
+      n >>= 1;
+    }
+  return x;
+}
+
+static inline void
+lcg48_mult (unsigned long int r[3], const unsigned long int a[3],
+            const unsigned long int b[3])
+{
+  /* r = a b mod 2^48, where the numbers are stored as three 16-bit
+   * digits, least significant first.  The partial products are summed
+   * in separate low and high halves so that nothing overflows 32 bits.
+   */
+  unsigned long int p[3];
+  unsigned long int carry = 0;
+  size_t k;
+
+  for (k = 0; k < 3; k++)
+    {
+      unsigned long int lo = carry, hi = 0;
+      size_t i;
+
+      for (i = 0; i <= k; i++)
+        {
+          const unsigned long int t = a[i] * b[k - i];
+          lo += t & 0xffffUL;
+          hi += (t >> 16) & 0xffffUL;
+        }
+
+      p[k] = lo & 0xffffUL;
+      carry = (lo >> 16) + hi;
+    }
+
+  r[0] = p[0];
+  r[1] = p[1];
+  r[2] = p[2];
+}
+
+static inline void
+lcg48_add (unsigned long int r[3], const unsigned long int a[3],
+           const unsigned long int b[3])
+{
+  /* r = a + b mod 2^48 */
+  unsigned long int carry = 0;
+  size_t k;
+
+  for (k = 0; k < 3; k++)
+    {
+      const unsigned long int t = a[k] + b[k] + carry;
+      r[k] = t & 0xffffUL;
+      carry = t >> 16;
+    }
+}
+
+static inline void
+lcg48_jump (unsigned long int x[3], const unsigned long int a0[3],
+            const unsigned long int c0[3], unsigned long int n)
+{
+  /* Apply n steps of x -> (a x + c) mod 2^48 to x, as in lcg_jump */
+  static const unsigned long int one[3] = { 1, 0, 0 };
+  unsigned long int a[3], c[3], t[3];
+
+  a[0] = a0[0]; a[1] = a0[1]; a[2] = a0[2];
+  c[0] = c0[0]; c[1] = c0[1]; c[2] = c0[2];
+
+  while (n > 0)
+    {
+      if (n & 1UL)
+        {
+          lcg48_mult (t, a, x);
+          lcg48_add (x, t, c);
+        }
+
+      lcg48_add (t, a, one);
+      lcg48_mult (c, t, c);
+      lcg48_mult (a, a, a);
+      n >>= 1;
+    }
+}
+
+/* A linear map of 32-bit words over GF(2), stored as the images of the
+   32 unit vectors */
+
+typedef unsigned long int f2_matrix[32];
+
+static inline unsigned long int
+f2_apply (const f2_matrix A, unsigned long int x)
+{
+  unsigned long int y = 0;
+  size_t j;
+
+  for (j = 0; j < 32 && x != 0; j++, x >>= 1)
+    {
+      if (x & 1UL)
+        y ^= A[j];
+    }
+
+  return y;
+}
+
+static inline unsigned long int
+f2_jump (const f2_matrix A, unsigned long int n, unsigned long int x)
+{
+  /* Return A^n x.  The powers of A commute, so x can be multiplied by
+   * A^(2^i) for each set bit i of n in any order.
+   */
+  f2_matrix P, T;
+  size_t j;
+
+  for (j = 0; j < 32; j++)
+    P[j] = A[j];
+
+  while (n > 0)
+    {
+      if (n & 1UL)
+        x = f2_apply (P, x);
+
+      n >>= 1;
+
+      if (n == 0)
+        break;
+
+      for (j = 0; j < 32; j++)
+        T[j] = f2_apply (P, P[j]);
+
+      for (j = 0; j < 32; j++)
+        P[j] = T[j];
+    }
+
+  return x;
+}
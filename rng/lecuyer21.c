@@ -33,6 +33,8 @@
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
 
+#include "schrage.c"
+
 #define AAA 40692
 #define MMM 2147483399UL
 #define QQQ 52774
@@ -41,6 +43,7 @@
 static inline unsigned long int ran_get (void *vstate);
 static double ran_get_double (void *vstate);
 static void ran_set (void *state, unsigned long int s);
+static void ran_jump (void *state, unsigned long int n);
 
 typedef struct
 {
@@ -86,6 +89,16 @@ ran_set (void *vstate, unsigned long int s)
   return;
 }
 
+static void
+ran_jump (void *vstate, unsigned long int n)
+{
+  ran_state_t *state = (ran_state_t *) vstate;
+
+  const unsigned long int sqrtm = 46341;  /* ceil(sqrt(MMM)) */
+
+  state->x = schrage_mult (schrage_pow (AAA, n, MMM, sqrtm), state->x, MMM, sqrtm);
+}
+
 static const gsl_rng_type ran_type = {
   "lecuyer21",                  /* name */
   MMM-1,                        /* RAND_MAX */
@@ -93,7 +106,11 @@ static const gsl_rng_type ran_type = {
   sizeof (ran_state_t),
   &ran_set,
   &ran_get,
-  &ran_get_double
+  &ran_get_double,
+  0,                            /* get_fill */
+  0,                            /* get_double_fill */
+  &ran_jump,
+  0                             /* set_stream */
 };
 
 const gsl_rng_type *gsl_rng_lecuyer21 = &ran_type;
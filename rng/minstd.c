@@ -21,6 +21,8 @@
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
 
+#include "schrage.c"
+
 /* MINSTD is Park and Miller's minimal standard generator (i.e. it's
    not particularly good).
 
@@ -47,6 +49,7 @@
 static inline unsigned long int minstd_get (void *vstate);
 static double minstd_get_double (void *vstate);
 static void minstd_set (void *state, unsigned long int s);
+static void minstd_jump (void *state, unsigned long int n);
 
 static const long int m = 2147483647, a = 16807, q = 127773, r = 2836;
 
@@ -97,6 +100,16 @@ minstd_set (void *vstate, unsigned long int s)
   return;
 }
 
+static void
+minstd_jump (void *vstate, unsigned long int n)
+{
+  minstd_state_t *state = (minstd_state_t *) vstate;
+
+  const unsigned long int sqrtm = 46341;  /* ceil(sqrt(m)) */
+
+  state->x = schrage_mult (schrage_pow (a, n, m, sqrtm), state->x, m, sqrtm);
+}
+
 static const gsl_rng_type minstd_type =
 {"minstd",                      /* name */
  2147483646,                    /* RAND_MAX */
@@ -104,6 +117,10 @@ static const gsl_rng_type minstd_type =
  sizeof (minstd_state_t),
  &minstd_set,
  &minstd_get,
- &minstd_get_double};
+ &minstd_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ &minstd_jump,
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_minstd = &minstd_type;
@@ -21,6 +21,8 @@
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
 
+#include "schrage.c"
+
 /* This is a fifth-order multiple recursive generator. The sequence is,
 
    x_n = (a_1 x_{n-1} + a_5 x_{n-5}) mod m
@@ -53,6 +55,7 @@
 static inline unsigned long int mrg_get (void *vstate);
 static double mrg_get_double (void *vstate);
 static void mrg_set (void *state, unsigned long int s);
+static void mrg_jump (void *state, unsigned long int n);
 
 static const long int m = 2147483647;
 static const long int a1 = 107374182, q1 = 20, r1 = 7;
@@ -137,6 +140,40 @@ mrg_set (void *vstate, unsigned long int s)
   return;
 }
 
+static void
+mrg_jump (void *vstate, unsigned long int n)
+{
+  mrg_state_t *state = (mrg_state_t *) vstate;
+
+  /* companion matrix of the recurrence acting on (x1, ..., x5) */
+
+  static const unsigned long int A[25] = {
+    107374182, 0, 0, 0, 104480,
+    1, 0, 0, 0, 0,
+    0, 1, 0, 0, 0,
+    0, 0, 1, 0, 0,
+    0, 0, 0, 1, 0
+  };
+
+  const unsigned long int sqrtm = 46341;  /* ceil(sqrt(m)) */
+
+  unsigned long int x[5];
+
+  x[0] = state->x1;
+  x[1] = state->x2;
+  x[2] = state->x3;
+  x[3] = state->x4;
+  x[4] = state->x5;
+
+  schrage_matrix_jump (A, 5, n, m, sqrtm, x);
+
+  state->x1 = x[0];
+  state->x2 = x[1];
+  state->x3 = x[2];
+  state->x4 = x[3];
+  state->x5 = x[4];
+}
+
 static const gsl_rng_type mrg_type =
 {"mrg",                         /* name */
  2147483646,                    /* RAND_MAX */
@@ -144,6 +181,10 @@ static const gsl_rng_type mrg_type =
  sizeof (mrg_state_t),
  &mrg_set,
  &mrg_get,
- &mrg_get_double};
+ &mrg_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ &mrg_jump,
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_mrg = &mrg_type;
@@ -57,7 +57,10 @@
 
 static inline unsigned long int mt_get (void *vstate);
 static double mt_get_double (void *vstate);
+static void mt_get_fill (void *vstate, unsigned long int x[], size_t n);
+static void mt_get_double_fill (void *vstate, double x[], size_t n);
 static void mt_set (void *state, unsigned long int s);
+static void mt_jump (void *state, unsigned long int n);
 
 #define N 624   /* Period parameters */
 #define M 397
@@ -75,6 +78,39 @@ typedef struct
   }
 mt_state_t;
 
+#define MAGIC(y) (((y)&0x1) ? 0x9908b0dfUL : 0)
+
+/* Tempering */
+
+#define TEMPER(k) do {                          \
+    k ^= (k >> 11);                             \
+    k ^= (k << 7) & 0x9d2c5680UL;               \
+    k ^= (k << 15) & 0xefc60000UL;              \
+    k ^= (k >> 18);                             \
+  } while (0)
+
+static inline void
+mt_generate (unsigned long int *const mt)
+{   /* generate N words at one time */
+  int kk;
+
+  for (kk = 0; kk < N - M; kk++)
+    {
+      unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
+      mt[kk] = mt[kk + M] ^ (y >> 1) ^ MAGIC(y);
+    }
+  for (; kk < N - 1; kk++)
+    {
+      unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
+      mt[kk] = mt[kk + (M - N)] ^ (y >> 1) ^ MAGIC(y);
+    }
+
+  {
+    unsigned long y = (mt[N - 1] & UPPER_MASK) | (mt[0] & LOWER_MASK);
+    mt[N - 1] = mt[M - 1] ^ (y >> 1) ^ MAGIC(y);
+  }
+}
+
 static inline unsigned long
 mt_get (void *vstate)
 {
@@ -83,38 +119,14 @@ mt_get (void *vstate)
   unsigned long k ;
   unsigned long int *const mt = state->mt;
 
-#define MAGIC(y) (((y)&0x1) ? 0x9908b0dfUL : 0)
-
   if (state->mti >= N)
-    {   /* generate N words at one time */
-      int kk;
-
-      for (kk = 0; kk < N - M; kk++)
-        {
-          unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
-          mt[kk] = mt[kk + M] ^ (y >> 1) ^ MAGIC(y);
-        }
-      for (; kk < N - 1; kk++)
-        {
-          unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
-          mt[kk] = mt[kk + (M - N)] ^ (y >> 1) ^ MAGIC(y);
-        }
-
-      {
-        unsigned long y = (mt[N - 1] & UPPER_MASK) | (mt[0] & LOWER_MASK);
-        mt[N - 1] = mt[M - 1] ^ (y >> 1) ^ MAGIC(y);
-      }
-
+    {
+      mt_generate (mt);
       state->mti = 0;
     }
 
-  /* Tempering */
-  
   k = mt[state->mti];
-  k ^= (k >> 11);
-  k ^= (k << 7) & 0x9d2c5680UL;
-  k ^= (k << 15) & 0xefc60000UL;
-  k ^= (k >> 18);
+  TEMPER (k);
 
   state->mti++;
 
@@ -127,6 +139,291 @@ mt_get_double (void * vstate)
   return mt_get (vstate) / 4294967296.0 ;
 }
 
+/* The bulk versions temper a whole run of the state vector at a time
+   and regenerate the state in one pass when it is exhausted.  The
+   inner loops have no dependencies between iterations so the compiler
+   can vectorize them. */
+
+static void
+mt_get_fill (void *vstate, unsigned long int x[], size_t n)
+{
+  mt_state_t *state = (mt_state_t *) vstate;
+  unsigned long int *const mt = state->mt;
+  size_t i = 0;
+
+  while (i < n)
+    {
+      const unsigned long int *src;
+      size_t j, m;
+
+      if (state->mti >= N)
+        {
+          mt_generate (mt);
+          state->mti = 0;
+        }
+
+      m = N - state->mti;
+
+      if (m > n - i)
+        m = n - i;
+
+      src = mt + state->mti;
+
+      for (j = 0; j < m; j++)
+        {
+          unsigned long k = src[j];
+          TEMPER (k);
+          x[i + j] = k;
+        }
+
+      state->mti += m;
+      i += m;
+    }
+}
+
+static void
+mt_get_double_fill (void *vstate, double x[], size_t n)
+{
+  mt_state_t *state = (mt_state_t *) vstate;
+  unsigned long int *const mt = state->mt;
+  size_t i = 0;
+
+  while (i < n)
+    {
+      const unsigned long int *src;
+      size_t j, m;
+
+      if (state->mti >= N)
+        {
+          mt_generate (mt);
+          state->mti = 0;
+        }
+
+      m = N - state->mti;
+
+      if (m > n - i)
+        m = n - i;
+
+      src = mt + state->mti;
+
+      for (j = 0; j < m; j++)
+        {
+          unsigned long k = src[j];
+          TEMPER (k);
+          x[i + j] = k / 4294967296.0;
+        }
+
+      state->mti += m;
+      i += m;
+    }
+}
+
+/* Jumping ahead.
+
+   The recurrence is linear over GF(2), so every bit of the output
+   sequence satisfies the characteristic polynomial phi(x) of degree
+   19937.  To advance by n steps we compute p(x) = x^n mod phi(x) and
+   then form the state after n steps as the sum of the states after i
+   steps, for each nonzero coefficient p_i, as described in H.
+   Haramoto, M. Matsumoto, T. Nishimura, F. Panneton and P. L'Ecuyer,
+   "Efficient Jump Ahead for F2-Linear Random Number Generators",
+   INFORMS Journal on Computing 20(3) (2008), 385-390.
+
+   This costs about as much as generating a few million numbers, so
+   shorter jumps simply discard the values. */
+
+#define MT_DEGREE 19937
+#define MT_PWORDS (2 * ((MT_DEGREE + 31) / 32))  /* room for a square */
+#define MT_JUMP_MIN 16777216UL
+
+/* exponents of the nonzero terms of phi(x) below x^19937, found with the
+   Berlekamp-Massey algorithm */
+
+static const unsigned short int mt_charpoly[] = {
+  0, 1189, 1416, 1585, 1643, 1870, 2493, 2773, 3000, 3227,
+  3454, 3681, 3908, 4135, 4362, 4753, 5661, 6337, 6569, 7129,
+  7477, 7525, 7583, 7752, 7979, 8206, 9505, 9901, 9969, 10128,
+  10693, 10761, 10920, 11089, 11147, 11157, 11215, 11321, 11374, 11384,
+  11485, 11611, 11712, 11717, 11838, 11881, 11944, 11997, 12277, 12335,
+  12393, 12504, 12509, 12620, 12673, 12731, 12736, 12789, 12905, 12958,
+  12963, 13137, 13185, 13190, 13243, 13301, 13412, 13528, 13533, 13639,
+  13697, 13760, 13813, 13866, 14093, 14151, 14209, 14320, 14325, 14436,
+  14547, 14552, 14605, 14721, 14774, 14779, 14953, 15001, 15006, 15059,
+  15117, 15228, 15344, 15349, 15455, 15513, 15576, 15629, 15682, 15909,
+  15967, 16025, 16136, 16141, 16252, 16363, 16368, 16421, 16537, 16590,
+  16595, 16817, 16822, 16875, 16933, 17044, 17160, 17271, 17329, 17445,
+  17498, 17725, 17783, 17841, 17952, 18068, 18179, 18237, 18406, 18633,
+  18691, 18860, 19087, 19314
+};
+
+#define MT_GETBIT(p,i) (((p)[(i) >> 5] >> ((i) & 31)) & 1UL)
+#define MT_FLIPBIT(p,i) ((p)[(i) >> 5] ^= (1UL << ((i) & 31)))
+
+static void
+mt_poly_reduce (unsigned long int *p, long int top)
+{
+  /* reduce p, of degree at most top, modulo phi */
+  const size_t nterms = sizeof (mt_charpoly) / sizeof (mt_charpoly[0]);
+  long int d;
+
+  for (d = top; d >= MT_DEGREE; d--)
+    {
+      if (MT_GETBIT (p, d))
+        {
+          const long int shift = d - MT_DEGREE;
+          size_t t;
+
+          MT_FLIPBIT (p, d);
+
+          for (t = 0; t < nterms; t++)
+            MT_FLIPBIT (p, shift + mt_charpoly[t]);
+        }
+    }
+}
+
+static inline unsigned long int
+mt_spread (unsigned long int x)
+{
+  /* spread the 16 bits of x to the even bit positions, which squares a
+     polynomial over GF(2) */
+  x = (x | (x << 8)) & 0x00ff00ffUL;
+  x = (x | (x << 4)) & 0x0f0f0f0fUL;
+  x = (x | (x << 2)) & 0x33333333UL;
+  x = (x | (x << 1)) & 0x55555555UL;
+  return x;
+}
+
+static void
+mt_poly_jump (unsigned long int p[], unsigned long int n)
+{
+  /* compute p = x^n mod phi, by left to right binary exponentiation */
+  unsigned long int bit = 1;
+  size_t i;
+
+  for (i = 0; i < MT_PWORDS; i++)
+    p[i] = 0;
+
+  p[0] = 1;
+
+  while ((n >> 1) >= bit)
+    bit <<= 1;
+
+  for (; bit > 0; bit >>= 1)
+    {
+      /* square, working down so that each word is read before the
+         words above it are overwritten */
+
+      for (i = MT_PWORDS / 2; i-- > 0;)
+        {
+          const unsigned long int w = p[i];
+          p[2 * i + 1] = mt_spread (w >> 16);
+          p[2 * i] = mt_spread (w & 0xffffUL);
+        }
+
+      mt_poly_reduce (p, 2 * (MT_DEGREE - 1));
+
+      if (n & bit)
+        {
+          /* multiply by x */
+          unsigned long int carry = 0;
+
+          for (i = 0; i < (MT_DEGREE + 32) / 32; i++)
+            {
+              const unsigned long int w = p[i];
+              p[i] = ((w << 1) & 0xffffffffUL) | carry;
+              carry = w >> 31;
+            }
+
+          mt_poly_reduce (p, MT_DEGREE);
+        }
+    }
+}
+
+static void
+mt_jump (void *vstate, unsigned long int n)
+{
+  mt_state_t *state = (mt_state_t *) vstate;
+  unsigned long int *const mt = state->mt;
+  unsigned long int p[MT_PWORDS];
+  unsigned long int sum[N];
+  long int i, deg;
+  int s, j;
+
+  if (n < MT_JUMP_MIN)
+    {
+      while (n > 0)
+        {
+          unsigned long int m;
+
+          if (state->mti >= N)
+            {
+              mt_generate (mt);
+              state->mti = 0;
+            }
+
+          m = N - state->mti;
+
+          if (m > n)
+            m = n;
+
+          state->mti += m;
+          n -= m;
+        }
+
+      return;
+    }
+
+  if (state->mti >= N)
+    {
+      mt_generate (mt);
+      state->mti = 0;
+    }
+
+  mt_poly_jump (p, n);
+
+  /* Treat mt[] as a circular buffer holding the next N words of the
+     sequence starting at position s, generating the words which have
+     already been used. */
+
+  s = state->mti;
+
+  for (j = 0; j < s; j++)
+    {
+      unsigned long y = (mt[j] & UPPER_MASK) | (mt[(j + 1) % N] & LOWER_MASK);
+      mt[j] = mt[(j + M) % N] ^ (y >> 1) ^ MAGIC(y);
+    }
+
+  for (deg = MT_DEGREE - 1; deg > 0 && !MT_GETBIT (p, deg); deg--)
+    ;
+
+  for (j = 0; j < N; j++)
+    sum[j] = 0;
+
+  for (i = 0; i <= deg; i++)
+    {
+      unsigned long y;
+
+      if (MT_GETBIT (p, i))
+        {
+          for (j = 0; j < N - s; j++)
+            sum[j] ^= mt[s + j];
+          for (j = N - s; j < N; j++)
+            sum[j] ^= mt[s + j - N];
+        }
+
+      /* advance the buffer by one word */
+
+      y = (mt[s] & UPPER_MASK) | (mt[(s + 1) % N] & LOWER_MASK);
+      mt[s] = mt[(s + M) % N] ^ (y >> 1) ^ MAGIC(y);
+      s = (s + 1) % N;
+    }
+
+  for (j = 0; j < N; j++)
+    mt[j] = sum[j];
+
+  state->mti = 0;
+}
+
 static void
 mt_set (void *vstate, unsigned long int s)
 {
@@ -211,7 +508,11 @@ static const gsl_rng_type mt_type =
  sizeof (mt_state_t),
  &mt_set,
  &mt_get,
- &mt_get_double};
+ &mt_get_double,
+ &mt_get_fill,
+ &mt_get_double_fill,
+ &mt_jump,
+ 0};                            /* set_stream */
 
 static const gsl_rng_type mt_1999_type =
 {"mt19937_1999",                /* name */
@@ -220,7 +521,11 @@ static const gsl_rng_type mt_1999_type =
  sizeof (mt_state_t),
  &mt_1999_set,
  &mt_get,
- &mt_get_double};
+ &mt_get_double,
+ &mt_get_fill,
+ &mt_get_double_fill,
+ &mt_jump,
+ 0};                            /* set_stream */
 
 static const gsl_rng_type mt_1998_type =
 {"mt19937_1998",                /* name */
@@ -229,7 +534,11 @@ static const gsl_rng_type mt_1998_type =
  sizeof (mt_state_t),
  &mt_1998_set,
  &mt_get,
- &mt_get_double};
+ &mt_get_double,
+ &mt_get_fill,
+ &mt_get_double_fill,
+ &mt_jump,
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_mt19937 = &mt_type;
 const gsl_rng_type *gsl_rng_mt19937_1999 = &mt_1999_type;
@@ -0,0 +1,162 @@
+/* rng/philox.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the Philox4x32-10 counter-based generator of Salmon, Moraes,
+   Dror and Shaw, "Parallel Random Numbers: As Easy as 1, 2, 3",
+   Proceedings of SC11 (2011).
+
+   Each 128-bit counter is mapped to four 32-bit outputs by 10 rounds
+   of a bijection built from two 32x32 -> 64 bit multiplications, keyed
+   by a 64-bit key taken from the seed.  The stream number passed to
+   gsl_rng_set_stream selects the upper 64 bits of the counter, so
+   every stream has 2^66 outputs of its own.
+
+   The outputs agree with the known-answer tests of the Random123
+   reference implementation. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <gsl/gsl_rng.h>
+
+#include "counter.c"
+
+#define PHILOX_M0 0xD2511F53UL
+#define PHILOX_M1 0xCD9E8D57UL
+#define PHILOX_W0 0x9E3779B9UL
+#define PHILOX_W1 0xBB67AE85UL
+
+static inline unsigned long int philox4x32_get (void *vstate);
+static double philox4x32_get_double (void *vstate);
+static void philox4x32_set (void *state, unsigned long int s);
+
+/* 32x32 -> 64 bit product of a and b, in two 32-bit words */
+static inline void
+philox_mulhilo (const unsigned long int a, const unsigned long int b,
+                unsigned long int *hi, unsigned long int *lo)
+{
+#if ULONG_MAX > 0xffffffffUL
+  const unsigned long int p = a * b;
+  *hi = p >> 32;
+  *lo = p & CTR_MASK;
+#else
+  /* schoolbook multiplication with 16-bit digits */
+  const unsigned long int a0 = a & 0xffffUL, a1 = a >> 16;
+  const unsigned long int b0 = b & 0xffffUL, b1 = b >> 16;
+  const unsigned long int p00 = a0 * b0, p01 = a0 * b1;
+  const unsigned long int p10 = a1 * b0, p11 = a1 * b1;
+  const unsigned long int mid = (p00 >> 16) + (p01 & 0xffffUL) + (p10 & 0xffffUL);
+  *lo = ((mid & 0xffffUL) << 16) | (p00 & 0xffffUL);
+  *hi = (p11 + (p01 >> 16) + (p10 >> 16) + (mid >> 16)) & CTR_MASK;
+#endif
+}
+
+static void
+philox4x32_block (const unsigned long int ctr[4], const unsigned long int key[4],
+                  unsigned long int out[4])
+{
+  unsigned long int x0 = ctr[0], x1 = ctr[1], x2 = ctr[2], x3 = ctr[3];
+  unsigned long int k0 = key[0], k1 = key[1];
+  int r;
+
+  for (r = 0; r < 10; r++)
+    {
+      unsigned long int hi0, lo0, hi1, lo1;
+
+      if (r > 0)
+        {
+          k0 = (k0 + PHILOX_W0) & CTR_MASK;
+          k1 = (k1 + PHILOX_W1) & CTR_MASK;
+        }
+
+      philox_mulhilo (PHILOX_M0, x0, &hi0, &lo0);
+      philox_mulhilo (PHILOX_M1, x2, &hi1, &lo1);
+
+      x0 = hi1 ^ x1 ^ k0;
+      x1 = lo1;
+      x2 = hi0 ^ x3 ^ k1;
+      x3 = lo0;
+    }
+
+  out[0] = x0;
+  out[1] = x1;
+  out[2] = x2;
+  out[3] = x3;
+}
+
+static inline unsigned long int
+philox4x32_get (void *vstate)
+{
+  return counter_get ((counter_state_t *) vstate, &philox4x32_block);
+}
+
+static double
+philox4x32_get_double (void *vstate)
+{
+  return philox4x32_get (vstate) / 4294967296.0;
+}
+
+static void
+philox4x32_get_fill (void *vstate, unsigned long int x[], size_t n)
+{
+  counter_fill ((counter_state_t *) vstate, &philox4x32_block, x, n);
+}
+
+static void
+philox4x32_get_double_fill (void *vstate, double x[], size_t n)
+{
+  counter_state_t *state = (counter_state_t *) vstate;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    x[i] = counter_get (state, &philox4x32_block) / 4294967296.0;
+}
+
+static void
+philox4x32_jump (void *vstate, unsigned long int n)
+{
+  counter_jump ((counter_state_t *) vstate, &philox4x32_block, n);
+}
+
+static void
+philox4x32_set_stream (void *vstate, unsigned long int s, unsigned long int stream)
+{
+  counter_set ((counter_state_t *) vstate, &philox4x32_block, s, stream, 2);
+}
+
+static void
+philox4x32_set (void *vstate, unsigned long int s)
+{
+  counter_set ((counter_state_t *) vstate, &philox4x32_block, s, 0, 2);
+}
+
+static const gsl_rng_type philox4x32_type =
+{"philox4x32",                  /* name */
+ 0xffffffffUL,                  /* RAND_MAX */
+ 0,                             /* RAND_MIN */
+ sizeof (counter_state_t),
+ &philox4x32_set,
+ &philox4x32_get,
+ &philox4x32_get_double,
+ &philox4x32_get_fill,
+ &philox4x32_get_double_fill,
+ &philox4x32_jump,
+ &philox4x32_set_stream};
+
+const gsl_rng_type *gsl_rng_philox4x32 = &philox4x32_type;
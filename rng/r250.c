@@ -167,6 +167,10 @@ static const gsl_rng_type r250_type =
  sizeof (r250_state_t),
  &r250_set,
  &r250_get,
- &r250_get_double};
+ &r250_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ 0,                             /* jump */
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_r250 = &r250_type;
@@ -22,6 +22,8 @@
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_rng.h>
 
+#include "schrage.c"
+
 /* This is an implementation of the algorithm used in Numerical
    Recipe's ran0 generator. It is the same as MINSTD with an XOR mask
    of 123459876 on the seed.
@@ -34,6 +36,7 @@
 static inline unsigned long int ran0_get (void *vstate);
 static double ran0_get_double (void *vstate);
 static void ran0_set (void *state, unsigned long int s);
+static void ran0_jump (void *state, unsigned long int n);
 
 static const long int m = 2147483647, a = 16807, q = 127773, r = 2836;
 static const unsigned long int mask = 123459876;
@@ -88,6 +91,16 @@ ran0_set (void *vstate, unsigned long int s)
   return;
 }
 
+static void
+ran0_jump (void *vstate, unsigned long int n)
+{
+  ran0_state_t *state = (ran0_state_t *) vstate;
+
+  const unsigned long int sqrtm = 46341;  /* ceil(sqrt(m)) */
+
+  state->x = schrage_mult (schrage_pow (a, n, m, sqrtm), state->x, m, sqrtm);
+}
+
 static const gsl_rng_type ran0_type =
 {"ran0",                        /* name */
  2147483646,                    /* RAND_MAX */
@@ -95,6 +108,10 @@ static const gsl_rng_type ran0_type =
  sizeof (ran0_state_t),
  &ran0_set,
  &ran0_get,
- &ran0_get_double};
+ &ran0_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ &ran0_jump,
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_ran0 = &ran0_type;
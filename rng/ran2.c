@@ -141,6 +141,10 @@ static const gsl_rng_type ran2_type =
  sizeof (ran2_state_t),
  &ran2_set,
  &ran2_get,
- &ran2_get_double};
+ &ran2_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ 0,                             /* jump */
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_ran2 = &ran2_type;
@@ -21,6 +21,8 @@
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
 
+#include "jump.c"
+
 /* This is the old BSD rand() generator. The sequence is
 
    x_{n+1} = (a x_n + c) mod m 
@@ -38,6 +40,7 @@
 static inline unsigned long int rand_get (void *vstate);
 static double rand_get_double (void *vstate);
 static void rand_set (void *state, unsigned long int s);
+static void rand_jump (void *state, unsigned long int n);
 
 typedef struct
   {
@@ -73,6 +76,14 @@ rand_set (void *vstate, unsigned long int s)
   return;
 }
 
+static void
+rand_jump (void *vstate, unsigned long int n)
+{
+  rand_state_t *state = (rand_state_t *) vstate;
+
+  state->x = lcg_jump (state->x, 1103515245, 12345, n, 0x7fffffffUL);
+}
+
 static const gsl_rng_type rand_type =
 {"rand",                        /* name */
  0x7fffffffUL,                  /* RAND_MAX */
@@ -80,6 +91,10 @@ static const gsl_rng_type rand_type =
  sizeof (rand_state_t),
  &rand_set,
  &rand_get,
- &rand_get_double};
+ &rand_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ &rand_jump,
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_rand = &rand_type;
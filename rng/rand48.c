@@ -23,6 +23,8 @@
 #include <gsl/gsl_sys.h>
 #include <gsl/gsl_rng.h>
 
+#include "jump.c"
+
 /* This is the Unix rand48() generator. The generator returns the
    upper 32 bits from each term of the sequence,
 
@@ -40,6 +42,7 @@ static inline void rand48_advance (void *vstate);
 static unsigned long int rand48_get (void *vstate);
 static double rand48_get_double (void *vstate);
 static void rand48_set (void *state, unsigned long int s);
+static void rand48_jump (void *state, unsigned long int n);
 
 static const unsigned short int a0 = 0xE66D ;
 static const unsigned short int a1 = 0xDEEC ;
@@ -130,6 +133,27 @@ rand48_set (void *vstate, unsigned long int s)
   return;
 }
 
+static void
+rand48_jump (void *vstate, unsigned long int n)
+{
+  rand48_state_t *state = (rand48_state_t *) vstate;
+
+  static const unsigned long int a[3] = { 0xE66D, 0xDEEC, 0x0005 };
+  static const unsigned long int c[3] = { 0x000B, 0, 0 };
+
+  unsigned long int x[3];
+
+  x[0] = state->x0;
+  x[1] = state->x1;
+  x[2] = state->x2;
+
+  lcg48_jump (x, a, c, n);
+
+  state->x0 = x[0];
+  state->x1 = x[1];
+  state->x2 = x[2];
+}
+
 static const gsl_rng_type rand48_type =
 {"rand48",                      /* name */
  0xffffffffUL,                  /* RAND_MAX */
@@ -137,7 +161,11 @@ static const gsl_rng_type rand48_type =
  sizeof (rand48_state_t),
  &rand48_set,
  &rand48_get,
- &rand48_get_double
+ &rand48_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ &rand48_jump,
+ 0                              /* set_stream */
 };
 
 const gsl_rng_type *gsl_rng_rand48 = &rand48_type;
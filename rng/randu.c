@@ -21,6 +21,8 @@
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
 
+#include "jump.c"
+
 /* This is a reincarnation of the infamously bad RANDU generator.
    The sequence is,
 
@@ -42,6 +44,7 @@
 static inline unsigned long int randu_get (void *vstate);
 static double randu_get_double (void *vstate);
 static void randu_set (void *state, unsigned long int s);
+static void randu_jump (void *state, unsigned long int n);
 
 static const long int a = 65539;
 /* static const unsigned long int m = 2147483648UL; */
@@ -83,6 +86,14 @@ randu_set (void *vstate, unsigned long int s)
   return;
 }
 
+static void
+randu_jump (void *vstate, unsigned long int n)
+{
+  randu_state_t *state = (randu_state_t *) vstate;
+
+  state->x = lcg_jump (state->x, a, 0, n, 0x7fffffffUL);
+}
+
 static const gsl_rng_type randu_type =
 {"randu",                       /* name */
  0x7fffffffUL,                  /* RAND_MAX */
@@ -90,6 +101,10 @@ static const gsl_rng_type randu_type =
  sizeof (randu_state_t),
  &randu_set,
  &randu_get,
- &randu_get_double};
+ &randu_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ &randu_jump,
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_randu = &randu_type;
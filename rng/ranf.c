@@ -21,6 +21,8 @@
 #include <math.h>
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
+
+#include "jump.c"
 #include <gsl/gsl_sys.h>
 
 /* This is the CRAY RANF generator. The generator returns the
@@ -50,6 +52,7 @@ static inline void ranf_advance (void *vstate);
 static unsigned long int ranf_get (void *vstate);
 static double ranf_get_double (void *vstate);
 static void ranf_set (void *state, unsigned long int s);
+static void ranf_jump (void *state, unsigned long int n);
 
 static const unsigned short int a0 = 0xB175 ;
 static const unsigned short int a1 = 0xA2E7 ;
@@ -149,6 +152,27 @@ ranf_set (void *vstate, unsigned long int s)
   return;
 }
 
+static void
+ranf_jump (void *vstate, unsigned long int n)
+{
+  ranf_state_t *state = (ranf_state_t *) vstate;
+
+  static const unsigned long int a[3] = { 0xB175, 0xA2E7, 0x2875 };
+  static const unsigned long int c[3] = { 0, 0, 0 };
+
+  unsigned long int x[3];
+
+  x[0] = state->x0;
+  x[1] = state->x1;
+  x[2] = state->x2;
+
+  lcg48_jump (x, a, c, n);
+
+  state->x0 = x[0];
+  state->x1 = x[1];
+  state->x2 = x[2];
+}
+
 static const gsl_rng_type ranf_type =
 {"ranf",                        /* name */
  0xffffffffUL,                  /* RAND_MAX */
@@ -156,7 +180,11 @@ static const gsl_rng_type ranf_type =
  sizeof (ranf_state_t),
  &ranf_set,
  &ranf_get,
- &ranf_get_double
+ &ranf_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ &ranf_jump,
+ 0                              /* set_stream */
 };
 
 const gsl_rng_type *gsl_rng_ranf = &ranf_type;
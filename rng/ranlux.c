@@ -207,7 +207,11 @@ static const gsl_rng_type ranlux_type =
  sizeof (ranlux_state_t),
  &ranlux_set,
  &ranlux_get,
- &ranlux_get_double};
+ &ranlux_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ 0,                             /* jump */
+ 0};                            /* set_stream */
 
 static const gsl_rng_type ranlux389_type =
 {"ranlux389",                   /* name */
@@ -216,7 +220,11 @@ static const gsl_rng_type ranlux389_type =
  sizeof (ranlux_state_t),
  &ranlux389_set,
  &ranlux_get,
- &ranlux_get_double};
+ &ranlux_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ 0,                             /* jump */
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_ranlux = &ranlux_type;
 const gsl_rng_type *gsl_rng_ranlux389 = &ranlux389_type;
@@ -31,6 +31,8 @@
 
 static inline unsigned long int ranlxd_get (void *vstate);
 static double ranlxd_get_double (void *vstate);
+static void ranlxd_get_fill (void *vstate, unsigned long int x[], size_t n);
+static void ranlxd_get_double_fill (void *vstate, double x[], size_t n);
 static void ranlxd_set_lux (void *state, unsigned long int s, unsigned int luxury);
 static void ranlxd1_set (void *state, unsigned long int s);
 static void ranlxd2_set (void *state, unsigned long int s);
@@ -167,6 +169,59 @@ ranlxd_get_double (void *vstate)
   return state->xdbl[state->ir];
 }
 
+/* The bulk versions copy the 12 doubles produced by each update of
+   the state directly, instead of one per call */
+
+static void
+ranlxd_get_double_fill (void *vstate, double x[], size_t n)
+{
+  ranlxd_state_t *state = (ranlxd_state_t *) vstate;
+  const double *xdbl = state->xdbl;
+  unsigned int ir = state->ir;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      ir = next[ir];
+
+      if (ir == state->ir_old)
+        {
+          state->ir = ir;
+          increment_state (state);
+          ir = state->ir;
+        }
+
+      x[i] = xdbl[ir];
+    }
+
+  state->ir = ir;
+}
+
+static void
+ranlxd_get_fill (void *vstate, unsigned long int x[], size_t n)
+{
+  ranlxd_state_t *state = (ranlxd_state_t *) vstate;
+  const double *xdbl = state->xdbl;
+  unsigned int ir = state->ir;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      ir = next[ir];
+
+      if (ir == state->ir_old)
+        {
+          state->ir = ir;
+          increment_state (state);
+          ir = state->ir;
+        }
+
+      x[i] = xdbl[ir] * 4294967296.0;     /* 2^32 */
+    }
+
+  state->ir = ir;
+}
+
 static void
 ranlxd_set_lux (void *vstate, unsigned long int s, unsigned int luxury)
 {
@@ -234,7 +289,11 @@ static const gsl_rng_type ranlxd1_type =
  sizeof (ranlxd_state_t),
  &ranlxd1_set,
  &ranlxd_get,
- &ranlxd_get_double};
+ &ranlxd_get_double,
+ &ranlxd_get_fill,
+ &ranlxd_get_double_fill,
+ 0,                             /* jump */
+ 0};                            /* set_stream */
 
 static const gsl_rng_type ranlxd2_type =
 {"ranlxd2",                     /* name */
@@ -243,7 +302,11 @@ static const gsl_rng_type ranlxd2_type =
  sizeof (ranlxd_state_t),
  &ranlxd2_set,
  &ranlxd_get,
- &ranlxd_get_double};
+ &ranlxd_get_double,
+ &ranlxd_get_fill,
+ &ranlxd_get_double_fill,
+ 0,                             /* jump */
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_ranlxd1 = &ranlxd1_type;
 const gsl_rng_type *gsl_rng_ranlxd2 = &ranlxd2_type;
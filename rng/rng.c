@@ -145,6 +145,97 @@ gsl_rng_print_state (const gsl_rng * r)
 
 }
 
+/* Fill an array with n consecutive outputs of the generator. The
+   result is identical to n calls of gsl_rng_get (or gsl_rng_uniform),
+   but generators which provide a bulk kernel avoid the indirect
+   function call per sample. */
+
+void
+gsl_rng_get_fill (const gsl_rng * r, unsigned long int x[], const size_t n)
+{
+  const gsl_rng_type *T = r->type;
+
+  if (T->get_fill)
+    {
+      (T->get_fill) (r->state, x, n);
+    }
+  else
+    {
+      size_t i;
+
+      for (i = 0; i < n; i++)
+        {
+          x[i] = (T->get) (r->state);
+        }
+    }
+}
+
+void
+gsl_rng_uniform_fill (const gsl_rng * r, double x[], const size_t n)
+{
+  const gsl_rng_type *T = r->type;
+
+  if (T->get_double_fill)
+    {
+      (T->get_double_fill) (r->state, x, n);
+    }
+  else
+    {
+      size_t i;
+
+      for (i = 0; i < n; i++)
+        {
+          x[i] = (T->get_double) (r->state);
+        }
+    }
+}
+
+/* Advance the generator by n outputs, as if gsl_rng_get had been
+   called n times.  Generators which know how to skip ahead provide a
+   jump function, otherwise the values are drawn and discarded. */
+
+int
+gsl_rng_jump (const gsl_rng * r, unsigned long int n)
+{
+  const gsl_rng_type *T = r->type;
+
+  if (T->jump)
+    {
+      (T->jump) (r->state, n);
+    }
+  else
+    {
+      unsigned long int i;
+
+      for (i = 0; i < n; i++)
+        {
+          (T->get) (r->state);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* Seed the generator and select one of its independent streams.  Only
+   generators with a stream parameter, such as the counter-based
+   generators, support this. */
+
+int
+gsl_rng_set_stream (const gsl_rng * r, unsigned long int seed,
+                    unsigned long int stream)
+{
+  const gsl_rng_type *T = r->type;
+
+  if (T->set_stream == 0)
+    {
+      GSL_ERROR ("generator does not support multiple streams", GSL_EUNIMPL);
+    }
+
+  (T->set_stream) (r->state, seed, stream);
+
+  return GSL_SUCCESS;
+}
+
 void
 gsl_rng_free (gsl_rng * r)
 {
@@ -49,3 +49,83 @@ schrage_mult (unsigned long int a, unsigned long int b,
   unsigned long int t = t1 + t2;
   return (t >= m) ? (t - m) : t;
 }
+
+static inline unsigned long int
+schrage_pow (unsigned long int a, unsigned long int n,
+             unsigned long int m, unsigned long int sqrtm)
+{
+  /* Compute a^n mod m by repeated squaring, for jumping ahead n
+   * steps in a multiplicative congruential generator.
+   */
+  unsigned long int p = 1UL;
+  while (n > 0)
+    {
+      if (n & 1UL)
+        p = schrage_mult (a, p, m, sqrtm);
+      a = schrage_mult (a, a, m, sqrtm);
+      n >>= 1;
+    }
+  return p;
+}
+
+#define SCHRAGE_MAX_ORDER 5
+
+static inline void
+schrage_matrix_jump (const unsigned long int A[], const size_t k,
+                     unsigned long int n, unsigned long int m,
+                     unsigned long int sqrtm, unsigned long int x[])
+{
+  /* Replace the vector x by A^n x (mod m), where A is the k-by-k
+   * companion matrix of a multiple recursive generator stored by
+   * rows, with k <= SCHRAGE_MAX_ORDER.  All elements must lie in
+   * [0, m).
+   */
+  unsigned long int P[SCHRAGE_MAX_ORDER * SCHRAGE_MAX_ORDER];
+  unsigned long int T[SCHRAGE_MAX_ORDER * SCHRAGE_MAX_ORDER];
+  unsigned long int y[SCHRAGE_MAX_ORDER];
+  size_t i, j, l;
+
+  for (i = 0; i < k * k; i++)
+    P[i] = A[i];
+
+  while (n > 0)
+    {
+      if (n & 1UL)
+        {
+          for (i = 0; i < k; i++)
+            {
+              unsigned long int s = 0;
+              for (j = 0; j < k; j++)
+                {
+                  s += schrage_mult (P[i * k + j], x[j], m, sqrtm);
+                  if (s >= m)
+                    s -= m;
+                }
+              y[i] = s;
+            }
+          for (i = 0; i < k; i++)
+            x[i] = y[i];
+        }
+
+      n >>= 1;
+
+      if (n == 0)
+        break;
+
+      for (i = 0; i < k; i++)
+        for (j = 0; j < k; j++)
+          {
+            unsigned long int s = 0;
+            for (l = 0; l < k; l++)
+              {
+                s += schrage_mult (P[i * k + l], P[l * k + j], m, sqrtm);
+                if (s >= m)
+                  s -= m;
+              }
+            T[i * k + j] = s;
+          }
+
+      for (i = 0; i < k * k; i++)
+        P[i] = T[i];
+    }
+}
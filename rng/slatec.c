@@ -200,6 +200,10 @@ static const gsl_rng_type slatec_type =
  sizeof (slatec_state_t),
  &slatec_set,
  &slatec_get,
- &slatec_get_double};
+ &slatec_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ 0,                             /* jump */
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_slatec = &slatec_type;
@@ -21,6 +21,8 @@
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
 
+#include "jump.c"
+
 /* This is a maximally equidistributed combined Tausworthe
    generator. The sequence is,
 
@@ -83,6 +85,7 @@
 static inline unsigned long int taus_get (void *vstate);
 static double taus_get_double (void *vstate);
 static void taus_set (void *state, unsigned long int s);
+static void taus_jump (void *state, unsigned long int n);
 
 typedef struct
   {
@@ -160,6 +163,29 @@ taus2_set (void *vstate, unsigned long int s)
   return;
 }
 
+/* Each component is a linear map of 32-bit words over GF(2), so its
+   matrix can be found by stepping the unit vectors and then raised to
+   the n-th power */
+
+static void
+taus_jump (void *vstate, unsigned long int n)
+{
+  taus_state_t *state = (taus_state_t *) vstate;
+  f2_matrix A1, A2, A3;
+  size_t j;
+
+  for (j = 0; j < 32; j++)
+    {
+      const unsigned long int e = 1UL << j;
+      A1[j] = TAUSWORTHE (e, 13, 19, 4294967294UL, 12);
+      A2[j] = TAUSWORTHE (e, 2, 25, 4294967288UL, 4);
+      A3[j] = TAUSWORTHE (e, 3, 11, 4294967280UL, 17);
+    }
+
+  state->s1 = f2_jump (A1, n, state->s1);
+  state->s2 = f2_jump (A2, n, state->s2);
+  state->s3 = f2_jump (A3, n, state->s3);
+}
 
 static const gsl_rng_type taus_type =
 {"taus",                        /* name */
@@ -168,7 +194,11 @@ static const gsl_rng_type taus_type =
  sizeof (taus_state_t),
  &taus_set,
  &taus_get,
- &taus_get_double};
+ &taus_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ &taus_jump,
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_taus = &taus_type;
 
@@ -179,6 +209,10 @@ static const gsl_rng_type taus2_type =
  sizeof (taus_state_t),
  &taus2_set,
  &taus_get,
- &taus_get_double};
+ &taus_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ &taus_jump,
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_taus2 = &taus2_type;
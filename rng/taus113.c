@@ -59,12 +59,17 @@
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
 
+#include "jump.c"
+
 #define LCG(n) ((69069UL * n) & 0xffffffffUL)
 #define MASK 0xffffffffUL
 
 static inline unsigned long int taus113_get (void *vstate);
 static double taus113_get_double (void *vstate);
+static void taus113_get_fill (void *vstate, unsigned long int x[], size_t n);
+static void taus113_get_double_fill (void *vstate, double x[], size_t n);
 static void taus113_set (void *state, unsigned long int s);
+static void taus113_jump (void *state, unsigned long int n);
 
 typedef struct
 {
@@ -100,6 +105,59 @@ taus113_get_double (void *vstate)
   return taus113_get (vstate) / 4294967296.0;
 }
 
+/* The bulk versions keep the four components in local variables for
+   the whole run and write them back once at the end */
+
+#define TAUS113_STEP(z1,z2,z3,z4) do {                                  \
+    unsigned long b1, b2, b3, b4;                                       \
+    b1 = ((((z1 << 6UL) & MASK) ^ z1) >> 13UL);                         \
+    z1 = ((((z1 & 4294967294UL) << 18UL) & MASK) ^ b1);                 \
+    b2 = ((((z2 << 2UL) & MASK) ^ z2) >> 27UL);                         \
+    z2 = ((((z2 & 4294967288UL) << 2UL) & MASK) ^ b2);                  \
+    b3 = ((((z3 << 13UL) & MASK) ^ z3) >> 21UL);                        \
+    z3 = ((((z3 & 4294967280UL) << 7UL) & MASK) ^ b3);                  \
+    b4 = ((((z4 << 3UL) & MASK) ^ z4) >> 12UL);                         \
+    z4 = ((((z4 & 4294967168UL) << 13UL) & MASK) ^ b4);                 \
+  } while (0)
+
+static void
+taus113_get_fill (void *vstate, unsigned long int x[], size_t n)
+{
+  taus113_state_t *state = (taus113_state_t *) vstate;
+  unsigned long z1 = state->z1, z2 = state->z2, z3 = state->z3, z4 = state->z4;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      TAUS113_STEP (z1, z2, z3, z4);
+      x[i] = z1 ^ z2 ^ z3 ^ z4;
+    }
+
+  state->z1 = z1;
+  state->z2 = z2;
+  state->z3 = z3;
+  state->z4 = z4;
+}
+
+static void
+taus113_get_double_fill (void *vstate, double x[], size_t n)
+{
+  taus113_state_t *state = (taus113_state_t *) vstate;
+  unsigned long z1 = state->z1, z2 = state->z2, z3 = state->z3, z4 = state->z4;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      TAUS113_STEP (z1, z2, z3, z4);
+      x[i] = (z1 ^ z2 ^ z3 ^ z4) / 4294967296.0;
+    }
+
+  state->z1 = z1;
+  state->z2 = z2;
+  state->z3 = z3;
+  state->z4 = z4;
+}
+
 static void
 taus113_set (void *vstate, unsigned long int s)
 {
@@ -136,6 +194,33 @@ taus113_set (void *vstate, unsigned long int s)
   return;
 }
 
+/* Each component is a linear map of 32-bit words over GF(2), so its
+   matrix can be found by stepping the unit vectors and then raised to
+   the n-th power */
+
+static void
+taus113_jump (void *vstate, unsigned long int n)
+{
+  taus113_state_t *state = (taus113_state_t *) vstate;
+  f2_matrix A1, A2, A3, A4;
+  size_t j;
+
+  for (j = 0; j < 32; j++)
+    {
+      unsigned long z1 = 1UL << j, z2 = z1, z3 = z1, z4 = z1;
+      TAUS113_STEP (z1, z2, z3, z4);
+      A1[j] = z1;
+      A2[j] = z2;
+      A3[j] = z3;
+      A4[j] = z4;
+    }
+
+  state->z1 = f2_jump (A1, n, state->z1);
+  state->z2 = f2_jump (A2, n, state->z2);
+  state->z3 = f2_jump (A3, n, state->z3);
+  state->z4 = f2_jump (A4, n, state->z4);
+}
+
 static const gsl_rng_type taus113_type = {
   "taus113",                    /* name */
   0xffffffffUL,                 /* RAND_MAX */
@@ -143,7 +228,11 @@ static const gsl_rng_type taus113_type = {
   sizeof (taus113_state_t),
   &taus113_set,
   &taus113_get,
-  &taus113_get_double
+  &taus113_get_double,
+  &taus113_get_fill,
+  &taus113_get_double_fill,
+  &taus113_jump,
+  0                             /* set_stream */
 };
 
 const gsl_rng_type *gsl_rng_taus113 = &taus113_type;
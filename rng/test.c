@@ -32,6 +32,10 @@ void generic_rng_test (const gsl_rng_type * T);
 void rng_state_test (const gsl_rng_type * T);
 void rng_parallel_state_test (const gsl_rng_type * T);
 void rng_read_write_test (const gsl_rng_type * T);
+void rng_fill_test (const gsl_rng_type * T);
+void rng_jump_test (const gsl_rng_type * T);
+void rng_long_jump_test (const gsl_rng_type * T, unsigned long int n);
+void rng_stream_test (const gsl_rng_type * T);
 int rng_max_test (gsl_rng * r, unsigned long int *kmax, unsigned long int ran_max) ;
 int rng_min_test (gsl_rng * r, unsigned long int *kmin, unsigned long int ran_min, unsigned long int ran_max) ;
 int rng_sum_test (gsl_rng * r, double *sigma);
@@ -181,6 +185,15 @@ main (void)
   rng_test (gsl_rng_ranf, 0, 10000, 2152890433UL);
   rng_test (gsl_rng_ranf, 2, 10000, 339327233);
 
+  /* The counter-based generators with seed 0 use a zero key, and the
+     first block is the Random123 known-answer vector for a zero
+     counter and key. */
+
+  rng_test (gsl_rng_philox4x32, 0, 1, 0x6627e8d5UL);
+  rng_test (gsl_rng_philox4x32, 0, 4, 0x9b00dbd8UL);
+  rng_test (gsl_rng_threefry4x32, 0, 1, 0x9c6ca96aUL);
+  rng_test (gsl_rng_threefry4x32, 0, 4, 0x5256a7d8UL);
+
   /* Test constant relationship between int and double functions */
 
   for (r = rngs ; *r != 0; r++)
@@ -197,6 +210,24 @@ main (void)
   for (r = rngs ; *r != 0; r++)
     rng_read_write_test (*r);
 
+  /* Test bulk generation against single draws */
+
+  for (r = rngs ; *r != 0; r++)
+    rng_fill_test (*r);
+
+  /* Test skipping ahead against sequential draws */
+
+  for (r = rngs ; *r != 0; r++)
+    rng_jump_test (*r);
+
+  /* long enough to use the polynomial jump for mt19937 */
+
+  rng_long_jump_test (gsl_rng_mt19937, 20000000UL);
+  rng_long_jump_test (gsl_rng_mt19937_1998, 16777216UL + 313);
+
+  rng_stream_test (gsl_rng_philox4x32);
+  rng_stream_test (gsl_rng_threefry4x32);
+
   /* generic statistical tests (these are just to make sure that we
      don't get any crazy results back from the generator, i.e. they
      aren't a test of the algorithm, just the implementation) */
@@ -673,3 +704,144 @@ rng_seed_test (const gsl_rng_type * T)
     }
   }
 }
+
+void
+rng_fill_test (const gsl_rng_type * T)
+{
+  /* block sizes chosen to straddle the internal state sizes of the
+     generators (e.g. 624 for mt19937, 12 for ranlxd) */
+  const size_t sizes[] = { 0, 1, 11, 623, 625, 2000 };
+  const size_t nsizes = sizeof (sizes) / sizeof (sizes[0]);
+  unsigned long int k[2000];
+  double u[2000];
+  gsl_rng *r = gsl_rng_alloc (T);
+  gsl_rng *r_fill = gsl_rng_alloc (T);
+  int status_get = 0, status_uniform = 0;
+  size_t i, j;
+
+  for (i = 0; i < nsizes; i++)
+    {
+      gsl_rng_get_fill (r_fill, k, sizes[i]);
+
+      for (j = 0; j < sizes[i]; j++)
+        status_get |= (k[j] != gsl_rng_get (r));
+
+      gsl_rng_uniform_fill (r_fill, u, sizes[i]);
+
+      for (j = 0; j < sizes[i]; j++)
+        status_uniform |= (u[j] != gsl_rng_uniform (r));
+    }
+
+  gsl_test (status_get, "%s, gsl_rng_get_fill matches gsl_rng_get",
+            gsl_rng_name (r));
+  gsl_test (status_uniform, "%s, gsl_rng_uniform_fill matches gsl_rng_uniform",
+            gsl_rng_name (r));
+
+  gsl_rng_free (r);
+  gsl_rng_free (r_fill);
+}
+
+void
+rng_jump_test (const gsl_rng_type * T)
+{
+  /* jumps are applied in turn, with a single draw in between so that
+     they start from different positions within a block of output */
+  const unsigned long int jumps[] = { 0, 1, 3, 4, 5, 623, 625, 10000 };
+  const size_t njumps = sizeof (jumps) / sizeof (jumps[0]);
+  gsl_rng *r = gsl_rng_alloc (T);
+  gsl_rng *r_jump = gsl_rng_alloc (T);
+  int status = 0;
+  size_t i;
+
+  for (i = 0; i < njumps; i++)
+    {
+      unsigned long int j;
+
+      gsl_rng_jump (r_jump, jumps[i]);
+
+      for (j = 0; j < jumps[i]; j++)
+        gsl_rng_get (r);
+
+      status |= (gsl_rng_get (r_jump) != gsl_rng_get (r));
+    }
+
+  gsl_test (status, "%s, gsl_rng_jump matches sequential draws",
+            gsl_rng_name (r));
+
+  gsl_rng_free (r);
+  gsl_rng_free (r_jump);
+}
+
+void
+rng_stream_test (const gsl_rng_type * T)
+{
+  const size_t n = 1000;
+  gsl_rng *r1 = gsl_rng_alloc (T);
+  gsl_rng *r2 = gsl_rng_alloc (T);
+  int status_same = 0, status_seed = 0;
+  size_t i, ndiff = 0;
+
+  /* stream 0 is the sequence given by gsl_rng_set */
+
+  gsl_rng_set (r1, 42);
+  gsl_rng_set_stream (r2, 42, 0);
+
+  for (i = 0; i < n; i++)
+    status_seed |= (gsl_rng_get (r1) != gsl_rng_get (r2));
+
+  /* different streams with the same seed do not overlap, the same
+     stream is reproducible */
+
+  gsl_rng_set_stream (r1, 42, 1);
+  gsl_rng_set_stream (r2, 42, 2);
+
+  for (i = 0; i < n; i++)
+    ndiff += (gsl_rng_get (r1) != gsl_rng_get (r2));
+
+  gsl_rng_set_stream (r2, 42, 1);
+  gsl_rng_jump (r2, n);
+
+  for (i = 0; i < n; i++)
+    status_same |= (gsl_rng_get (r1) != gsl_rng_get (r2));
+
+  gsl_test (status_seed, "%s, gsl_rng_set_stream stream 0 matches gsl_rng_set",
+            gsl_rng_name (r1));
+  gsl_test (ndiff < n - 10, "%s, gsl_rng_set_stream gives distinct streams",
+            gsl_rng_name (r1));
+  gsl_test (status_same, "%s, gsl_rng_set_stream is reproducible",
+            gsl_rng_name (r1));
+
+  gsl_rng_free (r1);
+  gsl_rng_free (r2);
+}
+
+void
+rng_long_jump_test (const gsl_rng_type * T, unsigned long int n)
+{
+  gsl_rng *r = gsl_rng_alloc (T);
+  gsl_rng *r_jump = gsl_rng_alloc (T);
+  unsigned long int i;
+  int status = 0;
+
+  /* start part way through the state vector */
+
+  for (i = 0; i < 100; i++)
+    {
+      gsl_rng_get (r);
+      gsl_rng_get (r_jump);
+    }
+
+  gsl_rng_jump (r_jump, n);
+
+  for (i = 0; i < n; i++)
+    gsl_rng_get (r);
+
+  for (i = 0; i < 1000; i++)
+    status |= (gsl_rng_get (r_jump) != gsl_rng_get (r));
+
+  gsl_test (status, "%s, gsl_rng_jump by %lu matches sequential draws",
+            gsl_rng_name (r), n);
+
+  gsl_rng_free (r);
+  gsl_rng_free (r_jump);
+}
@@ -0,0 +1,161 @@
+/* rng/threefry.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the Threefry4x32-20 counter-based generator of Salmon,
+   Moraes, Dror and Shaw, "Parallel Random Numbers: As Easy as 1, 2, 3",
+   Proceedings of SC11 (2011).  It is a simplified version of the
+   Threefish block cipher: 20 rounds of 32-bit additions, rotations and
+   exclusive-ors applied to the counter, with the 128-bit key injected
+   every 4 rounds.
+
+   The seed gives the first two key words and the stream number passed
+   to gsl_rng_set_stream the last two, so streams are independent
+   keys.  The outputs agree with the known-answer tests of the Random123
+   reference implementation. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_rng.h>
+
+#include "counter.c"
+
+#define THREEFRY_PARITY 0x1BD11BDAUL
+
+#define ROTL32(x,r) ((((x) << (r)) & CTR_MASK) | ((x) >> (32 - (r))))
+
+static inline unsigned long int threefry4x32_get (void *vstate);
+static double threefry4x32_get_double (void *vstate);
+static void threefry4x32_set (void *state, unsigned long int s);
+
+static const int threefry_rot[8][2] = {
+  {10, 26}, {11, 21}, {13, 27}, {23, 5}, {6, 20}, {17, 11}, {25, 10}, {18, 20}
+};
+
+static void
+threefry4x32_block (const unsigned long int ctr[4], const unsigned long int key[4],
+                    unsigned long int out[4])
+{
+  unsigned long int ks[5];
+  unsigned long int x[4];
+  int i, r;
+
+  ks[4] = THREEFRY_PARITY;
+
+  for (i = 0; i < 4; i++)
+    {
+      ks[i] = key[i];
+      ks[4] ^= key[i];
+      x[i] = (ctr[i] + ks[i]) & CTR_MASK;
+    }
+
+  for (r = 0; r < 20; r++)
+    {
+      const int *rot = threefry_rot[r % 8];
+
+      if (r % 2 == 0)
+        {
+          x[0] = (x[0] + x[1]) & CTR_MASK;
+          x[1] = ROTL32 (x[1], rot[0]) ^ x[0];
+          x[2] = (x[2] + x[3]) & CTR_MASK;
+          x[3] = ROTL32 (x[3], rot[1]) ^ x[2];
+        }
+      else
+        {
+          x[0] = (x[0] + x[3]) & CTR_MASK;
+          x[3] = ROTL32 (x[3], rot[0]) ^ x[0];
+          x[2] = (x[2] + x[1]) & CTR_MASK;
+          x[1] = ROTL32 (x[1], rot[1]) ^ x[2];
+        }
+
+      if (r % 4 == 3)
+        {
+          /* key injection */
+          const unsigned long int s = (r + 1) / 4;
+
+          for (i = 0; i < 4; i++)
+            x[i] = (x[i] + ks[(s + i) % 5]) & CTR_MASK;
+
+          x[3] = (x[3] + s) & CTR_MASK;
+        }
+    }
+
+  for (i = 0; i < 4; i++)
+    out[i] = x[i];
+}
+
+static inline unsigned long int
+threefry4x32_get (void *vstate)
+{
+  return counter_get ((counter_state_t *) vstate, &threefry4x32_block);
+}
+
+static double
+threefry4x32_get_double (void *vstate)
+{
+  return threefry4x32_get (vstate) / 4294967296.0;
+}
+
+static void
+threefry4x32_get_fill (void *vstate, unsigned long int x[], size_t n)
+{
+  counter_fill ((counter_state_t *) vstate, &threefry4x32_block, x, n);
+}
+
+static void
+threefry4x32_get_double_fill (void *vstate, double x[], size_t n)
+{
+  counter_state_t *state = (counter_state_t *) vstate;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    x[i] = counter_get (state, &threefry4x32_block) / 4294967296.0;
+}
+
+static void
+threefry4x32_jump (void *vstate, unsigned long int n)
+{
+  counter_jump ((counter_state_t *) vstate, &threefry4x32_block, n);
+}
+
+static void
+threefry4x32_set_stream (void *vstate, unsigned long int s, unsigned long int stream)
+{
+  counter_set ((counter_state_t *) vstate, &threefry4x32_block, s, stream, 4);
+}
+
+static void
+threefry4x32_set (void *vstate, unsigned long int s)
+{
+  counter_set ((counter_state_t *) vstate, &threefry4x32_block, s, 0, 4);
+}
+
+static const gsl_rng_type threefry4x32_type =
+{"threefry4x32",                /* name */
+ 0xffffffffUL,                  /* RAND_MAX */
+ 0,                             /* RAND_MIN */
+ sizeof (counter_state_t),
+ &threefry4x32_set,
+ &threefry4x32_get,
+ &threefry4x32_get_double,
+ &threefry4x32_get_fill,
+ &threefry4x32_get_double_fill,
+ &threefry4x32_jump,
+ &threefry4x32_set_stream};
+
+const gsl_rng_type *gsl_rng_threefry4x32 = &threefry4x32_type;
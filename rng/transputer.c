@@ -21,6 +21,8 @@
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
 
+#include "jump.c"
+
 /* This is the INMOS Transputer Development System generator. The sequence is,
 
    x_{n+1} = (a x_n) mod m
@@ -35,6 +37,7 @@
 static inline unsigned long int transputer_get (void *vstate);
 static double transputer_get_double (void *vstate);
 static void transputer_set (void *state, unsigned long int s);
+static void transputer_jump (void *state, unsigned long int n);
 
 typedef struct
   {
@@ -71,6 +74,14 @@ transputer_set (void *vstate, unsigned long int s)
   return;
 }
 
+static void
+transputer_jump (void *vstate, unsigned long int n)
+{
+  transputer_state_t *state = (transputer_state_t *) vstate;
+
+  state->x = lcg_jump (state->x, 1664525, 0, n, 0xffffffffUL);
+}
+
 static const gsl_rng_type transputer_type =
 {"transputer",                          /* name */
  0xffffffffUL,                  /* RAND_MAX */
@@ -78,6 +89,10 @@ static const gsl_rng_type transputer_type =
  sizeof (transputer_state_t),
  &transputer_set,
  &transputer_get,
- &transputer_get_double};
+ &transputer_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ &transputer_jump,
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_transputer = &transputer_type;
@@ -138,6 +138,10 @@ static const gsl_rng_type tt_type =
  sizeof (tt_state_t),
  &tt_set,
  &tt_get,
- &tt_get_double};
+ &tt_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ 0,                             /* jump */
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_tt800 = &tt_type;
@@ -196,6 +196,10 @@ static const gsl_rng_type uni_type =
  sizeof (uni_state_t),
  &uni_set,
  &uni_get,
- &uni_get_double};
+ &uni_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ 0,                             /* jump */
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_uni = &uni_type;
@@ -21,6 +21,8 @@
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
 
+#include "jump.c"
+
 /* This is the old vax generator MTH$RANDOM. The sequence is,
 
    x_{n+1} = (a x_n + c) mod m
@@ -35,6 +37,7 @@
 static inline unsigned long int vax_get (void *vstate);
 static double vax_get_double (void *vstate);
 static void vax_set (void *state, unsigned long int s);
+static void vax_jump (void *state, unsigned long int n);
 
 typedef struct
   {
@@ -71,6 +74,14 @@ vax_set (void *vstate, unsigned long int s)
   return;
 }
 
+static void
+vax_jump (void *vstate, unsigned long int n)
+{
+  vax_state_t *state = (vax_state_t *) vstate;
+
+  state->x = lcg_jump (state->x, 69069, 1, n, 0xffffffffUL);
+}
+
 static const gsl_rng_type vax_type =
 {"vax",                         /* name */
  0xffffffffUL,                  /* RAND_MAX */
@@ -78,6 +89,10 @@ static const gsl_rng_type vax_type =
  sizeof (vax_state_t),
  &vax_set,
  &vax_get,
- &vax_get_double};
+ &vax_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ &vax_jump,
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_vax = &vax_type;
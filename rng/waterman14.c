@@ -35,12 +35,15 @@
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
 
+#include "jump.c"
+
 #define AA 1566083941UL
 #define MM 0xffffffffUL         /* 2 ^ 32 - 1 */
 
 static inline unsigned long int ran_get (void *vstate);
 static double ran_get_double (void *vstate);
 static void ran_set (void *state, unsigned long int s);
+static void ran_jump (void *state, unsigned long int n);
 
 typedef struct
 {
@@ -79,6 +82,14 @@ ran_set (void *vstate, unsigned long int s)
   return;
 }
 
+static void
+ran_jump (void *vstate, unsigned long int n)
+{
+  ran_state_t *state = (ran_state_t *) vstate;
+
+  state->x = lcg_jump (state->x, AA, 0, n, MM);
+}
+
 static const gsl_rng_type ran_type = {
   "waterman14",                 /* name */
   MM,                           /* RAND_MAX */
@@ -86,7 +97,11 @@ static const gsl_rng_type ran_type = {
   sizeof (ran_state_t),
   &ran_set,
   &ran_get,
-  &ran_get_double
+  &ran_get_double,
+  0,                            /* get_fill */
+  0,                            /* get_double_fill */
+  &ran_jump,
+  0                             /* set_stream */
 };
 
 const gsl_rng_type *gsl_rng_waterman14 = &ran_type;
@@ -136,6 +136,10 @@ static const gsl_rng_type zuf_type =
  sizeof (zuf_state_t),
  &zuf_set,
  &zuf_get,
- &zuf_get_double};
+ &zuf_get_double,
+ 0,                             /* get_fill */
+ 0,                             /* get_double_fill */
+ 0,                             /* jump */
+ 0};                            /* set_stream */
 
 const gsl_rng_type *gsl_rng_zuf = &zuf_type;
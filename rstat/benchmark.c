@@ -0,0 +1,253 @@
+/* rstat/benchmark.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Compare the quantile estimators with the exact quantiles computed by
+   sorting the data, for a lognormal sample resembling a distribution
+   of latencies.  For each method the time taken and the size of the
+   largest error are printed, the error being measured both in rank,
+   as a fraction of the number of data, and relative to the exact
+   quantile.  The number of data can be given on the command line
+   (default 10^7). */
+
+#include <config.h>
+#include <time.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_sort.h>
+#include <gsl/gsl_statistics.h>
+#include <gsl/gsl_rstat.h>
+
+#define NP 9
+#define NPARTS 8
+
+static const double prob[NP] =
+  { 0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999 };
+
+static double *sorted;
+static size_t n;
+
+/* fraction of the data <= x */
+static double
+rank_of (const double x)
+{
+  size_t lo = 0, hi = n;
+
+  while (lo < hi)
+    {
+      size_t mid = (lo + hi) / 2;
+
+      if (sorted[mid] <= x)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+  return lo / (double) n;
+}
+
+static void
+report (const char *name, const double t, const double q[NP])
+{
+  double rank_err = 0.0, rel_err = 0.0;
+  int i;
+
+  for (i = 0; i < NP; i++)
+    {
+      const double exact = gsl_stats_quantile_from_sorted_data (sorted, 1, n, prob[i]);
+      const double e1 = fabs (rank_of (q[i]) - prob[i]);
+      const double e2 = fabs (q[i] - exact) / fabs (exact);
+
+      rank_err = GSL_MAX (rank_err, e1);
+      rel_err = GSL_MAX (rel_err, e2);
+    }
+
+  printf ("%-28s %8.3f s  %10.2e  %10.2e\n", name, t, rank_err, rel_err);
+}
+
+static double
+seconds (clock_t start)
+{
+  return (clock () - start) / (double) CLOCKS_PER_SEC;
+}
+
+int
+main (int argc, char *argv[])
+{
+  gsl_rng *r;
+  double *data;
+  double q[NP];
+  clock_t start;
+  size_t i, j;
+  int k;
+
+  n = (argc > 1) ? (size_t) atof (argv[1]) : 10000000;
+
+  gsl_rng_env_setup ();
+  r = gsl_rng_alloc (gsl_rng_default);
+
+  data = malloc (n * sizeof (double));
+  sorted = malloc (n * sizeof (double));
+
+  for (i = 0; i < n; i++)
+    data[i] = gsl_ran_lognormal (r, 0.0, 1.0);
+
+  printf ("n = %lu\n", (unsigned long) n);
+  printf ("%-28s %10s  %10s  %10s\n", "method", "time", "rank err", "rel err");
+
+  /* exact quantiles from the sorted data */
+  start = clock ();
+  memcpy (sorted, data, n * sizeof (double));
+  gsl_sort (sorted, 1, n);
+  for (k = 0; k < NP; k++)
+    q[k] = gsl_stats_quantile_from_sorted_data (sorted, 1, n, prob[k]);
+  report ("sort", seconds (start), q);
+
+  /* one P^2 estimator per quantile */
+  {
+    gsl_rstat_quantile_workspace *w[NP];
+
+    for (k = 0; k < NP; k++)
+      w[k] = gsl_rstat_quantile_alloc (prob[k]);
+
+    start = clock ();
+    for (i = 0; i < n; i++)
+      for (k = 0; k < NP; k++)
+        gsl_rstat_quantile_add (data[i], w[k]);
+    for (k = 0; k < NP; k++)
+      q[k] = gsl_rstat_quantile_get (w[k]);
+    report ("P^2", seconds (start), q);
+
+    for (k = 0; k < NP; k++)
+      gsl_rstat_quantile_free (w[k]);
+  }
+
+  /* KLL sketches */
+  {
+    const size_t kk[2] = { 200, 1000 };
+    char name[64];
+    int m;
+
+    for (m = 0; m < 2; m++)
+      {
+        gsl_rstat_kll_workspace *w = gsl_rstat_kll_alloc (kk[m]);
+
+        start = clock ();
+        for (i = 0; i < n; i++)
+          gsl_rstat_kll_add (data[i], w);
+        for (k = 0; k < NP; k++)
+          q[k] = gsl_rstat_kll_quantile (prob[k], w);
+        sprintf (name, "KLL k=%lu", (unsigned long) kk[m]);
+        report (name, seconds (start), q);
+
+        gsl_rstat_kll_reset (w);
+        start = clock ();
+        gsl_rstat_kll_add_array (data, 1, n, w);
+        for (k = 0; k < NP; k++)
+          q[k] = gsl_rstat_kll_quantile (prob[k], w);
+        sprintf (name, "KLL k=%lu (add_array)", (unsigned long) kk[m]);
+        report (name, seconds (start), q);
+
+        /* sketches of separate parts, merged */
+        {
+          gsl_rstat_kll_workspace *v = gsl_rstat_kll_alloc (kk[m]);
+
+          gsl_rstat_kll_reset (w);
+          start = clock ();
+          for (j = 0; j < NPARTS; j++)
+            {
+              const size_t a = j * n / NPARTS, b = (j + 1) * n / NPARTS;
+
+              gsl_rstat_kll_reset (v);
+              gsl_rstat_kll_add_array (data + a, 1, b - a, v);
+              gsl_rstat_kll_merge (w, v);
+            }
+          for (k = 0; k < NP; k++)
+            q[k] = gsl_rstat_kll_quantile (prob[k], w);
+          sprintf (name, "KLL k=%lu (%d merged)", (unsigned long) kk[m], NPARTS);
+          report (name, seconds (start), q);
+
+          gsl_rstat_kll_free (v);
+        }
+
+        gsl_rstat_kll_free (w);
+      }
+  }
+
+  /* t-digests */
+  {
+    const double dd[2] = { 100.0, 500.0 };
+    char name[64];
+    int m;
+
+    for (m = 0; m < 2; m++)
+      {
+        gsl_rstat_tdigest_workspace *w = gsl_rstat_tdigest_alloc (dd[m]);
+
+        start = clock ();
+        for (i = 0; i < n; i++)
+          gsl_rstat_tdigest_add (data[i], w);
+        for (k = 0; k < NP; k++)
+          q[k] = gsl_rstat_tdigest_quantile (prob[k], w);
+        sprintf (name, "t-digest delta=%g", dd[m]);
+        report (name, seconds (start), q);
+
+        gsl_rstat_tdigest_reset (w);
+        start = clock ();
+        gsl_rstat_tdigest_add_array (data, 1, n, w);
+        for (k = 0; k < NP; k++)
+          q[k] = gsl_rstat_tdigest_quantile (prob[k], w);
+        sprintf (name, "t-digest delta=%g (add_array)", dd[m]);
+        report (name, seconds (start), q);
+
+        {
+          gsl_rstat_tdigest_workspace *v = gsl_rstat_tdigest_alloc (dd[m]);
+
+          gsl_rstat_tdigest_reset (w);
+          start = clock ();
+          for (j = 0; j < NPARTS; j++)
+            {
+              const size_t a = j * n / NPARTS, b = (j + 1) * n / NPARTS;
+
+              gsl_rstat_tdigest_reset (v);
+              gsl_rstat_tdigest_add_array (data + a, 1, b - a, v);
+              gsl_rstat_tdigest_merge (w, v);
+            }
+          for (k = 0; k < NP; k++)
+            q[k] = gsl_rstat_tdigest_quantile (prob[k], w);
+          sprintf (name, "t-digest delta=%g (%d merged)", dd[m], NPARTS);
+          report (name, seconds (start), q);
+
+          gsl_rstat_tdigest_free (v);
+        }
+
+        gsl_rstat_tdigest_free (w);
+      }
+  }
+
+  free (data);
+  free (sorted);
+  gsl_rng_free (r);
+
+  return 0;
+}
@@ -0,0 +1,56 @@
+/* rstat/fileio.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* binary input and output of the sketches, in native format */
+
+static int
+rstat_fwrite(FILE *stream, const void *data, const size_t size, const size_t n)
+{
+  size_t items;
+
+  if (n == 0)
+    return GSL_SUCCESS;
+
+  items = fwrite(data, size, n, stream);
+
+  if (items != n)
+    {
+      GSL_ERROR ("fwrite failed", GSL_EFAILED);
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+rstat_fread(FILE *stream, void *data, const size_t size, const size_t n)
+{
+  size_t items;
+
+  if (n == 0)
+    return GSL_SUCCESS;
+
+  items = fread(data, size, n, stream);
+
+  if (items != n)
+    {
+      GSL_ERROR ("fread failed", GSL_EFAILED);
+    }
+
+  return GSL_SUCCESS;
+}
@@ -20,6 +20,7 @@
 #ifndef __GSL_RSTAT_H__
 #define __GSL_RSTAT_H__
 
+#include <stdio.h>
 #include <stdlib.h>
 
 #undef __BEGIN_DECLS
@@ -49,6 +50,69 @@ void gsl_rstat_quantile_free(gsl_rstat_quantile_workspace *w);
 int gsl_rstat_quantile_reset(gsl_rstat_quantile_workspace *w);
 int gsl_rstat_quantile_add(const double x, gsl_rstat_quantile_workspace *w);
 double gsl_rstat_quantile_get(gsl_rstat_quantile_workspace *w);
+int gsl_rstat_quantile_merge(gsl_rstat_quantile_workspace *dest,
+                             const gsl_rstat_quantile_workspace *src);
+
+#define GSL_RSTAT_KLL_LEVELS 64
+
+typedef struct
+{
+  size_t k;                             /* capacity of the top level */
+  size_t n;                             /* number of data added */
+  size_t nlevels;                       /* number of levels in use */
+  double *level[GSL_RSTAT_KLL_LEVELS];  /* items of weight 2^h, sorted for h > 0 */
+  size_t size[GSL_RSTAT_KLL_LEVELS];    /* number of items at each level */
+  size_t alloc[GSL_RSTAT_KLL_LEVELS];   /* allocated length of each level */
+  double min;                           /* minimum value added */
+  double max;                           /* maximum value added */
+  unsigned long int coin;               /* state of compaction coin flips */
+  double *view_x;                       /* sorted items */
+  double *view_r;                       /* central ranks of sorted items */
+  size_t view_n;                        /* number of items in view */
+  size_t view_alloc;                    /* allocated length of view */
+  int view_valid;                       /* view is up to date */
+} gsl_rstat_kll_workspace;
+
+gsl_rstat_kll_workspace *gsl_rstat_kll_alloc(const size_t k);
+void gsl_rstat_kll_free(gsl_rstat_kll_workspace *w);
+int gsl_rstat_kll_reset(gsl_rstat_kll_workspace *w);
+size_t gsl_rstat_kll_n(const gsl_rstat_kll_workspace *w);
+int gsl_rstat_kll_add(const double x, gsl_rstat_kll_workspace *w);
+int gsl_rstat_kll_add_array(const double x[], const size_t stride,
+                            const size_t n, gsl_rstat_kll_workspace *w);
+int gsl_rstat_kll_merge(gsl_rstat_kll_workspace *dest,
+                        const gsl_rstat_kll_workspace *src);
+double gsl_rstat_kll_quantile(const double p, gsl_rstat_kll_workspace *w);
+double gsl_rstat_kll_cdf(const double x, gsl_rstat_kll_workspace *w);
+int gsl_rstat_kll_fwrite(FILE *stream, const gsl_rstat_kll_workspace *w);
+int gsl_rstat_kll_fread(FILE *stream, gsl_rstat_kll_workspace *w);
+
+typedef struct
+{
+  double delta;       /* compression parameter */
+  size_t size;        /* length of the arrays mean and weight */
+  size_t ncentroids;  /* number of centroids, sorted by mean */
+  size_t nbuf;        /* number of unmerged points after the centroids */
+  double *mean;       /* centroid means */
+  double *weight;     /* centroid weights */
+  size_t n;           /* number of data added */
+  double min;         /* minimum value added */
+  double max;         /* maximum value added */
+} gsl_rstat_tdigest_workspace;
+
+gsl_rstat_tdigest_workspace *gsl_rstat_tdigest_alloc(const double delta);
+void gsl_rstat_tdigest_free(gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_reset(gsl_rstat_tdigest_workspace *w);
+size_t gsl_rstat_tdigest_n(const gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_add(const double x, gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_add_array(const double x[], const size_t stride,
+                                const size_t n, gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_merge(gsl_rstat_tdigest_workspace *dest,
+                            const gsl_rstat_tdigest_workspace *src);
+double gsl_rstat_tdigest_quantile(const double p, gsl_rstat_tdigest_workspace *w);
+double gsl_rstat_tdigest_cdf(const double x, gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_fwrite(FILE *stream, const gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_fread(FILE *stream, gsl_rstat_tdigest_workspace *w);
 
 typedef struct
 {
@@ -66,6 +130,9 @@ gsl_rstat_workspace *gsl_rstat_alloc(void);
 void gsl_rstat_free(gsl_rstat_workspace *w);
 size_t gsl_rstat_n(const gsl_rstat_workspace *w);
 int gsl_rstat_add(const double x, gsl_rstat_workspace *w);
+int gsl_rstat_add_array(const double x[], const size_t stride, const size_t n,
+                        gsl_rstat_workspace *w);
+int gsl_rstat_merge(gsl_rstat_workspace *dest, const gsl_rstat_workspace *src);
 double gsl_rstat_min(const gsl_rstat_workspace *w);
 double gsl_rstat_max(const gsl_rstat_workspace *w);
 double gsl_rstat_mean(const gsl_rstat_workspace *w);
@@ -0,0 +1,661 @@
+/* rstat/kll.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_sort.h>
+#include <gsl/gsl_rstat.h>
+
+#include "fileio.h"
+
+/*
+ * Mergeable quantile sketch based on the paper
+ *
+ * [1] Z. Karnin, K. Lang and E. Liberty, "Optimal quantile
+ *     approximation in streams", IEEE FOCS 2016, 71--78
+ *
+ * The items are kept in levels; an item at level h stands for 2^h
+ * data.  When a level reaches its capacity it is sorted and every
+ * second item, starting at a random offset, is promoted to the level
+ * above, the others being discarded.  The top level has capacity k and
+ * the capacities decrease geometrically, by a factor 2/3, towards the
+ * bottom, so the sketch holds fewer than 3k items plus 8 per level.
+ * Two sketches are merged by concatenating their levels and compacting
+ * as necessary, so sketches built on separate parts of a dataset can
+ * be combined into a sketch of the whole.
+ *
+ * The random offsets come from a fixed xorshift generator, so the
+ * results are reproducible.
+ */
+
+static int kll_compress(gsl_rstat_kll_workspace *w);
+static int kll_compact(const size_t h, gsl_rstat_kll_workspace *w);
+static int kll_reserve(const size_t h, const size_t len,
+                       gsl_rstat_kll_workspace *w);
+static size_t kll_capacity(const size_t h, const gsl_rstat_kll_workspace *w);
+static int kll_view(gsl_rstat_kll_workspace *w);
+
+#define KLL_SEED 0x9e3779b9UL
+#define KLL_MIN_CAPACITY 8
+
+gsl_rstat_kll_workspace *
+gsl_rstat_kll_alloc(const size_t k)
+{
+  gsl_rstat_kll_workspace *w;
+
+  if (k < KLL_MIN_CAPACITY)
+    {
+      GSL_ERROR_NULL ("k must be at least 8", GSL_EINVAL);
+    }
+
+  w = calloc(1, sizeof(gsl_rstat_kll_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->k = k;
+
+  gsl_rstat_kll_reset(w);
+
+  return w;
+} /* gsl_rstat_kll_alloc() */
+
+void
+gsl_rstat_kll_free(gsl_rstat_kll_workspace *w)
+{
+  size_t h;
+
+  RETURN_IF_NULL (w);
+
+  for (h = 0; h < GSL_RSTAT_KLL_LEVELS; ++h)
+    free(w->level[h]);
+
+  free(w->view_x);
+  free(w->view_r);
+  free(w);
+} /* gsl_rstat_kll_free() */
+
+int
+gsl_rstat_kll_reset(gsl_rstat_kll_workspace *w)
+{
+  size_t h;
+
+  /* the level arrays are kept for reuse */
+  for (h = 0; h < GSL_RSTAT_KLL_LEVELS; ++h)
+    w->size[h] = 0;
+
+  w->n = 0;
+  w->nlevels = 1;
+  w->min = 0.0;
+  w->max = 0.0;
+  w->coin = KLL_SEED;
+  w->view_n = 0;
+  w->view_valid = 0;
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_kll_reset() */
+
+size_t
+gsl_rstat_kll_n(const gsl_rstat_kll_workspace *w)
+{
+  return w->n;
+} /* gsl_rstat_kll_n() */
+
+int
+gsl_rstat_kll_add(const double x, gsl_rstat_kll_workspace *w)
+{
+  int status;
+
+  if (isnan(x))
+    {
+      GSL_ERROR ("invalid input argument x", GSL_EINVAL);
+    }
+
+  status = kll_reserve(0, w->size[0] + 1, w);
+  if (status)
+    return status;
+
+  if (w->n == 0)
+    {
+      w->min = x;
+      w->max = x;
+    }
+  else
+    {
+      if (x < w->min)
+        w->min = x;
+      if (x > w->max)
+        w->max = x;
+    }
+
+  w->level[0][w->size[0]++] = x;
+  ++(w->n);
+  w->view_valid = 0;
+
+  if (w->size[0] >= kll_capacity(0, w))
+    return kll_compress(w);
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_kll_add() */
+
+/* add n data points, with stride; level 0 is filled up to its capacity
+   a block at a time */
+int
+gsl_rstat_kll_add_array(const double x[], const size_t stride,
+                        const size_t n, gsl_rstat_kll_workspace *w)
+{
+  size_t i = 0;
+
+  if (n == 0)
+    return GSL_SUCCESS;
+
+  if (w->n == 0)
+    {
+      w->min = x[0];
+      w->max = x[0];
+    }
+
+  w->view_valid = 0;
+
+  while (i < n)
+    {
+      const size_t cap = kll_capacity(0, w);
+      const size_t m = GSL_MIN(cap > w->size[0] ? cap - w->size[0] : 1, n - i);
+      double *y;
+      double min = w->min, max = w->max;
+      size_t j;
+      int status;
+
+      status = kll_reserve(0, w->size[0] + m, w);
+      if (status)
+        return status;
+
+      y = w->level[0] + w->size[0];
+
+      for (j = 0; j < m; ++j)
+        {
+          const double xj = x[(i + j) * stride];
+
+          if (isnan(xj))
+            {
+              /* keep the points before the NaN */
+              w->min = min;
+              w->max = max;
+              w->size[0] += j;
+              w->n += j;
+              GSL_ERROR ("invalid input argument x", GSL_EINVAL);
+            }
+
+          if (xj < min)
+            min = xj;
+          if (xj > max)
+            max = xj;
+
+          y[j] = xj;
+        }
+
+      w->min = min;
+      w->max = max;
+      w->size[0] += m;
+      w->n += m;
+      i += m;
+
+      if (w->size[0] >= cap)
+        {
+          status = kll_compress(w);
+          if (status)
+            return status;
+        }
+    }
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_kll_add_array() */
+
+/* merge the sorted array b[0..nb-1] into the sorted array a[0..na-1],
+   which has room for na + nb items */
+static void
+merge_sorted(double *a, const size_t na, const double *b, const size_t nb)
+{
+  size_t i = na, j = nb, k = na + nb;
+
+  while (j > 0)
+    {
+      if (i > 0 && a[i - 1] > b[j - 1])
+        a[--k] = a[--i];
+      else
+        a[--k] = b[--j];
+    }
+}
+
+int
+gsl_rstat_kll_merge(gsl_rstat_kll_workspace *dest,
+                    const gsl_rstat_kll_workspace *src)
+{
+  size_t h;
+
+  if (dest->k != src->k)
+    {
+      GSL_ERROR ("sketches must have the same k", GSL_EINVAL);
+    }
+
+  if (src->n == 0)
+    return GSL_SUCCESS;
+
+  if (dest->n == 0)
+    {
+      dest->min = src->min;
+      dest->max = src->max;
+    }
+  else
+    {
+      if (src->min < dest->min)
+        dest->min = src->min;
+      if (src->max > dest->max)
+        dest->max = src->max;
+    }
+
+  if (dest->nlevels < src->nlevels)
+    dest->nlevels = src->nlevels;
+
+  for (h = 0; h < src->nlevels; ++h)
+    {
+      const size_t m = src->size[h];
+      int status;
+
+      if (m == 0)
+        continue;
+
+      status = kll_reserve(h, dest->size[h] + m, dest);
+      if (status)
+        return status;
+
+      if (h == 0)
+        memcpy(dest->level[0] + dest->size[0], src->level[0], m * sizeof(double));
+      else
+        merge_sorted(dest->level[h], dest->size[h], src->level[h], m);
+
+      dest->size[h] += m;
+    }
+
+  dest->n += src->n;
+  dest->view_valid = 0;
+
+  return kll_compress(dest);
+} /* gsl_rstat_kll_merge() */
+
+/* estimate of the p-quantile, interpolating between the items as
+   gsl_stats_quantile_from_sorted_data does between the data */
+double
+gsl_rstat_kll_quantile(const double p, gsl_rstat_kll_workspace *w)
+{
+  const double *x, *r;
+  double t;
+  size_t lo, hi;
+
+  if (w->n == 0)
+    return GSL_NAN;
+
+  if (p <= 0.0)
+    return w->min;
+
+  if (p >= 1.0)
+    return w->max;
+
+  if (kll_view(w))
+    return GSL_NAN;
+
+  /* item i stands for the data of ranks about r[i]; beyond the first
+     and last items, which may stand for many data, no attempt is made
+     to extrapolate towards the minimum and maximum */
+
+  x = w->view_x;
+  r = w->view_r;
+  t = p * (w->n - 1.0);
+
+  if (t <= r[0])
+    return x[0];
+
+  if (t >= r[w->view_n - 1])
+    return x[w->view_n - 1];
+
+  /* find r[lo] < t <= r[hi] with hi = lo + 1 */
+  lo = 0;
+  hi = w->view_n - 1;
+
+  while (hi - lo > 1)
+    {
+      size_t mid = (lo + hi) / 2;
+
+      if (r[mid] < t)
+        lo = mid;
+      else
+        hi = mid;
+    }
+
+  return x[lo] + (x[hi] - x[lo]) * (t - r[lo]) / (r[hi] - r[lo]);
+} /* gsl_rstat_kll_quantile() */
+
+/* estimate of the fraction of the data <= x */
+double
+gsl_rstat_kll_cdf(const double x, gsl_rstat_kll_workspace *w)
+{
+  const double *v, *r;
+  size_t lo, hi;
+
+  if (w->n == 0)
+    return GSL_NAN;
+
+  if (x < w->min)
+    return 0.0;
+
+  if (x >= w->max)
+    return 1.0;
+
+  if (kll_view(w))
+    return GSL_NAN;
+
+  v = w->view_x;
+  r = w->view_r;
+
+  if (x < v[0])
+    return 0.0;
+
+  /* find the last item <= x */
+  lo = 0;
+  hi = w->view_n;
+
+  while (hi - lo > 1)
+    {
+      size_t mid = (lo + hi) / 2;
+
+      if (v[mid] <= x)
+        lo = mid;
+      else
+        hi = mid;
+    }
+
+  /* r[lo] is the centre of the ranks covered by item lo, and
+     r[lo+1] - r[lo] is the mean of their weights */
+  {
+    const double wl = (lo + 1 < w->view_n) ? r[lo + 1] - r[lo] : (w->n - 1.0) - r[lo];
+    const double c = r[lo] + 0.5 * (wl + 1.0);
+
+    return GSL_MIN(c, (double) w->n) / w->n;
+  }
+} /* gsl_rstat_kll_cdf() */
+
+int
+gsl_rstat_kll_fwrite(FILE *stream, const gsl_rstat_kll_workspace *w)
+{
+  size_t h;
+  int status;
+
+  status = rstat_fwrite(stream, &(w->k), sizeof(size_t), 1);
+  if (!status)
+    status = rstat_fwrite(stream, &(w->n), sizeof(size_t), 1);
+  if (!status)
+    status = rstat_fwrite(stream, &(w->nlevels), sizeof(size_t), 1);
+  if (!status)
+    status = rstat_fwrite(stream, &(w->min), sizeof(double), 1);
+  if (!status)
+    status = rstat_fwrite(stream, &(w->max), sizeof(double), 1);
+  if (!status)
+    status = rstat_fwrite(stream, &(w->coin), sizeof(unsigned long int), 1);
+  if (!status)
+    status = rstat_fwrite(stream, w->size, sizeof(size_t), w->nlevels);
+
+  for (h = 0; h < w->nlevels && !status; ++h)
+    status = rstat_fwrite(stream, w->level[h], sizeof(double), w->size[h]);
+
+  return status;
+} /* gsl_rstat_kll_fwrite() */
+
+int
+gsl_rstat_kll_fread(FILE *stream, gsl_rstat_kll_workspace *w)
+{
+  size_t k, nlevels, h;
+  int status;
+
+  status = rstat_fread(stream, &k, sizeof(size_t), 1);
+  if (status)
+    return status;
+
+  if (k != w->k)
+    {
+      GSL_ERROR ("sketch in file has a different k", GSL_EBADLEN);
+    }
+
+  gsl_rstat_kll_reset(w);
+
+  status = rstat_fread(stream, &(w->n), sizeof(size_t), 1);
+  if (!status)
+    status = rstat_fread(stream, &nlevels, sizeof(size_t), 1);
+
+  if (!status && (nlevels < 1 || nlevels > GSL_RSTAT_KLL_LEVELS))
+    {
+      gsl_rstat_kll_reset(w);
+      GSL_ERROR ("invalid number of levels in file", GSL_EFAILED);
+    }
+
+  if (!status)
+    status = rstat_fread(stream, &(w->min), sizeof(double), 1);
+  if (!status)
+    status = rstat_fread(stream, &(w->max), sizeof(double), 1);
+  if (!status)
+    status = rstat_fread(stream, &(w->coin), sizeof(unsigned long int), 1);
+  if (!status)
+    status = rstat_fread(stream, w->size, sizeof(size_t), nlevels);
+
+  for (h = 0; h < nlevels && !status; ++h)
+    {
+      status = kll_reserve(h, w->size[h], w);
+      if (!status)
+        status = rstat_fread(stream, w->level[h], sizeof(double), w->size[h]);
+    }
+
+  if (status)
+    {
+      gsl_rstat_kll_reset(w);
+      return status;
+    }
+
+  w->nlevels = nlevels;
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_kll_fread() */
+
+/* capacity of level h: k at the top level, falling by a factor 2/3 per
+   level below it, but at least KLL_MIN_CAPACITY */
+static size_t
+kll_capacity(const size_t h, const gsl_rstat_kll_workspace *w)
+{
+  size_t depth = w->nlevels - 1 - h;
+  size_t c = w->k;
+
+  while (depth-- > 0 && c > KLL_MIN_CAPACITY)
+    c = (2 * c + 2) / 3;
+
+  return GSL_MAX(c, KLL_MIN_CAPACITY);
+}
+
+static int
+kll_reserve(const size_t h, const size_t len, gsl_rstat_kll_workspace *w)
+{
+  if (w->alloc[h] < len)
+    {
+      size_t alloc = GSL_MAX(len, 2 * w->alloc[h]);
+      double *p;
+
+      alloc = GSL_MAX(alloc, 8);
+      p = realloc(w->level[h], alloc * sizeof(double));
+
+      if (p == 0)
+        {
+          GSL_ERROR ("failed to allocate space for sketch level", GSL_ENOMEM);
+        }
+
+      w->level[h] = p;
+      w->alloc[h] = alloc;
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* compact every level which has reached its capacity */
+static int
+kll_compress(gsl_rstat_kll_workspace *w)
+{
+  size_t h;
+
+  for (h = 0; h < w->nlevels; ++h)
+    {
+      if (w->size[h] >= kll_capacity(h, w))
+        {
+          int status = kll_compact(h, w);
+          if (status)
+            return status;
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* promote every second item of level h to level h + 1 */
+static int
+kll_compact(const size_t h, gsl_rstat_kll_workspace *w)
+{
+  double *x = w->level[h];
+  const size_t m = w->size[h];
+  const size_t s = m & 1;       /* an odd item stays at level h */
+  const size_t count = (m - s) / 2;
+  unsigned long int c = w->coin;
+  size_t offset, i;
+  int status;
+
+  if (h + 1 >= GSL_RSTAT_KLL_LEVELS)
+    {
+      GSL_ERROR ("too many levels in sketch", GSL_EFAILED);
+    }
+
+  if (h + 1 == w->nlevels)
+    ++(w->nlevels);
+
+  status = kll_reserve(h + 1, w->size[h + 1] + count, w);
+  if (status)
+    return status;
+
+  if (h == 0)
+    gsl_sort(x, 1, m);
+
+  /* xorshift coin flip for the offset */
+  c ^= (c << 13) & 0xffffffffUL;
+  c ^= c >> 17;
+  c ^= (c << 5) & 0xffffffffUL;
+  w->coin = c;
+  offset = (c >> 16) & 1;
+
+  /* compact in place after the odd item, which stays at x[0], then
+     merge into the level above */
+  for (i = 0; i < count; ++i)
+    x[s + i] = x[s + offset + 2 * i];
+
+  merge_sorted(w->level[h + 1], w->size[h + 1], x + s, count);
+  w->size[h + 1] += count;
+  w->size[h] = s;
+
+  return GSL_SUCCESS;
+}
+
+/* build the sorted list of items with their central ranks */
+static int
+kll_view(gsl_rstat_kll_workspace *w)
+{
+  size_t h, m = 0, i;
+  double *wt;
+
+  if (w->view_valid)
+    return GSL_SUCCESS;
+
+  for (h = 0; h < w->nlevels; ++h)
+    m += w->size[h];
+
+  if (w->view_alloc < m)
+    {
+      double *px = realloc(w->view_x, m * sizeof(double));
+      double *pr;
+
+      if (px == 0)
+        {
+          GSL_ERROR ("failed to allocate space for view", GSL_ENOMEM);
+        }
+
+      w->view_x = px;
+
+      pr = realloc(w->view_r, m * sizeof(double));
+      if (pr == 0)
+        {
+          GSL_ERROR ("failed to allocate space for view", GSL_ENOMEM);
+        }
+
+      w->view_r = pr;
+      w->view_alloc = m;
+    }
+
+  /* gather the items with their weights, then sort by value */
+  wt = w->view_r;
+  m = 0;
+
+  for (h = 0; h < w->nlevels; ++h)
+    {
+      const double weight = ldexp(1.0, (int) h);
+
+      for (i = 0; i < w->size[h]; ++i)
+        {
+          w->view_x[m] = w->level[h][i];
+          wt[m] = weight;
+          ++m;
+        }
+    }
+
+  gsl_sort2(w->view_x, 1, wt, 1, m);
+
+  /* replace the weights by the central ranks, counting from 0 */
+  {
+    double cum = 0.0;
+
+    for (i = 0; i < m; ++i)
+      {
+        const double wi = wt[i];
+
+        wt[i] = cum + 0.5 * (wi - 1.0);
+        cum += wi;
+      }
+  }
+
+  w->view_n = m;
+  w->view_valid = 1;
+
+  return GSL_SUCCESS;
+}
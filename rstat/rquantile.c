@@ -21,6 +21,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_sort.h>
 #include <gsl/gsl_statistics.h>
 #include <gsl/gsl_rstat.h>
@@ -195,6 +196,135 @@ gsl_rstat_quantile_get(gsl_rstat_quantile_workspace *w)
     }
 } /* gsl_rstat_quantile_get() */
 
+/* rank of y in the data summarized by w, interpolating linearly between
+   the markers; w must hold more than 5 data */
+static double
+psq_rank(const double y, const gsl_rstat_quantile_workspace *w)
+{
+  int i;
+
+  if (y < w->q[0])
+    return 0.0;
+
+  if (y >= w->q[4])
+    return (double) w->n;
+
+  for (i = 0; i < 4; ++i)
+    {
+      if (y < w->q[i + 1])
+        break;
+    }
+
+  return w->npos[i] + (w->npos[i + 1] - w->npos[i]) *
+         (y - w->q[i]) / (w->q[i + 1] - w->q[i]);
+}
+
+/*
+ * Merge the estimator src into dest.  If either holds at most 5 data
+ * these are simply added to the other one.  Otherwise the markers of
+ * each estimator define a piecewise linear approximation to the
+ * cumulative distribution of its data; the two are added and the new
+ * inner markers placed where the sum reaches the desired positions.
+ * The result is an approximation, like the P^2 estimate itself.
+ */
+int
+gsl_rstat_quantile_merge(gsl_rstat_quantile_workspace *dest,
+                         const gsl_rstat_quantile_workspace *src)
+{
+  if (dest->p != src->p)
+    {
+      GSL_ERROR ("workspaces must estimate the same quantile", GSL_EINVAL);
+    }
+
+  if (src->n <= 5)
+    {
+      size_t i;
+
+      for (i = 0; i < src->n; ++i)
+        gsl_rstat_quantile_add(src->q[i], dest);
+
+      return GSL_SUCCESS;
+    }
+  else if (dest->n <= 5)
+    {
+      gsl_rstat_quantile_workspace tmp = *src;
+      size_t i;
+
+      for (i = 0; i < dest->n; ++i)
+        gsl_rstat_quantile_add(dest->q[i], &tmp);
+
+      *dest = tmp;
+
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      const gsl_rstat_quantile_workspace a = *dest;
+      const double n = (double) (a.n + src->n);
+      double y[10];
+      int i, j;
+
+      /* candidate heights: the markers of both estimators, in order */
+      for (i = 0; i < 5; ++i)
+        {
+          y[i] = a.q[i];
+          y[i + 5] = src->q[i];
+        }
+
+      gsl_sort(y, 1, 10);
+
+      dest->n = a.n + src->n;
+      dest->q[0] = y[0];
+      dest->q[4] = y[9];
+      dest->npos[0] = 1;
+      dest->npos[4] = (int) dest->n;
+
+      for (i = 0; i < 5; ++i)
+        dest->np[i] = 1.0 + (n - 1.0) * dest->dnp[i];
+
+      /* the summed rank is piecewise linear between the candidates */
+      for (i = 1; i <= 3; ++i)
+        {
+          const double target = dest->np[i];
+          double r0 = 0.0, r1 = 0.0;
+
+          for (j = 1; j < 10; ++j)
+            {
+              r1 = psq_rank(y[j], &a) + psq_rank(y[j], src);
+              if (r1 >= target)
+                break;
+            }
+
+          if (j == 10)
+            j = 9;
+
+          r0 = psq_rank(y[j - 1], &a) + psq_rank(y[j - 1], src);
+
+          if (r1 > r0)
+            dest->q[i] = y[j - 1] + (y[j] - y[j - 1]) * (target - r0) / (r1 - r0);
+          else
+            dest->q[i] = y[j];
+
+          dest->npos[i] = (int) floor(target + 0.5);
+        }
+
+      /* keep the marker positions strictly increasing */
+      for (i = 1; i <= 3; ++i)
+        {
+          if (dest->npos[i] <= dest->npos[i - 1])
+            dest->npos[i] = dest->npos[i - 1] + 1;
+        }
+
+      for (i = 3; i >= 1; --i)
+        {
+          if (dest->npos[i] >= dest->npos[i + 1])
+            dest->npos[i] = dest->npos[i + 1] - 1;
+        }
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_rstat_quantile_merge() */
+
 static double
 calc_psq(const double qp1, const double q, const double qm1,
          const double d, const double np1, const double n, const double nm1)
@@ -22,6 +22,7 @@
 #include <math.h>
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
+#include <gsl/gsl_statistics.h>
 #include <gsl/gsl_rstat.h>
 
 gsl_rstat_workspace *
@@ -102,6 +103,74 @@ gsl_rstat_add(const double x, gsl_rstat_workspace *w)
   return GSL_SUCCESS;
 } /* gsl_rstat_add() */
 
+/* merge the moments of a summary into the running totals, using the
+   parallel update formulas of Chan et al, as extended by Pebay */
+static void
+rstat_merge_moments(const gsl_stats_summary_t *s, gsl_rstat_workspace *w)
+{
+  gsl_stats_summary_t a;
+
+  if (s->n == 0)
+    return;
+
+  a.n = w->n;
+  a.mean = w->mean;
+  a.M2 = w->M2;
+  a.M3 = w->M3;
+  a.M4 = w->M4;
+  a.min = (w->n > 0) ? w->min : GSL_POSINF;
+  a.max = (w->n > 0) ? w->max : GSL_NEGINF;
+
+  gsl_stats_summary_merge(&a, s);
+
+  w->n = a.n;
+  w->mean = a.mean;
+  w->M2 = a.M2;
+  w->M3 = a.M3;
+  w->M4 = a.M4;
+  w->min = a.min;
+  w->max = a.max;
+}
+
+/* add n data points, with stride, to the running totals */
+int
+gsl_rstat_add_array(const double x[], const size_t stride, const size_t n,
+                    gsl_rstat_workspace *w)
+{
+  gsl_stats_summary_t s;
+  size_t i;
+
+  /* the moments of the batch are computed in one pass and merged */
+  gsl_stats_summary(x, stride, n, &s);
+  rstat_merge_moments(&s, w);
+
+  /* the median estimator is updated one point at a time */
+  for (i = 0; i < n; ++i)
+    gsl_rstat_quantile_add(x[i * stride], w->median_workspace_p);
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_add_array() */
+
+/* combine the data added to src with those added to dest */
+int
+gsl_rstat_merge(gsl_rstat_workspace *dest, const gsl_rstat_workspace *src)
+{
+  gsl_stats_summary_t s;
+
+  s.n = src->n;
+  s.mean = src->mean;
+  s.M2 = src->M2;
+  s.M3 = src->M3;
+  s.M4 = src->M4;
+  s.min = src->min;
+  s.max = src->max;
+
+  rstat_merge_moments(&s, dest);
+
+  return gsl_rstat_quantile_merge(dest->median_workspace_p,
+                                  src->median_workspace_p);
+} /* gsl_rstat_merge() */
+
 double
 gsl_rstat_min(const gsl_rstat_workspace *w)
 {
@@ -0,0 +1,511 @@
+/* rstat/tdigest.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_sort.h>
+#include <gsl/gsl_rstat.h>
+
+#include "fileio.h"
+
+/*
+ * Merging t-digest of
+ *
+ * [1] T. Dunning and O. Ertl, "Computing extremely accurate quantiles
+ *     using t-digests", arXiv:1902.04023, 2019
+ *
+ * The data are summarized by a sorted list of centroids, each with a
+ * mean and a weight.  New points are appended to a buffer after the
+ * centroids; when the buffer is full the centroids and buffer are
+ * sorted together and adjacent entries merged from left to right as
+ * long as each centroid spans at most one unit of the scale function
+ *
+ *   k(q) = delta / (2 pi) asin(2q - 1)
+ *
+ * where q is the fraction of the data to the left.  The scale function
+ * is steep near q = 0 and q = 1, so centroids in the tails are small
+ * and extreme quantiles are estimated with small relative error.  There
+ * are at most delta + 1 centroids after each merge.
+ *
+ * The centroids and the buffer share the arrays mean[] and weight[]:
+ * entries 0..ncentroids-1 are the sorted centroids, and the next nbuf
+ * entries the unmerged points.
+ */
+
+static int tdigest_add(const double x, const double weight,
+                       gsl_rstat_tdigest_workspace *w);
+static void tdigest_compress(gsl_rstat_tdigest_workspace *w);
+
+gsl_rstat_tdigest_workspace *
+gsl_rstat_tdigest_alloc(const double delta)
+{
+  gsl_rstat_tdigest_workspace *w;
+
+  if (!(delta >= 10.0) || !gsl_finite(delta))
+    {
+      GSL_ERROR_NULL ("delta must be at least 10", GSL_EINVAL);
+    }
+
+  w = calloc(1, sizeof(gsl_rstat_tdigest_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->delta = delta;
+
+  /* room for the centroids and a buffer of 5 delta points */
+  w->size = (size_t) ceil(delta) + 2 + 5 * (size_t) ceil(delta);
+
+  w->mean = malloc(w->size * sizeof(double));
+  if (w->mean == 0)
+    {
+      gsl_rstat_tdigest_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for centroids", GSL_ENOMEM);
+    }
+
+  w->weight = malloc(w->size * sizeof(double));
+  if (w->weight == 0)
+    {
+      gsl_rstat_tdigest_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for centroids", GSL_ENOMEM);
+    }
+
+  gsl_rstat_tdigest_reset(w);
+
+  return w;
+} /* gsl_rstat_tdigest_alloc() */
+
+void
+gsl_rstat_tdigest_free(gsl_rstat_tdigest_workspace *w)
+{
+  RETURN_IF_NULL (w);
+
+  free(w->mean);
+  free(w->weight);
+  free(w);
+} /* gsl_rstat_tdigest_free() */
+
+int
+gsl_rstat_tdigest_reset(gsl_rstat_tdigest_workspace *w)
+{
+  w->ncentroids = 0;
+  w->nbuf = 0;
+  w->n = 0;
+  w->min = 0.0;
+  w->max = 0.0;
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_tdigest_reset() */
+
+size_t
+gsl_rstat_tdigest_n(const gsl_rstat_tdigest_workspace *w)
+{
+  return w->n;
+} /* gsl_rstat_tdigest_n() */
+
+int
+gsl_rstat_tdigest_add(const double x, gsl_rstat_tdigest_workspace *w)
+{
+  if (isnan(x))
+    {
+      GSL_ERROR ("invalid input argument x", GSL_EINVAL);
+    }
+
+  if (w->n == 0)
+    {
+      w->min = x;
+      w->max = x;
+    }
+  else
+    {
+      if (x < w->min)
+        w->min = x;
+      if (x > w->max)
+        w->max = x;
+    }
+
+  ++(w->n);
+
+  return tdigest_add(x, 1.0, w);
+} /* gsl_rstat_tdigest_add() */
+
+int
+gsl_rstat_tdigest_add_array(const double x[], const size_t stride,
+                            const size_t n, gsl_rstat_tdigest_workspace *w)
+{
+  size_t i = 0;
+
+  while (i < n)
+    {
+      double *mean = w->mean;
+      double *weight = w->weight;
+      const size_t start = w->ncentroids + w->nbuf;
+      const size_t m = GSL_MIN(w->size - start, n - i);
+      double min = w->min, max = w->max;
+      size_t j;
+
+      if (w->n == 0)
+        {
+          min = x[i * stride];
+          max = min;
+        }
+
+      for (j = 0; j < m; ++j)
+        {
+          const double xj = x[(i + j) * stride];
+
+          if (isnan(xj))
+            {
+              /* keep the points before the NaN */
+              w->nbuf += j;
+              w->n += j;
+              w->min = min;
+              w->max = max;
+              GSL_ERROR ("invalid input argument x", GSL_EINVAL);
+            }
+
+          if (xj < min)
+            min = xj;
+          if (xj > max)
+            max = xj;
+
+          mean[start + j] = xj;
+          weight[start + j] = 1.0;
+        }
+
+      w->nbuf += m;
+      w->n += m;
+      w->min = min;
+      w->max = max;
+      i += m;
+
+      if (w->ncentroids + w->nbuf == w->size)
+        tdigest_compress(w);
+    }
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_tdigest_add_array() */
+
+int
+gsl_rstat_tdigest_merge(gsl_rstat_tdigest_workspace *dest,
+                        const gsl_rstat_tdigest_workspace *src)
+{
+  const size_t m = src->ncentroids + src->nbuf;
+  size_t i;
+
+  if (src->n == 0)
+    return GSL_SUCCESS;
+
+  if (dest->n == 0)
+    {
+      dest->min = src->min;
+      dest->max = src->max;
+    }
+  else
+    {
+      if (src->min < dest->min)
+        dest->min = src->min;
+      if (src->max > dest->max)
+        dest->max = src->max;
+    }
+
+  /* the centroids of src are added as weighted points */
+  for (i = 0; i < m; ++i)
+    tdigest_add(src->mean[i], src->weight[i], dest);
+
+  dest->n += src->n;
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_tdigest_merge() */
+
+/* estimate of the p-quantile; a centroid of weight w_i stands for the
+   data of ranks C_{i-1} .. C_{i-1} + w_i - 1, where C_{i-1} is the
+   total weight to its left, and its mean is placed at the centre of
+   these ranks */
+double
+gsl_rstat_tdigest_quantile(const double p, gsl_rstat_tdigest_workspace *w)
+{
+  const double *mean, *weight;
+  double t, cum, r0, x0;
+  size_t i, nc;
+
+  if (w->n == 0)
+    return GSL_NAN;
+
+  if (p <= 0.0)
+    return w->min;
+
+  if (p >= 1.0)
+    return w->max;
+
+  if (w->nbuf > 0)
+    tdigest_compress(w);
+
+  mean = w->mean;
+  weight = w->weight;
+  nc = w->ncentroids;
+  t = p * (w->n - 1.0);
+
+  /* interpolate between the minimum, at rank 0, the centroids and the
+     maximum, at rank n - 1 */
+  r0 = 0.0;
+  x0 = w->min;
+  cum = 0.0;
+
+  for (i = 0; i < nc; ++i)
+    {
+      const double r = cum + 0.5 * (weight[i] - 1.0);
+
+      if (t <= r)
+        {
+          if (r <= r0)
+            return mean[i];
+
+          return x0 + (mean[i] - x0) * (t - r0) / (r - r0);
+        }
+
+      r0 = r;
+      x0 = mean[i];
+      cum += weight[i];
+    }
+
+  {
+    const double rn = w->n - 1.0;
+
+    if (rn <= r0)
+      return x0;
+
+    return x0 + (w->max - x0) * (t - r0) / (rn - r0);
+  }
+} /* gsl_rstat_tdigest_quantile() */
+
+/* estimate of the fraction of the data <= x, interpolating the rank
+   linearly between the centroids */
+double
+gsl_rstat_tdigest_cdf(const double x, gsl_rstat_tdigest_workspace *w)
+{
+  const double *mean, *weight;
+  double cum, r0, x0;
+  size_t i, nc;
+
+  if (w->n == 0)
+    return GSL_NAN;
+
+  if (x < w->min)
+    return 0.0;
+
+  if (x >= w->max)
+    return 1.0;
+
+  if (w->nbuf > 0)
+    tdigest_compress(w);
+
+  mean = w->mean;
+  weight = w->weight;
+  nc = w->ncentroids;
+
+  r0 = 0.0;
+  x0 = w->min;
+  cum = 0.0;
+
+  for (i = 0; i < nc; ++i)
+    {
+      const double r = cum + 0.5 * (weight[i] - 1.0);
+
+      if (x < mean[i])
+        {
+          double rank = r0;
+
+          if (mean[i] > x0)
+            rank += (r - r0) * (x - x0) / (mean[i] - x0);
+
+          return (rank + 1.0) / w->n;
+        }
+
+      r0 = r;
+      x0 = mean[i];
+      cum += weight[i];
+    }
+
+  {
+    const double rn = w->n - 1.0;
+    double rank = r0;
+
+    if (w->max > x0)
+      rank += (rn - r0) * (x - x0) / (w->max - x0);
+
+    return (rank + 1.0) / w->n;
+  }
+} /* gsl_rstat_tdigest_cdf() */
+
+int
+gsl_rstat_tdigest_fwrite(FILE *stream, const gsl_rstat_tdigest_workspace *w)
+{
+  const size_t m = w->ncentroids + w->nbuf;
+  int status;
+
+  status = rstat_fwrite(stream, &(w->delta), sizeof(double), 1);
+  if (!status)
+    status = rstat_fwrite(stream, &(w->n), sizeof(size_t), 1);
+  if (!status)
+    status = rstat_fwrite(stream, &(w->min), sizeof(double), 1);
+  if (!status)
+    status = rstat_fwrite(stream, &(w->max), sizeof(double), 1);
+  if (!status)
+    status = rstat_fwrite(stream, &(w->ncentroids), sizeof(size_t), 1);
+  if (!status)
+    status = rstat_fwrite(stream, &(w->nbuf), sizeof(size_t), 1);
+  if (!status)
+    status = rstat_fwrite(stream, w->mean, sizeof(double), m);
+  if (!status)
+    status = rstat_fwrite(stream, w->weight, sizeof(double), m);
+
+  return status;
+} /* gsl_rstat_tdigest_fwrite() */
+
+int
+gsl_rstat_tdigest_fread(FILE *stream, gsl_rstat_tdigest_workspace *w)
+{
+  double delta;
+  size_t nc = 0, nbuf = 0;
+  int status;
+
+  status = rstat_fread(stream, &delta, sizeof(double), 1);
+  if (status)
+    return status;
+
+  if (delta != w->delta)
+    {
+      GSL_ERROR ("digest in file has a different delta", GSL_EBADLEN);
+    }
+
+  status = rstat_fread(stream, &(w->n), sizeof(size_t), 1);
+  if (!status)
+    status = rstat_fread(stream, &(w->min), sizeof(double), 1);
+  if (!status)
+    status = rstat_fread(stream, &(w->max), sizeof(double), 1);
+  if (!status)
+    status = rstat_fread(stream, &nc, sizeof(size_t), 1);
+  if (!status)
+    status = rstat_fread(stream, &nbuf, sizeof(size_t), 1);
+
+  if (!status && nc + nbuf > w->size)
+    {
+      gsl_rstat_tdigest_reset(w);
+      GSL_ERROR ("invalid number of centroids in file", GSL_EFAILED);
+    }
+
+  if (!status)
+    status = rstat_fread(stream, w->mean, sizeof(double), nc + nbuf);
+  if (!status)
+    status = rstat_fread(stream, w->weight, sizeof(double), nc + nbuf);
+
+  if (status)
+    {
+      gsl_rstat_tdigest_reset(w);
+      return status;
+    }
+
+  w->ncentroids = nc;
+  w->nbuf = nbuf;
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_tdigest_fread() */
+
+/* add a point of the given weight to the buffer; n, min and max are
+   updated by the caller */
+static int
+tdigest_add(const double x, const double weight,
+            gsl_rstat_tdigest_workspace *w)
+{
+  const size_t j = w->ncentroids + w->nbuf;
+
+  w->mean[j] = x;
+  w->weight[j] = weight;
+  ++(w->nbuf);
+
+  if (j + 1 == w->size)
+    tdigest_compress(w);
+
+  return GSL_SUCCESS;
+}
+
+/* largest q with k(q) <= k(q0) + 1 */
+static double
+tdigest_qlimit(const double q0, const double delta)
+{
+  const double k = delta / (2.0 * M_PI) * asin(2.0 * q0 - 1.0) + 1.0;
+
+  if (k >= 0.25 * delta)
+    return 1.0;
+
+  return 0.5 * (1.0 + sin(2.0 * M_PI * k / delta));
+}
+
+/* sort the centroids and buffer together and merge neighbours */
+static void
+tdigest_compress(gsl_rstat_tdigest_workspace *w)
+{
+  double *mean = w->mean;
+  double *weight = w->weight;
+  const size_t m = w->ncentroids + w->nbuf;
+  double total = 0.0, sofar, qlimit;
+  size_t i, c;
+
+  if (m == 0)
+    return;
+
+  gsl_sort2(mean, 1, weight, 1, m);
+
+  for (i = 0; i < m; ++i)
+    total += weight[i];
+
+  /* centroid c is built up in place, since c <= i */
+  c = 0;
+  sofar = 0.0;
+  qlimit = tdigest_qlimit(0.0, w->delta);
+
+  for (i = 1; i < m; ++i)
+    {
+      const double wc = weight[c] + weight[i];
+
+      if ((sofar + wc) / total <= qlimit)
+        {
+          /* merge into the current centroid */
+          mean[c] += (mean[i] - mean[c]) * weight[i] / wc;
+          weight[c] = wc;
+        }
+      else
+        {
+          sofar += weight[c];
+          qlimit = tdigest_qlimit(sofar / total, w->delta);
+          ++c;
+          mean[c] = mean[i];
+          weight[c] = weight[i];
+        }
+    }
+
+  w->ncentroids = c + 1;
+  w->nbuf = 0;
+}
@@ -115,6 +115,245 @@ test_quantile(const double p, const double data[], const size_t n,
   gsl_rstat_quantile_free(w);
 }
 
+void
+test_merge(const size_t n, const double data[], const double tol)
+{
+  gsl_rstat_workspace *w = gsl_rstat_alloc();
+  gsl_rstat_workspace *w1 = gsl_rstat_alloc();
+  gsl_rstat_workspace *w2 = gsl_rstat_alloc();
+  gsl_rstat_workspace *w3 = gsl_rstat_alloc();
+  const size_t n1 = n / 3;
+  const size_t n2 = n / 2;
+  size_t i;
+
+  /* the whole dataset one point at a time */
+  for (i = 0; i < n; ++i)
+    gsl_rstat_add(data[i], w);
+
+  /* three unequal parts, the first two added as arrays */
+  gsl_rstat_add_array(data, 1, n1, w1);
+  gsl_rstat_add_array(data + n1, 1, n2 - n1, w2);
+
+  for (i = n2; i < n; ++i)
+    gsl_rstat_add(data[i], w3);
+
+  gsl_rstat_merge(w1, w2);
+  gsl_rstat_merge(w1, w3);
+
+  gsl_test_int(gsl_rstat_n(w1), n, "merge n n=%zu", n);
+  gsl_test_rel(gsl_rstat_min(w1), gsl_rstat_min(w), tol, "merge min n=%zu", n);
+  gsl_test_rel(gsl_rstat_max(w1), gsl_rstat_max(w), tol, "merge max n=%zu", n);
+  gsl_test_rel(gsl_rstat_mean(w1), gsl_rstat_mean(w), tol, "merge mean n=%zu", n);
+  gsl_test_rel(gsl_rstat_variance(w1), gsl_rstat_variance(w), tol, "merge variance n=%zu", n);
+  gsl_test_rel(gsl_rstat_rms(w1), gsl_rstat_rms(w), tol, "merge rms n=%zu", n);
+  gsl_test_rel(gsl_rstat_skew(w1), gsl_rstat_skew(w), tol, "merge skew n=%zu", n);
+  gsl_test_rel(gsl_rstat_kurtosis(w1), gsl_rstat_kurtosis(w), tol, "merge kurtosis n=%zu", n);
+
+  /* the merged median is an approximation, like the P^2 estimate */
+  if (n >= 1000)
+    gsl_test_abs(gsl_rstat_median(w1), gsl_rstat_median(w), 1.0e-2, "merge median n=%zu", n);
+
+  /* merging into an empty workspace copies the source */
+  gsl_rstat_reset(w2);
+  gsl_rstat_merge(w2, w);
+  gsl_test_int(gsl_rstat_n(w2), n, "merge empty n n=%zu", n);
+  gsl_test_rel(gsl_rstat_mean(w2), gsl_rstat_mean(w), tol, "merge empty mean n=%zu", n);
+  gsl_test_rel(gsl_rstat_variance(w2), gsl_rstat_variance(w), tol, "merge empty variance n=%zu", n);
+
+  gsl_rstat_free(w);
+  gsl_rstat_free(w1);
+  gsl_rstat_free(w2);
+  gsl_rstat_free(w3);
+}
+
+/* check the KLL sketch of data against the exact quantiles; the rank of
+   each estimate must be within eps * n of the requested rank, and the
+   estimates are exact while no compaction has taken place */
+void
+test_kll(const size_t k, const size_t n, const double data[],
+         const size_t nparts, const double eps)
+{
+  gsl_rstat_kll_workspace *w = gsl_rstat_kll_alloc(k);
+  gsl_rstat_kll_workspace *v = gsl_rstat_kll_alloc(k);
+  double *sorted = malloc(n * sizeof(double));
+  size_t i, j;
+
+  memcpy(sorted, data, n * sizeof(double));
+  gsl_sort(sorted, 1, n);
+
+  /* build the sketch from nparts separate sketches, alternately adding
+     points one at a time and as arrays */
+  for (j = 0; j < nparts; ++j)
+    {
+      const size_t a = j * n / nparts, b = (j + 1) * n / nparts;
+
+      gsl_rstat_kll_reset(v);
+
+      if (j % 2 == 0)
+        {
+          for (i = a; i < b; ++i)
+            gsl_rstat_kll_add(data[i], v);
+        }
+      else
+        gsl_rstat_kll_add_array(data + a, 1, b - a, v);
+
+      gsl_rstat_kll_merge(w, v);
+    }
+
+  gsl_test_int(gsl_rstat_kll_n(w), n, "kll n k=%zu n=%zu", k, n);
+
+  for (j = 0; j <= 100; ++j)
+    {
+      const double p = j / 100.0;
+      const double q = gsl_rstat_kll_quantile(p, w);
+
+      if (eps == 0.0)
+        {
+          const double expected = gsl_stats_quantile_from_sorted_data(sorted, 1, n, p);
+          gsl_test_rel(q, expected, 1.0e-12, "kll quantile k=%zu n=%zu p=%g", k, n, p);
+        }
+      else
+        {
+          const double lo = p - eps, hi = p + eps;
+          const double qlo = sorted[lo <= 0.0 ? 0 : (size_t) (lo * (n - 1))];
+          const double qhi = sorted[hi >= 1.0 ? n - 1 : (size_t) ceil(hi * (n - 1))];
+
+          gsl_test(q < qlo || q > qhi,
+                   "kll quantile k=%zu n=%zu parts=%zu p=%g", k, n, nparts, p);
+        }
+    }
+
+  /* fraction of data <= x */
+  for (j = 0; j < 20; ++j)
+    {
+      const size_t idx = j * (n - 1) / 19;
+      const double c = gsl_rstat_kll_cdf(sorted[idx], w);
+      double expected;
+
+      /* count ties */
+      i = idx;
+      while (i + 1 < n && sorted[i + 1] == sorted[idx])
+        ++i;
+
+      expected = (i + 1.0) / n;
+
+      gsl_test_abs(c, expected, (eps == 0.0) ? 1.0e-12 : eps,
+                   "kll cdf k=%zu n=%zu x=%g", k, n, sorted[idx]);
+    }
+
+  /* a sketch read back from a file gives the same results */
+  {
+    FILE *f = fopen("test.dat", "wb");
+    int status = gsl_rstat_kll_fwrite(f, w);
+    fclose(f);
+
+    gsl_test_int(status, GSL_SUCCESS, "kll fwrite k=%zu n=%zu", k, n);
+
+    f = fopen("test.dat", "rb");
+    status = gsl_rstat_kll_fread(f, v);
+    fclose(f);
+
+    gsl_test_int(status, GSL_SUCCESS, "kll fread k=%zu n=%zu", k, n);
+    gsl_test_int(gsl_rstat_kll_n(v), n, "kll fread n k=%zu n=%zu", k, n);
+
+    for (j = 0; j <= 10; ++j)
+      {
+        const double p = j / 10.0;
+
+        gsl_test_rel(gsl_rstat_kll_quantile(p, v), gsl_rstat_kll_quantile(p, w),
+                     0.0, "kll fread quantile k=%zu n=%zu p=%g", k, n, p);
+      }
+  }
+
+  free(sorted);
+  gsl_rstat_kll_free(w);
+  gsl_rstat_kll_free(v);
+}
+
+/* check the t-digest of data against the exact quantiles; the rank of
+   each estimate must be within eps * n of the requested rank, and
+   within eps/10 * n, or 5, for the tails p <= 0.01 and p >= 0.99 */
+void
+test_tdigest(const double delta, const size_t n, const double data[],
+             const size_t nparts, const double eps)
+{
+  gsl_rstat_tdigest_workspace *w = gsl_rstat_tdigest_alloc(delta);
+  gsl_rstat_tdigest_workspace *v = gsl_rstat_tdigest_alloc(delta);
+  double *sorted = malloc(n * sizeof(double));
+  size_t i, j;
+
+  memcpy(sorted, data, n * sizeof(double));
+  gsl_sort(sorted, 1, n);
+
+  for (j = 0; j < nparts; ++j)
+    {
+      const size_t a = j * n / nparts, b = (j + 1) * n / nparts;
+
+      gsl_rstat_tdigest_reset(v);
+
+      if (j % 2 == 0)
+        {
+          for (i = a; i < b; ++i)
+            gsl_rstat_tdigest_add(data[i], v);
+        }
+      else
+        gsl_rstat_tdigest_add_array(data + a, 1, b - a, v);
+
+      gsl_rstat_tdigest_merge(w, v);
+    }
+
+  gsl_test_int(gsl_rstat_tdigest_n(w), n, "tdigest n delta=%g n=%zu", delta, n);
+
+  for (j = 0; j <= 1000; ++j)
+    {
+      const double p = j / 1000.0;
+      const double q = gsl_rstat_tdigest_quantile(p, w);
+      const double e = (p <= 0.01 || p >= 0.99) ? GSL_MAX(0.1 * eps, 5.0 / n) : eps;
+      const double lo = p - e, hi = p + e;
+      const double qlo = sorted[lo <= 0.0 ? 0 : (size_t) (lo * (n - 1))];
+      const double qhi = sorted[hi >= 1.0 ? n - 1 : (size_t) ceil(hi * (n - 1))];
+
+      gsl_test(q < qlo || q > qhi,
+               "tdigest quantile delta=%g n=%zu parts=%zu p=%g", delta, n, nparts, p);
+    }
+
+  for (j = 0; j < 20; ++j)
+    {
+      const size_t idx = j * (n - 1) / 19;
+      const double c = gsl_rstat_tdigest_cdf(sorted[idx], w);
+
+      gsl_test_abs(c, (idx + 1.0) / n, eps,
+                   "tdigest cdf delta=%g n=%zu x=%g", delta, n, sorted[idx]);
+    }
+
+  {
+    FILE *f = fopen("test.dat", "wb");
+    int status = gsl_rstat_tdigest_fwrite(f, w);
+    fclose(f);
+
+    gsl_test_int(status, GSL_SUCCESS, "tdigest fwrite delta=%g n=%zu", delta, n);
+
+    f = fopen("test.dat", "rb");
+    status = gsl_rstat_tdigest_fread(f, v);
+    fclose(f);
+
+    gsl_test_int(status, GSL_SUCCESS, "tdigest fread delta=%g n=%zu", delta, n);
+    gsl_test_int(gsl_rstat_tdigest_n(v), n, "tdigest fread n delta=%g n=%zu", delta, n);
+
+    for (j = 0; j <= 10; ++j)
+      {
+        const double p = j / 10.0;
+
+        gsl_test_rel(gsl_rstat_tdigest_quantile(p, v), gsl_rstat_tdigest_quantile(p, w),
+                     0.0, "tdigest fread quantile delta=%g n=%zu p=%g", delta, n, p);
+      }
+  }
+
+  free(sorted);
+  gsl_rstat_tdigest_free(w);
+  gsl_rstat_tdigest_free(v);
+}
+
 int
 main()
 {
@@ -144,6 +383,24 @@ main()
 
     test_basic(5, data2, tol1);
 
+    test_merge(4, data, tol1);
+    test_merge(20, data, tol1);
+    test_merge(1000, data, tol1);
+    test_merge(100000, data, tol1);
+
+    test_kll(200, 1, data, 1, 0.0);
+    test_kll(200, 150, data, 1, 0.0);
+    test_kll(200, 150, data, 3, 0.0);
+    test_kll(200, 100000, data, 1, 0.02);
+    test_kll(200, 100000, data, 7, 0.02);
+    test_kll(50, 1000000, data, 16, 0.05);
+
+    test_tdigest(100.0, 1, data, 1, 1.0e-12);
+    test_tdigest(100.0, 1000, data, 1, 0.01);
+    test_tdigest(100.0, 100000, data, 1, 0.01);
+    test_tdigest(100.0, 100000, data, 7, 0.01);
+    test_tdigest(500.0, 1000000, data, 16, 0.002);
+
     free(data);
   }
 
@@ -0,0 +1,150 @@
+/* sort/benchmark.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Compare the times taken by heapsort, introsort (gsl_sort) and radix
+   sort, and by the indirect sort, on arrays of doubles and ints with
+   various patterns.  The number of elements can be given on the
+   command line (default 10^7). */
+
+#include <config.h>
+#include <time.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <gsl/gsl_sort.h>
+
+static unsigned long int seed = 1;
+
+static double
+uniform (void)
+{
+  seed = (1103515245 * seed + 12345) & 0x7fffffffUL;
+  return seed / 2147483648.0;
+}
+
+static double
+seconds (clock_t start)
+{
+  return (clock () - start) / (double) CLOCKS_PER_SEC;
+}
+
+static void
+fill (double *x, const size_t n, const int pattern)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      switch (pattern)
+        {
+        case 0:
+          x[i] = uniform () - 0.5;
+          break;
+        case 1:
+          x[i] = (double) i;
+          break;
+        case 2:
+          x[i] = (double) (n - i);
+          break;
+        case 3:
+          x[i] = (double) (int) (16 * uniform ());
+          break;
+        }
+    }
+}
+
+static const char *pattern_name[4] =
+  { "random", "sorted", "reversed", "16 distinct" };
+
+int
+main (int argc, char *argv[])
+{
+  const size_t n = (argc > 1) ? (size_t) atof (argv[1]) : 10000000;
+  double *data = malloc (n * sizeof (double));
+  double *x = malloc (n * sizeof (double));
+  int *ix = malloc (n * sizeof (int));
+  size_t *p = malloc (n * sizeof (size_t));
+  clock_t start;
+  int pattern;
+  size_t i;
+
+  printf ("n = %lu, times in seconds\n", (unsigned long) n);
+  printf ("%-12s %-8s %10s %10s %10s %10s\n", "data", "type",
+          "heapsort", "gsl_sort", "radix", "index");
+
+  for (pattern = 0; pattern < 4; pattern++)
+    {
+      double t1, t2, t3, t4;
+
+      fill (data, n, pattern);
+
+      memcpy (x, data, n * sizeof (double));
+      start = clock ();
+      gsl_sort_heapsort (x, 1, n);
+      t1 = seconds (start);
+
+      memcpy (x, data, n * sizeof (double));
+      start = clock ();
+      gsl_sort (x, 1, n);
+      t2 = seconds (start);
+
+      memcpy (x, data, n * sizeof (double));
+      start = clock ();
+      gsl_sort_radix (x, 1, n);
+      t3 = seconds (start);
+
+      start = clock ();
+      gsl_sort_index (p, data, 1, n);
+      t4 = seconds (start);
+
+      printf ("%-12s %-8s %10.3f %10.3f %10.3f %10.3f\n",
+              pattern_name[pattern], "double", t1, t2, t3, t4);
+
+      for (i = 0; i < n; i++)
+        ix[i] = (int) (data[i] * (pattern == 0 ? 2e9 : 1.0));
+
+      start = clock ();
+      gsl_sort_int_heapsort (ix, 1, n);
+      t1 = seconds (start);
+
+      for (i = 0; i < n; i++)
+        ix[i] = (int) (data[i] * (pattern == 0 ? 2e9 : 1.0));
+
+      start = clock ();
+      gsl_sort_int (ix, 1, n);
+      t2 = seconds (start);
+
+      for (i = 0; i < n; i++)
+        ix[i] = (int) (data[i] * (pattern == 0 ? 2e9 : 1.0));
+
+      start = clock ();
+      gsl_sort_int_radix (ix, 1, n);
+      t3 = seconds (start);
+
+      printf ("%-12s %-8s %10.3f %10.3f %10.3f\n",
+              pattern_name[pattern], "int", t1, t2, t3);
+    }
+
+  free (data);
+  free (x);
+  free (ix);
+  free (p);
+
+  return 0;
+}
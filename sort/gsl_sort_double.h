@@ -38,6 +38,8 @@ __BEGIN_DECLS
 
 void gsl_sort (double * data, const size_t stride, const size_t n);
 void gsl_sort2 (double * data1, const size_t stride1, double * data2, const size_t stride2, const size_t n);
+void gsl_sort_heapsort (double * data, const size_t stride, const size_t n);
+void gsl_sort_radix (double * data, const size_t stride, const size_t n);
 void gsl_sort_index (size_t * p, const double * data, const size_t stride, const size_t n);
 
 int gsl_sort_smallest (double * dest, const size_t k, const double * src, const size_t stride, const size_t n);
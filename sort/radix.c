@@ -0,0 +1,146 @@
+/* sort/radix.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Least significant digit radix sort, one byte per pass.  It needs a
+   buffer of n elements (2n if the stride is not 1) but takes O(n)
+   time per byte of the type, so it is faster than a comparison sort
+   for large arrays.  Passes in which all the data have the same digit
+   are skipped.  If the buffer cannot be allocated, or there is no
+   unsigned integer type of the same size for the keys, the data are
+   sorted with gsl_sort instead.  There is no version for long double,
+   whose layout is not portable. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <gsl/gsl_sort.h>
+
+/* unsigned types for the keys of double and float */
+#ifdef HAVE_STDINT_H
+#include <stdint.h>
+#define RADIX_UTYPE_64 uint64_t
+#define RADIX_UTYPE_32 uint32_t
+#else
+#define RADIX_UTYPE_64 unsigned long int
+#define RADIX_UTYPE_32 unsigned int
+#endif
+
+/* below this size the comparison sort is faster */
+#define RADIX_MIN 256
+
+#define BASE_DOUBLE
+#define RADIX_UTYPE RADIX_UTYPE_64
+#define RADIX_SIGNED 0
+#include "templates_on.h"
+#include "radix_source.c"
+#include "templates_off.h"
+#undef  RADIX_SIGNED
+#undef  RADIX_UTYPE
+#undef  BASE_DOUBLE
+
+#define BASE_FLOAT
+#define RADIX_UTYPE RADIX_UTYPE_32
+#define RADIX_SIGNED 0
+#include "templates_on.h"
+#include "radix_source.c"
+#include "templates_off.h"
+#undef  RADIX_SIGNED
+#undef  RADIX_UTYPE
+#undef  BASE_FLOAT
+
+#define BASE_ULONG
+#define RADIX_UTYPE unsigned long int
+#define RADIX_SIGNED 0
+#include "templates_on.h"
+#include "radix_source.c"
+#include "templates_off.h"
+#undef  RADIX_SIGNED
+#undef  RADIX_UTYPE
+#undef  BASE_ULONG
+
+#define BASE_LONG
+#define RADIX_UTYPE unsigned long int
+#define RADIX_SIGNED 1
+#include "templates_on.h"
+#include "radix_source.c"
+#include "templates_off.h"
+#undef  RADIX_SIGNED
+#undef  RADIX_UTYPE
+#undef  BASE_LONG
+
+#define BASE_UINT
+#define RADIX_UTYPE unsigned int
+#define RADIX_SIGNED 0
+#include "templates_on.h"
+#include "radix_source.c"
+#include "templates_off.h"
+#undef  RADIX_SIGNED
+#undef  RADIX_UTYPE
+#undef  BASE_UINT
+
+#define BASE_INT
+#define RADIX_UTYPE unsigned int
+#define RADIX_SIGNED 1
+#include "templates_on.h"
+#include "radix_source.c"
+#include "templates_off.h"
+#undef  RADIX_SIGNED
+#undef  RADIX_UTYPE
+#undef  BASE_INT
+
+#define BASE_USHORT
+#define RADIX_UTYPE unsigned short int
+#define RADIX_SIGNED 0
+#include "templates_on.h"
+#include "radix_source.c"
+#include "templates_off.h"
+#undef  RADIX_SIGNED
+#undef  RADIX_UTYPE
+#undef  BASE_USHORT
+
+#define BASE_SHORT
+#define RADIX_UTYPE unsigned short int
+#define RADIX_SIGNED 1
+#include "templates_on.h"
+#include "radix_source.c"
+#include "templates_off.h"
+#undef  RADIX_SIGNED
+#undef  RADIX_UTYPE
+#undef  BASE_SHORT
+
+#define BASE_UCHAR
+#define RADIX_UTYPE unsigned char
+#define RADIX_SIGNED 0
+#include "templates_on.h"
+#include "radix_source.c"
+#include "templates_off.h"
+#undef  RADIX_SIGNED
+#undef  RADIX_UTYPE
+#undef  BASE_UCHAR
+
+#define BASE_CHAR
+#define RADIX_UTYPE unsigned char
+#define RADIX_SIGNED (CHAR_MIN < 0)
+#include "templates_on.h"
+#include "radix_source.c"
+#include "templates_off.h"
+#undef  RADIX_SIGNED
+#undef  RADIX_UTYPE
+#undef  BASE_CHAR
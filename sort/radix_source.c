@@ -0,0 +1,143 @@
+/* sort/radix_source.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* RADIX_UTYPE is an unsigned type with the same size as BASE, used to
+   form the sort key, and RADIX_SIGNED is 1 if BASE is a signed integer
+   type.  For signed integers the sign bit is flipped, and for floating
+   point numbers the sign bit is flipped for positive values and all
+   bits for negative ones, so that the keys compare as unsigned
+   integers in the same order as the values. */
+
+static inline RADIX_UTYPE
+FUNCTION (radix, key) (const BASE x)
+{
+#if defined(BASE_DOUBLE) || defined(BASE_FLOAT) || RADIX_SIGNED
+  const RADIX_UTYPE top = (RADIX_UTYPE) 1 << (8 * sizeof (RADIX_UTYPE) - 1);
+#endif
+
+#if defined(BASE_DOUBLE) || defined(BASE_FLOAT)
+  RADIX_UTYPE k;
+
+  memcpy (&k, &x, sizeof (BASE));
+
+  return (k & top) ? (RADIX_UTYPE) ~k : (RADIX_UTYPE) (k | top);
+#elif RADIX_SIGNED
+  return (RADIX_UTYPE) ((RADIX_UTYPE) x ^ top);
+#else
+  return (RADIX_UTYPE) x;
+#endif
+}
+
+void
+FUNCTION (gsl_sort, radix) (BASE * data, const size_t stride, const size_t n)
+{
+  const size_t nbytes = sizeof (BASE);
+  size_t count[sizeof (BASE)][256];
+  BASE *buf, *src, *dst;
+  size_t i, b;
+
+  if (n < RADIX_MIN || sizeof (RADIX_UTYPE) != sizeof (BASE))
+    {
+      TYPE (gsl_sort) (data, stride, n);
+      return;
+    }
+
+  buf = (BASE *) malloc ((stride == 1 ? n : 2 * n) * sizeof (BASE));
+
+  if (buf == 0)
+    {
+      TYPE (gsl_sort) (data, stride, n);
+      return;
+    }
+
+  /* src holds the data contiguously */
+
+  if (stride == 1)
+    {
+      src = data;
+      dst = buf;
+    }
+  else
+    {
+      src = buf;
+      dst = buf + n;
+
+      for (i = 0; i < n; i++)
+        src[i] = data[i * stride];
+    }
+
+  /* histograms of all the digits in one pass */
+
+  memset (count, 0, sizeof (count));
+
+  for (i = 0; i < n; i++)
+    {
+      RADIX_UTYPE k = FUNCTION (radix, key) (src[i]);
+
+      for (b = 0; b < nbytes; b++)
+        {
+          count[b][k & 0xff]++;
+          k >>= 8;
+        }
+    }
+
+  for (b = 0; b < nbytes; b++)
+    {
+      size_t *c = count[b];
+      const unsigned int shift = 8 * b;
+      size_t d, sum = 0;
+
+      /* skip digits which are the same for all the data */
+
+      if (c[FUNCTION (radix, key) (src[0]) >> shift & 0xff] == n)
+        continue;
+
+      for (d = 0; d < 256; d++)
+        {
+          size_t t = c[d];
+          c[d] = sum;
+          sum += t;
+        }
+
+      for (i = 0; i < n; i++)
+        {
+          const BASE x = src[i];
+          dst[c[FUNCTION (radix, key) (x) >> shift & 0xff]++] = x;
+        }
+
+      {
+        BASE *tmp = src;
+        src = dst;
+        dst = tmp;
+      }
+    }
+
+  if (stride == 1)
+    {
+      if (src != data)
+        memcpy (data, src, n * sizeof (BASE));
+    }
+  else
+    {
+      for (i = 0; i < n; i++)
+        data[i * stride] = src[i];
+    }
+
+  free (buf);
+}
@@ -2,6 +2,8 @@
  * Implement Heap sort -- direct and indirect sorting
  * Based on descriptions in Sedgewick "Algorithms in C"
  *
+ * Introsort added by the GSL Team, 2026
+ *
  * Copyright (C) 1999  Thomas Walter
  *
  * 18 February 2000: Modified for GSL by Brian Gough
@@ -77,8 +79,8 @@ FUNCTION (my, downheap2) (BASE * data1, const size_t stride1, BASE * data2, cons
   data2[k * stride2] = v2;
 }
 
-void
-TYPE (gsl_sort) (BASE * data, const size_t stride, const size_t n)
+static void
+FUNCTION (my, heapsort) (BASE * data, const size_t stride, const size_t n)
 {
   size_t N;
   size_t k;
@@ -116,14 +118,8 @@ TYPE (gsl_sort) (BASE * data, const size_t stride, const size_t n)
     }
 }
 
-void
-TYPE (gsl_sort_vector) (TYPE (gsl_vector) * v)
-{
-  TYPE (gsl_sort) (v->data, v->stride, v->size) ;
-}
-
-void
-TYPE (gsl_sort2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2, const size_t n)
+static void
+FUNCTION (my, heapsort2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2, const size_t n)
 {
   size_t N;
   size_t k;
@@ -167,6 +163,311 @@ TYPE (gsl_sort2) (BASE * data1, const size_t stride1, BASE * data2, const size_t
     }
 }
 
+/* Introsort (Musser, Software Pract Exper 27, 983--993 (1997)):
+   quicksort with a median-of-3 or ninther pivot and Hoare partitioning,
+   which splits runs of equal elements evenly, and insertion sort for
+   short ranges.  If the recursion becomes deeper than 2 log2(n) the
+   range is finished with heapsort, so the worst case is O(n log n).
+   The scans are bounded, so NaNs cannot make them run off the ends of
+   the array, although their position in the output is unspecified. */
+
+#ifndef INTROSORT_THRESHOLD
+#define INTROSORT_THRESHOLD 16
+
+static size_t
+introsort_depth (size_t n)
+{
+  size_t d = 0;
+
+  while (n > 1)
+    {
+      n >>= 1;
+      d += 2;
+    }
+
+  return d;
+}
+#endif
+
+static void
+FUNCTION (my, insertion) (BASE * data, const size_t stride, const size_t n)
+{
+  size_t i;
+
+  for (i = 1; i < n; i++)
+    {
+      BASE v = data[i * stride];
+      size_t j = i;
+
+      while (j > 0 && v < data[(j - 1) * stride])
+        {
+          data[j * stride] = data[(j - 1) * stride];
+          j--;
+        }
+
+      data[j * stride] = v;
+    }
+}
+
+static inline void
+FUNCTION (my, swap) (BASE * data, const size_t stride, const size_t i, const size_t j)
+{
+  BASE tmp = data[i * stride];
+  data[i * stride] = data[j * stride];
+  data[j * stride] = tmp;
+}
+
+static inline void
+FUNCTION (my, sort3) (BASE * data, const size_t stride, const size_t a, const size_t b, const size_t c)
+{
+  if (data[b * stride] < data[a * stride])
+    FUNCTION (my, swap) (data, stride, a, b);
+
+  if (data[c * stride] < data[b * stride])
+    {
+      FUNCTION (my, swap) (data, stride, b, c);
+
+      if (data[b * stride] < data[a * stride])
+        FUNCTION (my, swap) (data, stride, a, b);
+    }
+}
+
+/* Partition data[0..n-1], n > INTROSORT_THRESHOLD, returning j < n - 1
+   such that data[0..j] <= data[j+1..n-1] */
+
+static size_t
+FUNCTION (my, partition) (BASE * data, const size_t stride, const size_t n)
+{
+  const size_t m = n / 2, r = n - 1;
+  size_t i = 0, j = r;
+  BASE p;
+
+  FUNCTION (my, sort3) (data, stride, 0, m, r);
+
+  if (n > 128)
+    {
+      /* ninther: median of the medians of three samples */
+      FUNCTION (my, sort3) (data, stride, 1, m - 1, r - 1);
+      FUNCTION (my, sort3) (data, stride, 2, m + 1, r - 2);
+      FUNCTION (my, sort3) (data, stride, m - 1, m, m + 1);
+    }
+
+  p = data[m * stride];
+
+  for (;;)
+    {
+      while (i < r && data[i * stride] < p)
+        i++;
+
+      while (j > 0 && p < data[j * stride])
+        j--;
+
+      if (i >= j)
+        break;
+
+      FUNCTION (my, swap) (data, stride, i, j);
+      i++;
+      j--;
+    }
+
+  /* only possible with NaNs */
+  if (j >= r)
+    j = r - 1;
+
+  return j;
+}
+
+static void
+FUNCTION (my, introsort) (BASE * data, const size_t stride, size_t n, size_t depth)
+{
+  while (n > INTROSORT_THRESHOLD)
+    {
+      size_t j;
+
+      if (depth == 0)
+        {
+          FUNCTION (my, heapsort) (data, stride, n);
+          return;
+        }
+
+      depth--;
+
+      j = FUNCTION (my, partition) (data, stride, n);
+
+      /* recurse into the smaller part and loop on the larger one, so
+         the stack depth is O(log n) */
+
+      if (j + 1 < n - j - 1)
+        {
+          FUNCTION (my, introsort) (data, stride, j + 1, depth);
+          data += (j + 1) * stride;
+          n -= j + 1;
+        }
+      else
+        {
+          FUNCTION (my, introsort) (data + (j + 1) * stride, stride, n - j - 1, depth);
+          n = j + 1;
+        }
+    }
+
+  FUNCTION (my, insertion) (data, stride, n);
+}
+
+static void
+FUNCTION (my, insertion2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2, const size_t n)
+{
+  size_t i;
+
+  for (i = 1; i < n; i++)
+    {
+      BASE v1 = data1[i * stride1];
+      BASE v2 = data2[i * stride2];
+      size_t j = i;
+
+      while (j > 0 && v1 < data1[(j - 1) * stride1])
+        {
+          data1[j * stride1] = data1[(j - 1) * stride1];
+          data2[j * stride2] = data2[(j - 1) * stride2];
+          j--;
+        }
+
+      data1[j * stride1] = v1;
+      data2[j * stride2] = v2;
+    }
+}
+
+static inline void
+FUNCTION (my, swap2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2, const size_t i, const size_t j)
+{
+  FUNCTION (my, swap) (data1, stride1, i, j);
+  FUNCTION (my, swap) (data2, stride2, i, j);
+}
+
+static inline void
+FUNCTION (my, sort3_2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2, const size_t a, const size_t b, const size_t c)
+{
+  if (data1[b * stride1] < data1[a * stride1])
+    FUNCTION (my, swap2) (data1, stride1, data2, stride2, a, b);
+
+  if (data1[c * stride1] < data1[b * stride1])
+    {
+      FUNCTION (my, swap2) (data1, stride1, data2, stride2, b, c);
+
+      if (data1[b * stride1] < data1[a * stride1])
+        FUNCTION (my, swap2) (data1, stride1, data2, stride2, a, b);
+    }
+}
+
+static size_t
+FUNCTION (my, partition2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2, const size_t n)
+{
+  const size_t m = n / 2, r = n - 1;
+  size_t i = 0, j = r;
+  BASE p;
+
+  FUNCTION (my, sort3_2) (data1, stride1, data2, stride2, 0, m, r);
+
+  if (n > 128)
+    {
+      FUNCTION (my, sort3_2) (data1, stride1, data2, stride2, 1, m - 1, r - 1);
+      FUNCTION (my, sort3_2) (data1, stride1, data2, stride2, 2, m + 1, r - 2);
+      FUNCTION (my, sort3_2) (data1, stride1, data2, stride2, m - 1, m, m + 1);
+    }
+
+  p = data1[m * stride1];
+
+  for (;;)
+    {
+      while (i < r && data1[i * stride1] < p)
+        i++;
+
+      while (j > 0 && p < data1[j * stride1])
+        j--;
+
+      if (i >= j)
+        break;
+
+      FUNCTION (my, swap2) (data1, stride1, data2, stride2, i, j);
+      i++;
+      j--;
+    }
+
+  if (j >= r)
+    j = r - 1;
+
+  return j;
+}
+
+static void
+FUNCTION (my, introsort2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2, size_t n, size_t depth)
+{
+  while (n > INTROSORT_THRESHOLD)
+    {
+      size_t j;
+
+      if (depth == 0)
+        {
+          FUNCTION (my, heapsort2) (data1, stride1, data2, stride2, n);
+          return;
+        }
+
+      depth--;
+
+      j = FUNCTION (my, partition2) (data1, stride1, data2, stride2, n);
+
+      if (j + 1 < n - j - 1)
+        {
+          FUNCTION (my, introsort2) (data1, stride1, data2, stride2, j + 1, depth);
+          data1 += (j + 1) * stride1;
+          data2 += (j + 1) * stride2;
+          n -= j + 1;
+        }
+      else
+        {
+          FUNCTION (my, introsort2) (data1 + (j + 1) * stride1, stride1,
+                                     data2 + (j + 1) * stride2, stride2,
+                                     n - j - 1, depth);
+          n = j + 1;
+        }
+    }
+
+  FUNCTION (my, insertion2) (data1, stride1, data2, stride2, n);
+}
+
+void
+TYPE (gsl_sort) (BASE * data, const size_t stride, const size_t n)
+{
+  if (n < 2)
+    {
+      return;                   /* No data to sort */
+    }
+
+  FUNCTION (my, introsort) (data, stride, n, introsort_depth (n));
+}
+
+void
+FUNCTION (gsl_sort, heapsort) (BASE * data, const size_t stride, const size_t n)
+{
+  FUNCTION (my, heapsort) (data, stride, n);
+}
+
+void
+TYPE (gsl_sort_vector) (TYPE (gsl_vector) * v)
+{
+  TYPE (gsl_sort) (v->data, v->stride, v->size) ;
+}
+
+void
+TYPE (gsl_sort2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2, const size_t n)
+{
+  if (n < 2)
+    {
+      return;                   /* No data to sort */
+    }
+
+  FUNCTION (my, introsort2) (data1, stride1, data2, stride2, n, introsort_depth (n));
+}
+
 void
 TYPE (gsl_sort_vector2) (TYPE (gsl_vector) * v1, TYPE (gsl_vector) * v2)
 {
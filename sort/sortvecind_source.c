@@ -2,6 +2,8 @@
  * Implement Heap sort -- direct and indirect sorting
  * Based on descriptions in Sedgewick "Algorithms in C"
  *
+ * Introsort added by the GSL Team, 2026
+ *
  * Copyright (C) 1999  Thomas Walter
  *
  * 18 February 2000: Modified for GSL by Brian Gough
@@ -46,24 +48,17 @@ FUNCTION (index, downheap) (size_t * p, const BASE * data, const size_t stride,
   p[k] = pki;
 }
 
-void
-FUNCTION (gsl_sort, index) (size_t * p, const BASE * data, const size_t stride, const size_t n)
+static void
+FUNCTION (index, heapsort) (size_t * p, const BASE * data, const size_t stride, const size_t n)
 {
   size_t N;
-  size_t i, k;
+  size_t k;
 
   if (n == 0)
     {
       return;   /* No data to sort */
     }
 
-  /* set permutation to identity */
-
-  for (i = 0 ; i < n ; i++)
-    {
-      p[i] = i ;
-    }
-
   /* We have n_data elements, last element is at 'n_data-1', first at
      '0' Set N to the last element number. */
 
@@ -92,6 +87,163 @@ FUNCTION (gsl_sort, index) (size_t * p, const BASE * data, const size_t stride,
     }
 }
 
+/* Introsort on the permutation, as for gsl_sort in sortvec_source.c */
+
+#ifndef INTROSORT_THRESHOLD
+#define INTROSORT_THRESHOLD 16
+
+static size_t
+introsort_depth (size_t n)
+{
+  size_t d = 0;
+
+  while (n > 1)
+    {
+      n >>= 1;
+      d += 2;
+    }
+
+  return d;
+}
+
+static inline void
+index_swap (size_t * p, const size_t i, const size_t j)
+{
+  size_t tmp = p[i];
+  p[i] = p[j];
+  p[j] = tmp;
+}
+#endif
+
+static void
+FUNCTION (index, insertion) (size_t * p, const BASE * data, const size_t stride, const size_t n)
+{
+  size_t i;
+
+  for (i = 1; i < n; i++)
+    {
+      const size_t pi = p[i];
+      const BASE v = data[pi * stride];
+      size_t j = i;
+
+      while (j > 0 && v < data[p[j - 1] * stride])
+        {
+          p[j] = p[j - 1];
+          j--;
+        }
+
+      p[j] = pi;
+    }
+}
+
+static inline void
+FUNCTION (index, sort3) (size_t * p, const BASE * data, const size_t stride, const size_t a, const size_t b, const size_t c)
+{
+  if (data[p[b] * stride] < data[p[a] * stride])
+    index_swap (p, a, b);
+
+  if (data[p[c] * stride] < data[p[b] * stride])
+    {
+      index_swap (p, b, c);
+
+      if (data[p[b] * stride] < data[p[a] * stride])
+        index_swap (p, a, b);
+    }
+}
+
+static size_t
+FUNCTION (index, partition) (size_t * p, const BASE * data, const size_t stride, const size_t n)
+{
+  const size_t m = n / 2, r = n - 1;
+  size_t i = 0, j = r;
+  BASE v;
+
+  FUNCTION (index, sort3) (p, data, stride, 0, m, r);
+
+  if (n > 128)
+    {
+      FUNCTION (index, sort3) (p, data, stride, 1, m - 1, r - 1);
+      FUNCTION (index, sort3) (p, data, stride, 2, m + 1, r - 2);
+      FUNCTION (index, sort3) (p, data, stride, m - 1, m, m + 1);
+    }
+
+  v = data[p[m] * stride];
+
+  for (;;)
+    {
+      while (i < r && data[p[i] * stride] < v)
+        i++;
+
+      while (j > 0 && v < data[p[j] * stride])
+        j--;
+
+      if (i >= j)
+        break;
+
+      index_swap (p, i, j);
+      i++;
+      j--;
+    }
+
+  if (j >= r)
+    j = r - 1;
+
+  return j;
+}
+
+static void
+FUNCTION (index, introsort) (size_t * p, const BASE * data, const size_t stride, size_t n, size_t depth)
+{
+  while (n > INTROSORT_THRESHOLD)
+    {
+      size_t j;
+
+      if (depth == 0)
+        {
+          FUNCTION (index, heapsort) (p, data, stride, n);
+          return;
+        }
+
+      depth--;
+
+      j = FUNCTION (index, partition) (p, data, stride, n);
+
+      if (j + 1 < n - j - 1)
+        {
+          FUNCTION (index, introsort) (p, data, stride, j + 1, depth);
+          p += j + 1;
+          n -= j + 1;
+        }
+      else
+        {
+          FUNCTION (index, introsort) (p + j + 1, data, stride, n - j - 1, depth);
+          n = j + 1;
+        }
+    }
+
+  FUNCTION (index, insertion) (p, data, stride, n);
+}
+
+void
+FUNCTION (gsl_sort, index) (size_t * p, const BASE * data, const size_t stride, const size_t n)
+{
+  size_t i;
+
+  /* set permutation to identity */
+
+  for (i = 0 ; i < n ; i++)
+    {
+      p[i] = i ;
+    }
+
+  if (n < 2)
+    {
+      return;
+    }
+
+  FUNCTION (index, introsort) (p, data, stride, n, introsort_depth (n));
+}
+
 int
 FUNCTION (gsl_sort_vector, index) (gsl_permutation * permutation, const TYPE (gsl_vector) * v)
 {
@@ -13,6 +13,138 @@
  * for more details.
  */
 
+/* For k above SUBSET_HEAP_MIN the k best elements are kept in a binary
+   heap in dest, with the worst of them at the root.  Each remaining
+   element is compared with the root first, which rejects most elements
+   with a single comparison, and the heap is sorted at the end.  This
+   takes O(n log k) time instead of O(n k) for the insertion below. */
+
+#ifndef SUBSET_HEAP_MIN
+#define SUBSET_HEAP_MIN 32
+#endif
+
+static void
+FUNCTION (subset, downheap_max) (BASE * h, size_t i, const size_t k)
+{
+  const BASE v = h[i];
+
+  while (2 * i + 1 < k)
+    {
+      size_t c = 2 * i + 1;
+
+      if (c + 1 < k && h[c + 1] > h[c])
+        c++;
+
+      if (!(h[c] > v))
+        break;
+
+      h[i] = h[c];
+      i = c;
+    }
+
+  h[i] = v;
+}
+
+static void
+FUNCTION (subset, downheap_min) (BASE * h, size_t i, const size_t k)
+{
+  const BASE v = h[i];
+
+  while (2 * i + 1 < k)
+    {
+      size_t c = 2 * i + 1;
+
+      if (c + 1 < k && h[c + 1] < h[c])
+        c++;
+
+      if (!(h[c] < v))
+        break;
+
+      h[i] = h[c];
+      i = c;
+    }
+
+  h[i] = v;
+}
+
+static void
+FUNCTION (subset, heap_smallest) (BASE * dest, const size_t k,
+                                  const BASE * src, const size_t stride,
+                                  const size_t n)
+{
+  size_t i;
+  BASE xbound;
+
+  for (i = 0; i < k; i++)
+    dest[i] = src[i * stride];
+
+  for (i = k / 2; i > 0; i--)
+    FUNCTION (subset, downheap_max) (dest, i - 1, k);
+
+  xbound = dest[0];
+
+  for (i = k; i < n; i++)
+    {
+      const BASE xi = src[i * stride];
+
+      if (xi < xbound)
+        {
+          dest[0] = xi;
+          FUNCTION (subset, downheap_max) (dest, 0, k);
+          xbound = dest[0];
+        }
+    }
+
+  /* heapsort the max-heap into ascending order */
+
+  for (i = k - 1; i > 0; i--)
+    {
+      const BASE t = dest[0];
+      dest[0] = dest[i];
+      dest[i] = t;
+      FUNCTION (subset, downheap_max) (dest, 0, i);
+    }
+}
+
+static void
+FUNCTION (subset, heap_largest) (BASE * dest, const size_t k,
+                                 const BASE * src, const size_t stride,
+                                 const size_t n)
+{
+  size_t i;
+  BASE xbound;
+
+  for (i = 0; i < k; i++)
+    dest[i] = src[i * stride];
+
+  for (i = k / 2; i > 0; i--)
+    FUNCTION (subset, downheap_min) (dest, i - 1, k);
+
+  xbound = dest[0];
+
+  for (i = k; i < n; i++)
+    {
+      const BASE xi = src[i * stride];
+
+      if (xi > xbound)
+        {
+          dest[0] = xi;
+          FUNCTION (subset, downheap_min) (dest, 0, k);
+          xbound = dest[0];
+        }
+    }
+
+  /* heapsort the min-heap into descending order */
+
+  for (i = k - 1; i > 0; i--)
+    {
+      const BASE t = dest[0];
+      dest[0] = dest[i];
+      dest[i] = t;
+      FUNCTION (subset, downheap_min) (dest, 0, i);
+    }
+}
+
 /* find the k-th smallest elements of the vector data, in ascending order */
 
 int
@@ -33,6 +165,12 @@ FUNCTION (gsl_sort, smallest) (BASE * dest, const size_t k,
       return GSL_SUCCESS;
     }
 
+  if (k > SUBSET_HEAP_MIN)
+    {
+      FUNCTION (subset, heap_smallest) (dest, k, src, stride, n);
+      return GSL_SUCCESS;
+    }
+
   /* take the first element */
 
   j = 1;
@@ -98,6 +236,12 @@ FUNCTION (gsl_sort, largest) (BASE * dest, const size_t k,
       return GSL_SUCCESS;
     }
 
+  if (k > SUBSET_HEAP_MIN)
+    {
+      FUNCTION (subset, heap_largest) (dest, k, src, stride, n);
+      return GSL_SUCCESS;
+    }
+
   /* take the first element */
 
   j = 1;
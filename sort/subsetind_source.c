@@ -13,6 +13,154 @@
  * for more details.
  */
 
+/* For k above SUBSET_HEAP_MIN the indices of the k best elements are
+   kept in a binary heap in p, with the worst of them at the root.  Each
+   remaining element is compared with the root first, which rejects most
+   elements with a single comparison.  Equal elements are ordered by
+   index, so that the result is the same as for the insertion below. */
+
+#ifndef SUBSET_HEAP_MIN
+#define SUBSET_HEAP_MIN 32
+#endif
+
+/* element a is larger than element b, or equal with a larger index */
+static int
+FUNCTION (subsetind, after) (const BASE * src, const size_t stride,
+                             const size_t a, const size_t b)
+{
+  const BASE xa = src[a * stride], xb = src[b * stride];
+  return (xa > xb) || (xa == xb && a > b);
+}
+
+/* element a is smaller than element b, or equal with a larger index */
+static int
+FUNCTION (subsetind, before) (const BASE * src, const size_t stride,
+                              const size_t a, const size_t b)
+{
+  const BASE xa = src[a * stride], xb = src[b * stride];
+  return (xa < xb) || (xa == xb && a > b);
+}
+
+static void
+FUNCTION (subsetind, downheap_max) (size_t * h, size_t i, const size_t k,
+                                    const BASE * src, const size_t stride)
+{
+  const size_t v = h[i];
+
+  while (2 * i + 1 < k)
+    {
+      size_t c = 2 * i + 1;
+
+      if (c + 1 < k && FUNCTION (subsetind, after) (src, stride, h[c + 1], h[c]))
+        c++;
+
+      if (!FUNCTION (subsetind, after) (src, stride, h[c], v))
+        break;
+
+      h[i] = h[c];
+      i = c;
+    }
+
+  h[i] = v;
+}
+
+static void
+FUNCTION (subsetind, downheap_min) (size_t * h, size_t i, const size_t k,
+                                    const BASE * src, const size_t stride)
+{
+  const size_t v = h[i];
+
+  while (2 * i + 1 < k)
+    {
+      size_t c = 2 * i + 1;
+
+      if (c + 1 < k && FUNCTION (subsetind, before) (src, stride, h[c + 1], h[c]))
+        c++;
+
+      if (!FUNCTION (subsetind, before) (src, stride, h[c], v))
+        break;
+
+      h[i] = h[c];
+      i = c;
+    }
+
+  h[i] = v;
+}
+
+static void
+FUNCTION (subsetind, heap_smallest) (size_t * p, const size_t k,
+                                     const BASE * src, const size_t stride,
+                                     const size_t n)
+{
+  size_t i;
+  BASE xbound;
+
+  for (i = 0; i < k; i++)
+    p[i] = i;
+
+  for (i = k / 2; i > 0; i--)
+    FUNCTION (subsetind, downheap_max) (p, i - 1, k, src, stride);
+
+  xbound = src[p[0] * stride];
+
+  for (i = k; i < n; i++)
+    {
+      const BASE xi = src[i * stride];
+
+      if (xi < xbound)
+        {
+          p[0] = i;
+          FUNCTION (subsetind, downheap_max) (p, 0, k, src, stride);
+          xbound = src[p[0] * stride];
+        }
+    }
+
+  for (i = k - 1; i > 0; i--)
+    {
+      const size_t t = p[0];
+      p[0] = p[i];
+      p[i] = t;
+      FUNCTION (subsetind, downheap_max) (p, 0, i, src, stride);
+    }
+}
+
+static void
+FUNCTION (subsetind, heap_largest) (size_t * p, const size_t k,
+                                    const BASE * src, const size_t stride,
+                                    const size_t n)
+{
+  size_t i;
+  BASE xbound;
+
+  for (i = 0; i < k; i++)
+    p[i] = i;
+
+  for (i = k / 2; i > 0; i--)
+    FUNCTION (subsetind, downheap_min) (p, i - 1, k, src, stride);
+
+  xbound = src[p[0] * stride];
+
+  for (i = k; i < n; i++)
+    {
+      const BASE xi = src[i * stride];
+
+      if (xi > xbound)
+        {
+          p[0] = i;
+          FUNCTION (subsetind, downheap_min) (p, 0, k, src, stride);
+          xbound = src[p[0] * stride];
+        }
+    }
+
+  for (i = k - 1; i > 0; i--)
+    {
+      const size_t t = p[0];
+      p[0] = p[i];
+      p[i] = t;
+      FUNCTION (subsetind, downheap_min) (p, 0, i, src, stride);
+    }
+}
+
 /* find the k-th smallest elements of the vector data, in ascending order */
 
 int
@@ -33,6 +181,12 @@ FUNCTION (gsl_sort, smallest_index) (size_t * p, const size_t k,
       return GSL_SUCCESS;
     }
 
+  if (k > SUBSET_HEAP_MIN)
+    {
+      FUNCTION (subsetind, heap_smallest) (p, k, src, stride, n);
+      return GSL_SUCCESS;
+    }
+
   /* take the first element */
 
   j = 1;
@@ -58,7 +212,7 @@ FUNCTION (gsl_sort, smallest_index) (size_t * p, const size_t k,
 
       for (i1 = j - 1; i1 > 0 ; i1--)
         {
-          if (xi > src[p[i1 - 1] * stride])
+          if (xi >= src[p[i1 - 1] * stride])
             break;
 
           p[i1] = p[i1 - 1];
@@ -98,6 +252,12 @@ FUNCTION (gsl_sort, largest_index) (size_t * p, const size_t k,
       return GSL_SUCCESS;
     }
 
+  if (k > SUBSET_HEAP_MIN)
+    {
+      FUNCTION (subsetind, heap_largest) (p, k, src, stride, n);
+      return GSL_SUCCESS;
+    }
+
   /* take the first element */
 
   j = 1;
@@ -123,7 +283,7 @@ FUNCTION (gsl_sort, largest_index) (size_t * p, const size_t k,
 
       for (i1 = j - 1; i1 > 0 ; i1--)
         {
-          if (xi < src[stride * p[i1 - 1]])
+          if (xi <= src[stride * p[i1 - 1]])
             break;
 
           p[i1] = p[i1 - 1];
@@ -20,6 +20,7 @@
 #include <config.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_test.h>
@@ -98,6 +99,184 @@ size_t urand (size_t);
 #include "templates_off.h"
 #undef  BASE_CHAR
 
+/* compare gsl_sort, gsl_sort_radix and gsl_sort_index with heapsort on
+   data with negative values, signed zeros, infinities and many repeated
+   values, in patterns which are bad cases for simple quicksorts */
+void
+test_patterns (size_t n)
+{
+  double *x = malloc (n * sizeof (double));
+  double *y = malloc (n * sizeof (double));
+  double *z = malloc (n * sizeof (double));
+  int *ix = malloc (n * sizeof (int));
+  int *iy = malloc (n * sizeof (int));
+  size_t *p = malloc (n * sizeof (size_t));
+  int pattern;
+  size_t i;
+
+  for (pattern = 0; pattern < 6; pattern++)
+    {
+      int status = 0, istatus = 0, pstatus = 0, rstatus = 0;
+
+      for (i = 0; i < n; i++)
+        {
+          switch (pattern)
+            {
+            case 0:             /* random, of both signs */
+              x[i] = urand (2000001) - 1000000.5;
+              break;
+            case 1:             /* few distinct values */
+              x[i] = (double) urand (4) - 2.0;
+              break;
+            case 2:             /* organ pipe */
+              x[i] = (double) (i < n / 2 ? i : n - i);
+              break;
+            case 3:             /* sorted with a few elements swapped */
+              x[i] = (double) i;
+              break;
+            case 4:             /* reversed */
+              x[i] = (double) (n - i);
+              break;
+            case 5:             /* special values */
+              {
+                const double v[6] = { 0.0, -0.0, GSL_POSINF, GSL_NEGINF, 1e-310, -1e300 };
+                x[i] = v[urand (6)];
+              }
+              break;
+            }
+        }
+
+      if (pattern == 3)
+        {
+          for (i = 0; i < 10; i++)
+            {
+              size_t a = urand (n), b = urand (n);
+              double t = x[a];
+              x[a] = x[b];
+              x[b] = t;
+            }
+        }
+
+      for (i = 0; i < n; i++)
+        ix[i] = (int) (pattern == 5 ? urand (7) - 3 : x[i]);
+
+      memcpy (y, x, n * sizeof (double));
+      gsl_sort_heapsort (y, 1, n);
+
+      memcpy (z, x, n * sizeof (double));
+      gsl_sort (z, 1, n);
+      for (i = 0; i < n; i++)
+        status |= (z[i] != y[i]);
+
+      memcpy (z, x, n * sizeof (double));
+      gsl_sort_radix (z, 1, n);
+      for (i = 0; i < n; i++)
+        rstatus |= (z[i] != y[i]);
+
+      gsl_sort_index (p, x, 1, n);
+      for (i = 0; i < n; i++)
+        pstatus |= (x[p[i]] != y[i]);
+
+      memcpy (iy, ix, n * sizeof (int));
+      gsl_sort_int_heapsort (iy, 1, n);
+      gsl_sort_int_radix (ix, 1, n);
+      for (i = 0; i < n; i++)
+        istatus |= (ix[i] != iy[i]);
+
+      gsl_test (status, "gsl_sort, n = %u, pattern %d", n, pattern);
+      gsl_test (rstatus, "gsl_sort_radix, n = %u, pattern %d", n, pattern);
+      gsl_test (pstatus, "gsl_sort_index, n = %u, pattern %d", n, pattern);
+      gsl_test (istatus, "gsl_sort_int_radix, n = %u, pattern %d", n, pattern);
+    }
+
+  /* NaNs end up in unspecified places, but the other elements must
+     still be present and the sort must terminate */
+  {
+    int status = 0;
+    double sum = 0.0, sum2 = 0.0;
+
+    for (i = 0; i < n; i++)
+      {
+        x[i] = (urand (10) == 0) ? GSL_NAN : (double) urand (1000);
+        if (!gsl_isnan (x[i]))
+          sum += x[i];
+      }
+
+    gsl_sort (x, 1, n);
+    gsl_sort_index (p, x, 1, n);
+
+    for (i = 0; i < n; i++)
+      {
+        if (!gsl_isnan (x[i]))
+          sum2 += x[i];
+      }
+
+    status = (sum != sum2);
+    gsl_test (status, "gsl_sort with NaNs, n = %u", n);
+  }
+
+  free (x);
+  free (y);
+  free (z);
+  free (ix);
+  free (iy);
+  free (p);
+}
+
+/* compare gsl_sort_smallest, gsl_sort_largest and their index versions
+   with a full sort, on data with many repeated values; equal elements
+   must be returned in order of increasing index */
+void
+test_subset (size_t n, size_t k)
+{
+  double *x = malloc (n * sizeof (double));
+  double *y = malloc (n * sizeof (double));
+  double *z = malloc (k * sizeof (double));
+  size_t *p = malloc (k * sizeof (size_t));
+  int status = 0, lstatus = 0, pstatus = 0, lpstatus = 0;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    x[i] = (double) urand (n / 4 + 1);
+
+  memcpy (y, x, n * sizeof (double));
+  gsl_sort (y, 1, n);
+
+  gsl_sort_smallest (z, k, x, 1, n);
+  for (i = 0; i < k; i++)
+    status |= (z[i] != y[i]);
+
+  gsl_sort_largest (z, k, x, 1, n);
+  for (i = 0; i < k; i++)
+    lstatus |= (z[i] != y[n - i - 1]);
+
+  gsl_sort_smallest_index (p, k, x, 1, n);
+  for (i = 0; i < k; i++)
+    {
+      pstatus |= (x[p[i]] != y[i]);
+      if (i > 0 && x[p[i]] == x[p[i - 1]])
+        pstatus |= (p[i] <= p[i - 1]);
+    }
+
+  gsl_sort_largest_index (p, k, x, 1, n);
+  for (i = 0; i < k; i++)
+    {
+      lpstatus |= (x[p[i]] != y[n - i - 1]);
+      if (i > 0 && x[p[i]] == x[p[i - 1]])
+        lpstatus |= (p[i] <= p[i - 1]);
+    }
+
+  gsl_test (status, "gsl_sort_smallest, n = %u, k = %u", n, k);
+  gsl_test (lstatus, "gsl_sort_largest, n = %u, k = %u", n, k);
+  gsl_test (pstatus, "gsl_sort_smallest_index, n = %u, k = %u", n, k);
+  gsl_test (lpstatus, "gsl_sort_largest_index, n = %u, k = %u", n, k);
+
+  free (x);
+  free (y);
+  free (z);
+  free (p);
+}
+
 int
 main (void)
 {
@@ -128,6 +307,15 @@ main (void)
         }
     }
 
+  test_patterns (1000);
+  test_patterns (100000);
+
+  test_subset (1000, 1);
+  test_subset (1000, 10);
+  test_subset (1000, 100);
+  test_subset (1000, 1000);
+  test_subset (100000, 5000);
+
   exit (gsl_test_summary ());
 }
 
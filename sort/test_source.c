@@ -144,6 +144,18 @@ TYPE (test_sort_vector) (size_t N, size_t stride)
   status = FUNCTION (my, check) (data, orig);
   gsl_test (status, "sorting, " NAME (gsl_vector) ", n = %u, stride = %u, randomized", N, stride);
 
+  FUNCTION (gsl_vector, memcpy) (data, data2);
+  FUNCTION (gsl_sort, heapsort) (data->data, data->stride, data->size);
+  status = FUNCTION (my, check) (data, orig);
+  gsl_test (status, "heapsort, " NAME (gsl_vector) ", n = %u, stride = %u, randomized", N, stride);
+
+#ifndef BASE_LONG_DOUBLE
+  FUNCTION (gsl_vector, memcpy) (data, data2);
+  FUNCTION (gsl_sort, radix) (data->data, data->stride, data->size);
+  status = FUNCTION (my, check) (data, orig);
+  gsl_test (status, "radix sort, " NAME (gsl_vector) ", n = %u, stride = %u, randomized", N, stride);
+#endif
+
   FUNCTION (gsl_vector, memcpy) (data, data2);
 
   FUNCTION (gsl_sort_vector, smallest) (small, k, data);
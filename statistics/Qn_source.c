@@ -207,10 +207,8 @@ FUNCTION(gsl_stats,Qn0_from_sorted_data) (const BASE sorted_data[],
       /* return pull(work, j - 1, knew - nl)	: */
       knew -= (nl + 1); /* -1: 0-indexing */
 
-      /* sort work array */
-      TYPE (gsl_sort) (work, 1, j);
-
-      return (work[knew]);
+      /* select element knew of work array */
+      return FUNCTION(gsl_stats,select) (work, 1, j, knew);
     }
 }
 
@@ -278,6 +276,53 @@ FUNCTION(gsl_stats,Qn_from_sorted_data) (const BASE sorted_data[],
   return Qn;
 }
 
+/*
+gsl_stats_Qn0()
+gsl_stats_Qn()
+  Compute Q_n for unsorted data, by sorting a copy of the data in
+the workspace and calling the _from_sorted_data functions
+
+Inputs: data     - array containing the observations
+        stride   - stride
+        n        - length of 'data'
+        work     - workspace of length 4n of type BASE
+        work_int - workspace of length 5n of type int
+*/
+
+BASE
+FUNCTION(gsl_stats,Qn0) (const BASE data[],
+                         const size_t stride,
+                         const size_t n,
+                         BASE work[],
+                         int work_int[])
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    work[i] = data[i * stride];
+
+  TYPE (gsl_sort) (work, 1, n);
+
+  return FUNCTION(gsl_stats,Qn0_from_sorted_data)(work, 1, n, work + n, work_int);
+}
+
+double
+FUNCTION(gsl_stats,Qn) (const BASE data[],
+                        const size_t stride,
+                        const size_t n,
+                        BASE work[],
+                        int work_int[])
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    work[i] = data[i * stride];
+
+  TYPE (gsl_sort) (work, 1, n);
+
+  return FUNCTION(gsl_stats,Qn_from_sorted_data)(work, 1, n, work + n, work_int);
+}
+
 /*
   Algorithm to compute the weighted high median in O(n) time.
 
@@ -314,12 +359,7 @@ FUNCTION(Qn,whimed)(BASE * a, int * w, int n, BASE * a_cand, BASE * a_srt, int *
         a_srt[i] = a[i];
 
       n2 = n/2; /* =^= n/2 +1 with 0-indexing */
-#if 0
-      rPsort(a_srt, n, n2);
-#else
-      TYPE (gsl_sort) (a_srt, 1, n);
-#endif
-      trial = a_srt[n2];
+      trial = FUNCTION(gsl_stats,select) (a_srt, 1, n, n2);
 
       wleft = 0;
       wmid = 0;
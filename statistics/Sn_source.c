@@ -208,10 +208,8 @@ FUNCTION(gsl_stats,Sn0_from_sorted_data) (const BASE sorted_data[],
 
   work[n - 1] = sorted_data[(n - 1) * stride] - sorted_data[(np1_2 - 1) * stride];
 
-  /* sort work array */
-  TYPE (gsl_sort) (work, 1, n);
-
-  return work[np1_2 - 1];
+  /* select the low median of work array */
+  return FUNCTION(gsl_stats,select) (work, 1, n, np1_2 - 1);
 }
 
 /*
@@ -267,3 +265,47 @@ FUNCTION(gsl_stats,Sn_from_sorted_data) (const BASE sorted_data[],
 
   return Sn;
 }
+
+/*
+gsl_stats_Sn0()
+gsl_stats_Sn()
+  Compute S_n for unsorted data, by sorting a copy of the data in
+the workspace and calling the _from_sorted_data functions
+
+Inputs: data   - array containing the observations
+        stride - stride
+        n      - length of 'data'
+        work   - workspace of length 2n
+*/
+
+BASE
+FUNCTION(gsl_stats,Sn0) (const BASE data[],
+                         const size_t stride,
+                         const size_t n,
+                         BASE work[])
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    work[i] = data[i * stride];
+
+  TYPE (gsl_sort) (work, 1, n);
+
+  return FUNCTION(gsl_stats,Sn0_from_sorted_data)(work, 1, n, work + n);
+}
+
+double
+FUNCTION(gsl_stats,Sn) (const BASE data[],
+                        const size_t stride,
+                        const size_t n,
+                        BASE work[])
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    work[i] = data[i * stride];
+
+  TYPE (gsl_sort) (work, 1, n);
+
+  return FUNCTION(gsl_stats,Sn_from_sorted_data)(work, 1, n, work + n);
+}
@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_summary.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -73,11 +74,14 @@ size_t gsl_stats_char_max_index (const char data[], const size_t stride, const s
 size_t gsl_stats_char_min_index (const char data[], const size_t stride, const size_t n);
 void gsl_stats_char_minmax_index (size_t * min_index, size_t * max_index, const char data[], const size_t stride, const size_t n);
 
+int gsl_stats_char_summary (const char data[], const size_t stride, const size_t n, gsl_stats_summary_t * s);
+
 char gsl_stats_char_select(char data[], const size_t stride, const size_t n, const size_t k);
 
 double gsl_stats_char_median_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_char_median (char sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_char_quantile_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_char_quantiles (char data[], const size_t stride, const size_t n, const double p[], const size_t m, double result[]);
 
 double gsl_stats_char_trmean_from_sorted_data (const double trim, const char sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_char_gastwirth_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n) ;
@@ -87,9 +91,13 @@ double gsl_stats_char_mad(const char data[], const size_t stride, const size_t n
 
 char gsl_stats_char_Sn0_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n, char work[]) ;
 double gsl_stats_char_Sn_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n, char work[]) ;
+char gsl_stats_char_Sn0 (const char data[], const size_t stride, const size_t n, char work[]) ;
+double gsl_stats_char_Sn (const char data[], const size_t stride, const size_t n, char work[]) ;
 
 char gsl_stats_char_Qn0_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n, char work[], int work_int[]) ;
 double gsl_stats_char_Qn_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n, char work[], int work_int[]) ;
+char gsl_stats_char_Qn0 (const char data[], const size_t stride, const size_t n, char work[], int work_int[]) ;
+double gsl_stats_char_Qn (const char data[], const size_t stride, const size_t n, char work[], int work_int[]) ;
 
 __END_DECLS
 
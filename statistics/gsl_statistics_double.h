@@ -22,6 +22,8 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_summary.h>
+#include <gsl/gsl_statistics_sorted_cache.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -93,11 +95,14 @@ size_t gsl_stats_max_index (const double data[], const size_t stride, const size
 size_t gsl_stats_min_index (const double data[], const size_t stride, const size_t n);
 void gsl_stats_minmax_index (size_t * min_index, size_t * max_index, const double data[], const size_t stride, const size_t n);
 
+int gsl_stats_summary (const double data[], const size_t stride, const size_t n, gsl_stats_summary_t * s);
+
 double gsl_stats_select(double data[], const size_t stride, const size_t n, const size_t k);
 
 double gsl_stats_median_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_median (double sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_quantile_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_quantiles (double data[], const size_t stride, const size_t n, const double p[], const size_t m, double result[]);
 
 double gsl_stats_trmean_from_sorted_data (const double trim, const double sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_gastwirth_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n) ;
@@ -107,9 +112,13 @@ double gsl_stats_mad(const double data[], const size_t stride, const size_t n, d
 
 double gsl_stats_Sn0_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n, double work[]) ;
 double gsl_stats_Sn_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n, double work[]) ;
+double gsl_stats_Sn0 (const double data[], const size_t stride, const size_t n, double work[]) ;
+double gsl_stats_Sn (const double data[], const size_t stride, const size_t n, double work[]) ;
 
 double gsl_stats_Qn0_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n, double work[], int work_int[]) ;
 double gsl_stats_Qn_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n, double work[], int work_int[]) ;
+double gsl_stats_Qn0 (const double data[], const size_t stride, const size_t n, double work[], int work_int[]) ;
+double gsl_stats_Qn (const double data[], const size_t stride, const size_t n, double work[], int work_int[]) ;
 
 __END_DECLS
 
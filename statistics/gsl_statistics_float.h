@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_summary.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -93,11 +94,14 @@ size_t gsl_stats_float_max_index (const float data[], const size_t stride, const
 size_t gsl_stats_float_min_index (const float data[], const size_t stride, const size_t n);
 void gsl_stats_float_minmax_index (size_t * min_index, size_t * max_index, const float data[], const size_t stride, const size_t n);
 
+int gsl_stats_float_summary (const float data[], const size_t stride, const size_t n, gsl_stats_summary_t * s);
+
 float gsl_stats_float_select(float data[], const size_t stride, const size_t n, const size_t k);
 
 double gsl_stats_float_median_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_float_median (float sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_float_quantile_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_float_quantiles (float data[], const size_t stride, const size_t n, const double p[], const size_t m, double result[]);
 
 double gsl_stats_float_trmean_from_sorted_data (const double trim, const float sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_float_gastwirth_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n) ;
@@ -107,9 +111,13 @@ double gsl_stats_float_mad(const float data[], const size_t stride, const size_t
 
 float gsl_stats_float_Sn0_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n, float work[]) ;
 double gsl_stats_float_Sn_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n, float work[]) ;
+float gsl_stats_float_Sn0 (const float data[], const size_t stride, const size_t n, float work[]) ;
+double gsl_stats_float_Sn (const float data[], const size_t stride, const size_t n, float work[]) ;
 
 float gsl_stats_float_Qn0_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n, float work[], int work_int[]) ;
 double gsl_stats_float_Qn_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n, float work[], int work_int[]) ;
+float gsl_stats_float_Qn0 (const float data[], const size_t stride, const size_t n, float work[], int work_int[]) ;
+double gsl_stats_float_Qn (const float data[], const size_t stride, const size_t n, float work[], int work_int[]) ;
 
 __END_DECLS
 
@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_summary.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -73,11 +74,14 @@ size_t gsl_stats_long_max_index (const long data[], const size_t stride, const s
 size_t gsl_stats_long_min_index (const long data[], const size_t stride, const size_t n);
 void gsl_stats_long_minmax_index (size_t * min_index, size_t * max_index, const long data[], const size_t stride, const size_t n);
 
+int gsl_stats_long_summary (const long data[], const size_t stride, const size_t n, gsl_stats_summary_t * s);
+
 long gsl_stats_long_select(long data[], const size_t stride, const size_t n, const size_t k);
 
 double gsl_stats_long_median_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_long_median (long sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_long_quantile_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_long_quantiles (long data[], const size_t stride, const size_t n, const double p[], const size_t m, double result[]);
 
 double gsl_stats_long_trmean_from_sorted_data (const double trim, const long sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_long_gastwirth_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n) ;
@@ -87,9 +91,13 @@ double gsl_stats_long_mad(const long data[], const size_t stride, const size_t n
 
 long gsl_stats_long_Sn0_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n, long work[]) ;
 double gsl_stats_long_Sn_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n, long work[]) ;
+long gsl_stats_long_Sn0 (const long data[], const size_t stride, const size_t n, long work[]) ;
+double gsl_stats_long_Sn (const long data[], const size_t stride, const size_t n, long work[]) ;
 
 long gsl_stats_long_Qn0_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n, long work[], int work_int[]) ;
 double gsl_stats_long_Qn_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n, long work[], int work_int[]) ;
+long gsl_stats_long_Qn0 (const long data[], const size_t stride, const size_t n, long work[], int work_int[]) ;
+double gsl_stats_long_Qn (const long data[], const size_t stride, const size_t n, long work[], int work_int[]) ;
 
 __END_DECLS
 
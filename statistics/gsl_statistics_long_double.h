@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_summary.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -93,11 +94,14 @@ size_t gsl_stats_long_double_max_index (const long double data[], const size_t s
 size_t gsl_stats_long_double_min_index (const long double data[], const size_t stride, const size_t n);
 void gsl_stats_long_double_minmax_index (size_t * min_index, size_t * max_index, const long double data[], const size_t stride, const size_t n);
 
+int gsl_stats_long_double_summary (const long double data[], const size_t stride, const size_t n, gsl_stats_summary_t * s);
+
 long double gsl_stats_long_double_select(long double data[], const size_t stride, const size_t n, const size_t k);
 
 double gsl_stats_long_double_median_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_long_double_median (long double sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_long_double_quantile_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_long_double_quantiles (long double data[], const size_t stride, const size_t n, const double p[], const size_t m, double result[]);
 
 double gsl_stats_long_double_trmean_from_sorted_data (const double trim, const long double sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_long_double_gastwirth_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n) ;
@@ -107,9 +111,13 @@ double gsl_stats_long_double_mad(const long double data[], const size_t stride,
 
 long double gsl_stats_long_double_Sn0_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n, long double work[]) ;
 double gsl_stats_long_double_Sn_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n, long double work[]) ;
+long double gsl_stats_long_double_Sn0 (const long double data[], const size_t stride, const size_t n, long double work[]) ;
+double gsl_stats_long_double_Sn (const long double data[], const size_t stride, const size_t n, long double work[]) ;
 
 long double gsl_stats_long_double_Qn0_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n, long double work[], int work_int[]) ;
 double gsl_stats_long_double_Qn_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n, long double work[], int work_int[]) ;
+long double gsl_stats_long_double_Qn0 (const long double data[], const size_t stride, const size_t n, long double work[], int work_int[]) ;
+double gsl_stats_long_double_Qn (const long double data[], const size_t stride, const size_t n, long double work[], int work_int[]) ;
 
 __END_DECLS
 
@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_summary.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -73,11 +74,14 @@ size_t gsl_stats_short_max_index (const short data[], const size_t stride, const
 size_t gsl_stats_short_min_index (const short data[], const size_t stride, const size_t n);
 void gsl_stats_short_minmax_index (size_t * min_index, size_t * max_index, const short data[], const size_t stride, const size_t n);
 
+int gsl_stats_short_summary (const short data[], const size_t stride, const size_t n, gsl_stats_summary_t * s);
+
 short gsl_stats_short_select(short data[], const size_t stride, const size_t n, const size_t k);
 
 double gsl_stats_short_median_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_short_median (short sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_short_quantile_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_short_quantiles (short data[], const size_t stride, const size_t n, const double p[], const size_t m, double result[]);
 
 double gsl_stats_short_trmean_from_sorted_data (const double trim, const short sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_short_gastwirth_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n) ;
@@ -87,9 +91,13 @@ double gsl_stats_short_mad(const short data[], const size_t stride, const size_t
 
 short gsl_stats_short_Sn0_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n, short work[]) ;
 double gsl_stats_short_Sn_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n, short work[]) ;
+short gsl_stats_short_Sn0 (const short data[], const size_t stride, const size_t n, short work[]) ;
+double gsl_stats_short_Sn (const short data[], const size_t stride, const size_t n, short work[]) ;
 
 short gsl_stats_short_Qn0_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n, short work[], int work_int[]) ;
 double gsl_stats_short_Qn_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n, short work[], int work_int[]) ;
+short gsl_stats_short_Qn0 (const short data[], const size_t stride, const size_t n, short work[], int work_int[]) ;
+double gsl_stats_short_Qn (const short data[], const size_t stride, const size_t n, short work[], int work_int[]) ;
 
 __END_DECLS
 
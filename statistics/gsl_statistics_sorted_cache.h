@@ -0,0 +1,65 @@
+/* statistics/gsl_statistics_sorted_cache.h
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_STATISTICS_SORTED_CACHE_H__
+#define __GSL_STATISTICS_SORTED_CACHE_H__
+
+#include <stddef.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* A sorted copy of a dataset, from which the median, quantiles and the
+   robust scale estimators MAD, S_n and Q_n can all be computed without
+   sorting the data again. */
+
+typedef struct
+{
+  size_t nmax;      /* maximum number of data */
+  size_t n;         /* number of data held */
+  double *sorted;   /* data in ascending order, length nmax */
+  double *work;     /* workspace for S_n and Q_n, length 3*nmax, allocated when first needed */
+  int *work_int;    /* workspace for Q_n, length 5*nmax, allocated when first needed */
+} gsl_stats_sorted_cache;
+
+gsl_stats_sorted_cache * gsl_stats_sorted_cache_alloc (const size_t nmax);
+void gsl_stats_sorted_cache_free (gsl_stats_sorted_cache * c);
+int gsl_stats_sorted_cache_set (const double data[], const size_t stride, const size_t n, gsl_stats_sorted_cache * c);
+
+double gsl_stats_sorted_cache_median (const gsl_stats_sorted_cache * c);
+double gsl_stats_sorted_cache_quantile (const double f, const gsl_stats_sorted_cache * c);
+double gsl_stats_sorted_cache_mad0 (const gsl_stats_sorted_cache * c);
+double gsl_stats_sorted_cache_mad (const gsl_stats_sorted_cache * c);
+double gsl_stats_sorted_cache_Sn0 (gsl_stats_sorted_cache * c);
+double gsl_stats_sorted_cache_Sn (gsl_stats_sorted_cache * c);
+double gsl_stats_sorted_cache_Qn0 (gsl_stats_sorted_cache * c);
+double gsl_stats_sorted_cache_Qn (gsl_stats_sorted_cache * c);
+
+__END_DECLS
+
+#endif /* __GSL_STATISTICS_SORTED_CACHE_H__ */
@@ -0,0 +1,62 @@
+/* statistics/gsl_statistics_summary.h
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_STATISTICS_SUMMARY_H__
+#define __GSL_STATISTICS_SUMMARY_H__
+
+#include <stddef.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* Count, mean, sums of powers of deviations from the mean and range of
+   a dataset, as computed in a single pass by gsl_stats_summary and the
+   other typed versions.  Summaries of disjoint datasets can be merged. */
+
+typedef struct
+{
+  size_t n;         /* number of values */
+  double mean;      /* mean */
+  double M2;        /* sum of (x - mean)^2 */
+  double M3;        /* sum of (x - mean)^3 */
+  double M4;        /* sum of (x - mean)^4 */
+  double min;       /* smallest value, +Inf if n = 0 */
+  double max;       /* largest value, -Inf if n = 0 */
+} gsl_stats_summary_t;
+
+void gsl_stats_summary_init (gsl_stats_summary_t * s);
+int gsl_stats_summary_merge (gsl_stats_summary_t * dest, const gsl_stats_summary_t * src);
+
+double gsl_stats_summary_variance (const gsl_stats_summary_t * s);
+double gsl_stats_summary_sd (const gsl_stats_summary_t * s);
+double gsl_stats_summary_skew (const gsl_stats_summary_t * s);
+double gsl_stats_summary_kurtosis (const gsl_stats_summary_t * s);
+
+__END_DECLS
+
+#endif /* __GSL_STATISTICS_SUMMARY_H__ */
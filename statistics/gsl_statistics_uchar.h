@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_summary.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -73,11 +74,14 @@ size_t gsl_stats_uchar_max_index (const unsigned char data[], const size_t strid
 size_t gsl_stats_uchar_min_index (const unsigned char data[], const size_t stride, const size_t n);
 void gsl_stats_uchar_minmax_index (size_t * min_index, size_t * max_index, const unsigned char data[], const size_t stride, const size_t n);
 
+int gsl_stats_uchar_summary (const unsigned char data[], const size_t stride, const size_t n, gsl_stats_summary_t * s);
+
 unsigned char gsl_stats_uchar_select(unsigned char data[], const size_t stride, const size_t n, const size_t k);
 
 double gsl_stats_uchar_median_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_uchar_median (unsigned char sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_uchar_quantile_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_uchar_quantiles (unsigned char data[], const size_t stride, const size_t n, const double p[], const size_t m, double result[]);
 
 double gsl_stats_uchar_trmean_from_sorted_data (const double trim, const unsigned char sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_uchar_gastwirth_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n) ;
@@ -87,9 +91,13 @@ double gsl_stats_uchar_mad(const unsigned char data[], const size_t stride, cons
 
 unsigned char gsl_stats_uchar_Sn0_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n, unsigned char work[]) ;
 double gsl_stats_uchar_Sn_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n, unsigned char work[]) ;
+unsigned char gsl_stats_uchar_Sn0 (const unsigned char data[], const size_t stride, const size_t n, unsigned char work[]) ;
+double gsl_stats_uchar_Sn (const unsigned char data[], const size_t stride, const size_t n, unsigned char work[]) ;
 
 unsigned char gsl_stats_uchar_Qn0_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n, unsigned char work[], int work_int[]) ;
 double gsl_stats_uchar_Qn_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n, unsigned char work[], int work_int[]) ;
+unsigned char gsl_stats_uchar_Qn0 (const unsigned char data[], const size_t stride, const size_t n, unsigned char work[], int work_int[]) ;
+double gsl_stats_uchar_Qn (const unsigned char data[], const size_t stride, const size_t n, unsigned char work[], int work_int[]) ;
 
 __END_DECLS
 
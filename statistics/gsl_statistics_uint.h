@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_summary.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -73,11 +74,14 @@ size_t gsl_stats_uint_max_index (const unsigned int data[], const size_t stride,
 size_t gsl_stats_uint_min_index (const unsigned int data[], const size_t stride, const size_t n);
 void gsl_stats_uint_minmax_index (size_t * min_index, size_t * max_index, const unsigned int data[], const size_t stride, const size_t n);
 
+int gsl_stats_uint_summary (const unsigned int data[], const size_t stride, const size_t n, gsl_stats_summary_t * s);
+
 unsigned int gsl_stats_uint_select(unsigned int data[], const size_t stride, const size_t n, const size_t k);
 
 double gsl_stats_uint_median_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_uint_median (unsigned int sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_uint_quantile_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_uint_quantiles (unsigned int data[], const size_t stride, const size_t n, const double p[], const size_t m, double result[]);
 
 double gsl_stats_uint_trmean_from_sorted_data (const double trim, const unsigned int sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_uint_gastwirth_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n) ;
@@ -87,9 +91,13 @@ double gsl_stats_uint_mad(const unsigned int data[], const size_t stride, const
 
 unsigned int gsl_stats_uint_Sn0_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n, unsigned int work[]) ;
 double gsl_stats_uint_Sn_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n, unsigned int work[]) ;
+unsigned int gsl_stats_uint_Sn0 (const unsigned int data[], const size_t stride, const size_t n, unsigned int work[]) ;
+double gsl_stats_uint_Sn (const unsigned int data[], const size_t stride, const size_t n, unsigned int work[]) ;
 
 unsigned int gsl_stats_uint_Qn0_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n, unsigned int work[], int work_int[]) ;
 double gsl_stats_uint_Qn_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n, unsigned int work[], int work_int[]) ;
+unsigned int gsl_stats_uint_Qn0 (const unsigned int data[], const size_t stride, const size_t n, unsigned int work[], int work_int[]) ;
+double gsl_stats_uint_Qn (const unsigned int data[], const size_t stride, const size_t n, unsigned int work[], int work_int[]) ;
 
 __END_DECLS
 
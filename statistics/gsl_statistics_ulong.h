@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_summary.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -73,11 +74,14 @@ size_t gsl_stats_ulong_max_index (const unsigned long data[], const size_t strid
 size_t gsl_stats_ulong_min_index (const unsigned long data[], const size_t stride, const size_t n);
 void gsl_stats_ulong_minmax_index (size_t * min_index, size_t * max_index, const unsigned long data[], const size_t stride, const size_t n);
 
+int gsl_stats_ulong_summary (const unsigned long data[], const size_t stride, const size_t n, gsl_stats_summary_t * s);
+
 unsigned long gsl_stats_ulong_select(unsigned long data[], const size_t stride, const size_t n, const size_t k);
 
 double gsl_stats_ulong_median_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_ulong_median (unsigned long sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_ulong_quantile_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_ulong_quantiles (unsigned long data[], const size_t stride, const size_t n, const double p[], const size_t m, double result[]);
 
 double gsl_stats_ulong_trmean_from_sorted_data (const double trim, const unsigned long sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_ulong_gastwirth_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n) ;
@@ -87,9 +91,13 @@ double gsl_stats_ulong_mad(const unsigned long data[], const size_t stride, cons
 
 unsigned long gsl_stats_ulong_Sn0_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n, unsigned long work[]) ;
 double gsl_stats_ulong_Sn_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n, unsigned long work[]) ;
+unsigned long gsl_stats_ulong_Sn0 (const unsigned long data[], const size_t stride, const size_t n, unsigned long work[]) ;
+double gsl_stats_ulong_Sn (const unsigned long data[], const size_t stride, const size_t n, unsigned long work[]) ;
 
 unsigned long gsl_stats_ulong_Qn0_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n, unsigned long work[], int work_int[]) ;
 double gsl_stats_ulong_Qn_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n, unsigned long work[], int work_int[]) ;
+unsigned long gsl_stats_ulong_Qn0 (const unsigned long data[], const size_t stride, const size_t n, unsigned long work[], int work_int[]) ;
+double gsl_stats_ulong_Qn (const unsigned long data[], const size_t stride, const size_t n, unsigned long work[], int work_int[]) ;
 
 __END_DECLS
 
@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_summary.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -73,11 +74,14 @@ size_t gsl_stats_ushort_max_index (const unsigned short data[], const size_t str
 size_t gsl_stats_ushort_min_index (const unsigned short data[], const size_t stride, const size_t n);
 void gsl_stats_ushort_minmax_index (size_t * min_index, size_t * max_index, const unsigned short data[], const size_t stride, const size_t n);
 
+int gsl_stats_ushort_summary (const unsigned short data[], const size_t stride, const size_t n, gsl_stats_summary_t * s);
+
 unsigned short gsl_stats_ushort_select(unsigned short data[], const size_t stride, const size_t n, const size_t k);
 
 double gsl_stats_ushort_median_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_ushort_median (unsigned short sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_ushort_quantile_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_ushort_quantiles (unsigned short data[], const size_t stride, const size_t n, const double p[], const size_t m, double result[]);
 
 double gsl_stats_ushort_trmean_from_sorted_data (const double trim, const unsigned short sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_ushort_gastwirth_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n) ;
@@ -87,9 +91,13 @@ double gsl_stats_ushort_mad(const unsigned short data[], const size_t stride, co
 
 unsigned short gsl_stats_ushort_Sn0_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n, unsigned short work[]) ;
 double gsl_stats_ushort_Sn_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n, unsigned short work[]) ;
+unsigned short gsl_stats_ushort_Sn0 (const unsigned short data[], const size_t stride, const size_t n, unsigned short work[]) ;
+double gsl_stats_ushort_Sn (const unsigned short data[], const size_t stride, const size_t n, unsigned short work[]) ;
 
 unsigned short gsl_stats_ushort_Qn0_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n, unsigned short work[], int work_int[]) ;
 double gsl_stats_ushort_Qn_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n, unsigned short work[], int work_int[]) ;
+unsigned short gsl_stats_ushort_Qn0 (const unsigned short data[], const size_t stride, const size_t n, unsigned short work[], int work_int[]) ;
+double gsl_stats_ushort_Qn (const unsigned short data[], const size_t stride, const size_t n, unsigned short work[], int work_int[]) ;
 
 __END_DECLS
 
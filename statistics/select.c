@@ -1,8 +1,17 @@
 #include <config.h>
+#include <stdlib.h>
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
+#include <gsl/gsl_heapsort.h>
 #include <gsl/gsl_statistics.h>
 
+static int
+select_compare_size (const void * a, const void * b)
+{
+  const size_t x = *(const size_t *) a, y = *(const size_t *) b;
+  return (x > y) - (x < y);
+}
+
 #define BASE_LONG_DOUBLE
 #include "templates_on.h"
 #include "select_source.c"
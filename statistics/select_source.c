@@ -19,17 +19,174 @@
 
 #define SWAP(a,b) do { tmp = b ; b = a ; a = tmp ; } while(0)
 
+/*
+FUNCTION(select,mom)()
+  Partition data[left..right] around the median of the medians of
+groups of 5 elements, which is guaranteed to split off at least about
+3/10 of the elements on each side.  On output the elements in [*lt,*gt]
+are equal to the pivot, those before *lt are smaller and those after
+*gt are larger.
+*/
+
+static void FUNCTION(select,range) (BASE data[], const size_t stride,
+                                    size_t left, size_t right, const size_t k);
+
+static void
+FUNCTION(select,mom) (BASE data[], const size_t stride,
+                      const size_t left, const size_t right,
+                      size_t * lt, size_t * gt)
+{
+  size_t g, i, j, ng = 0;
+  BASE pivot, tmp;
+
+  /* move the median of each complete group of 5 to the front */
+  for (g = left; g + 4 <= right; g += 5)
+    {
+      for (i = g + 1; i <= g + 4; i++)
+        {
+          for (j = i; j > g && data[j * stride] < data[(j - 1) * stride]; j--)
+            SWAP(data[j * stride], data[(j - 1) * stride]);
+        }
+
+      SWAP(data[(g + 2) * stride], data[(left + ng) * stride]);
+      ng++;
+    }
+
+  FUNCTION(select,range) (data, stride, left, left + ng - 1, left + (ng - 1) / 2);
+  pivot = data[(left + (ng - 1) / 2) * stride];
+
+  /* three-way partition */
+  *lt = left;
+  *gt = right;
+  i = left;
+
+  while (i <= *gt)
+    {
+      if (data[i * stride] < pivot)
+        {
+          SWAP(data[i * stride], data[*lt * stride]);
+          (*lt)++;
+          i++;
+        }
+      else if (data[i * stride] > pivot)
+        {
+          SWAP(data[i * stride], data[*gt * stride]);
+          (*gt)--;
+        }
+      else
+        {
+          i++;
+        }
+    }
+}
+
+/*
+FUNCTION(select,range)()
+  Rearrange data[left..right] so that data[k] is the element which
+would be there if the range were sorted, with no larger element before
+it and no smaller element after it.  This is the introselect algorithm:
+median-of-3 quickselect, switching to median-of-medians pivots if the
+range has not shrunk after 2 log2(n) partitions, so that the worst case
+is O(n).
+*/
+
+static void
+FUNCTION(select,range) (BASE data[], const size_t stride,
+                        size_t left, size_t right, const size_t k)
+{
+  size_t depth = 0, m;
+  size_t mid, i, j;
+  BASE pivot, tmp;
+
+  for (m = right - left + 1; m > 1; m >>= 1)
+    depth += 2;
+
+  while (1)
+    {
+      if (right <= left + 1)
+        {
+          if (right == left + 1 && data[right * stride] < data[left * stride])
+            {
+              SWAP(data[left * stride], data[right * stride]);
+            }
+
+          return;
+        }
+      else if (depth == 0 && right - left >= 5)
+        {
+          size_t lt, gt;
+
+          FUNCTION(select,mom) (data, stride, left, right, &lt, &gt);
+
+          if (k < lt)
+            right = lt - 1;
+          else if (k > gt)
+            left = gt + 1;
+          else
+            return;
+        }
+      else
+        {
+          if (depth > 0)
+            depth--;
+
+          mid = (left + right) >> 1;
+          SWAP(data[mid * stride], data[(left + 1) * stride]);
+
+          if (data[left * stride] > data[right * stride])
+            {
+              SWAP(data[left * stride], data[right * stride]);
+            }
+
+          if (data[(left + 1) * stride] > data[right * stride])
+            {
+              SWAP(data[(left + 1) * stride], data[right * stride]);
+            }
+
+          if (data[left * stride] > data[(left + 1) * stride])
+            {
+              SWAP(data[left * stride], data[(left + 1) * stride]);
+            }
+
+          i = left + 1;
+          j = right;
+          pivot = data[(left + 1) * stride];
+
+          while (1)
+            {
+              do i++; while (data[i * stride] < pivot);
+              do j--; while (data[j * stride] > pivot);
+
+              if (j < i)
+                break;
+
+              SWAP(data[i * stride], data[j * stride]);
+            }
+
+          data[(left + 1) * stride] = data[j * stride];
+          data[j * stride] = pivot;
+
+          if (j >= k)
+            right = j - 1;
+
+          if (j <= k)
+            left = i;
+        }
+    }
+}
+
 /*
 gsl_stats_select()
-  Select k-th largest element from an unsorted array using
-quickselect algorithm
+  Select k-th smallest element from an unsorted array using
+the introselect algorithm
 
 Inputs: data   - unsorted array containing the observations
         stride - stride
         n      - length of 'data'
         k      - desired element in [0,n-1]
 
-Return: k-th largest element of data[]
+Return: k-th smallest element of data[]; on output the elements
+        before position k are <= it and those after are >= it
 */
 
 BASE
@@ -42,71 +199,124 @@ FUNCTION(gsl_stats,select) (BASE data[],
     {
       GSL_ERROR_VAL("array size must be positive", GSL_EBADLEN, 0.0);
     }
+  else if (k >= n)
+    {
+      GSL_ERROR_VAL("k must be less than n", GSL_EINVAL, 0.0);
+    }
   else
     {
-      size_t left = 0;
-      size_t right = n - 1;
-      size_t mid, i, j;
-      BASE pivot, tmp;
+      FUNCTION(select,range) (data, stride, 0, n - 1, k);
+      return data[k * stride];
+    }
+}
 
-      while (1)
-        {
-          if (right <= left + 1)
-            {
-              if (right == left + 1 && data[right * stride] < data[left * stride])
-                {
-                  SWAP(data[left * stride], data[right * stride]);
-                }
+/* place the order statistics r[0..c-1] (sorted, distinct, all in
+   [left,right]) by selecting the middle one and recursing on both sides */
+static void
+FUNCTION(select,multi) (BASE data[], const size_t stride,
+                        const size_t left, const size_t right,
+                        const size_t r[], const size_t c)
+{
+  const size_t mid = c / 2;
+  const size_t k = r[mid];
 
-              return data[k * stride];
-            }
-          else
-            {
-              mid = (left + right) >> 1;
-              SWAP(data[mid * stride], data[(left + 1) * stride]);
+  FUNCTION(select,range) (data, stride, left, right, k);
 
-              if (data[left * stride] > data[right * stride])
-                {
-                  SWAP(data[left * stride], data[right * stride]);
-                }
+  if (mid > 0)
+    FUNCTION(select,multi) (data, stride, left, k - 1, r, mid);
 
-              if (data[(left + 1) * stride] > data[right * stride])
-                {
-                  SWAP(data[(left + 1) * stride], data[right * stride]);
-                }
+  if (mid + 1 < c)
+    FUNCTION(select,multi) (data, stride, k + 1, right, r + mid + 1, c - mid - 1);
+}
 
-              if (data[left * stride] > data[(left + 1) * stride])
-                {
-                  SWAP(data[left * stride], data[(left + 1) * stride]);
-                }
+/*
+gsl_stats_quantiles()
+  Compute several quantiles of an unsorted array at once, with the
+same interpolation as gsl_stats_quantile_from_sorted_data().  All the
+order statistics needed are found in a single multi-select pass, in
+O(n log m) time.
 
-              i = left + 1;
-              j = right;
-              pivot = data[(left + 1) * stride];
+Inputs: data   - unsorted array containing the observations, rearranged
+                 on output
+        stride - stride
+        n      - length of 'data'
+        p      - quantiles to compute, in [0,1], in any order
+        m      - number of quantiles
+        result - (output) result[i] is the p[i] quantile of data[]
+*/
 
-              while (1)
-                {
-                  do i++; while (data[i * stride] < pivot);
-                  do j--; while (data[j * stride] > pivot);
+int
+FUNCTION(gsl_stats,quantiles) (BASE data[],
+                               const size_t stride,
+                               const size_t n,
+                               const double p[],
+                               const size_t m,
+                               double result[])
+{
+  if (n == 0)
+    {
+      GSL_ERROR("array size must be positive", GSL_EBADLEN);
+    }
+  else if (m == 0)
+    {
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      size_t *r = malloc(2 * m * sizeof(size_t));
+      size_t i, c = 0, m1;
+
+      if (r == 0)
+        {
+          GSL_ERROR("failed to allocate space for order statistics", GSL_ENOMEM);
+        }
+
+      for (i = 0; i < m; i++)
+        {
+          double index;
+          size_t lhs;
 
-                  if (j < i)
-                    break;
+          if (!(p[i] >= 0.0 && p[i] <= 1.0))
+            {
+              free(r);
+              GSL_ERROR("quantiles must be in [0,1]", GSL_EDOM);
+            }
 
-                  SWAP(data[i * stride], data[j * stride]);
-                }
+          index = p[i] * (n - 1);
+          lhs = (size_t) index;
 
-              data[(left + 1) * stride] = data[j * stride];
-              data[j * stride] = pivot;
+          r[c++] = lhs;
+          if (lhs < n - 1 && index > lhs)
+            r[c++] = lhs + 1;
+        }
 
-              if (j >= k)
-                right = j - 1;
+      /* sort the ranks and remove duplicates */
+      gsl_heapsort(r, c, sizeof(size_t), select_compare_size);
 
-              if (j <= k)
-                left = i;
-            }
+      for (i = 1, m1 = 1; i < c; i++)
+        {
+          if (r[i] != r[m1 - 1])
+            r[m1++] = r[i];
         }
 
-      /* will never get here */
-      GSL_ERROR_VAL("select error", GSL_FAILURE, 0.0);
+      FUNCTION(select,multi) (data, stride, 0, n - 1, r, m1);
+
+      for (i = 0; i < m; i++)
+        {
+          const double index = p[i] * (n - 1);
+          const size_t lhs = (size_t) index;
+          const double delta = index - lhs;
+
+          if (lhs == n - 1 || delta == 0.0)
+            result[i] = data[lhs * stride];
+          else
+            result[i] = (1 - delta) * data[lhs * stride] + delta * data[(lhs + 1) * stride];
+        }
+
+      free(r);
+
+      return GSL_SUCCESS;
     }
 }
+
+#undef SWAP
@@ -0,0 +1,225 @@
+/* statistics/sorted_cache.c
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* A sorted copy of a dataset shared by the order statistics and robust
+   scale estimators.  The data are sorted once, with a radix sort, and
+   each estimator then works from the sorted copy: the median and
+   quantiles in O(1), the MAD in O(n) and S_n and Q_n in O(n log n)
+   without a further sort of the data. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_sort.h>
+#include <gsl/gsl_statistics.h>
+
+gsl_stats_sorted_cache *
+gsl_stats_sorted_cache_alloc (const size_t nmax)
+{
+  gsl_stats_sorted_cache *c;
+
+  if (nmax == 0)
+    {
+      GSL_ERROR_NULL ("nmax must be positive", GSL_EINVAL);
+    }
+
+  c = calloc (1, sizeof (gsl_stats_sorted_cache));
+  if (c == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  c->sorted = malloc (nmax * sizeof (double));
+  if (c->sorted == 0)
+    {
+      gsl_stats_sorted_cache_free (c);
+      GSL_ERROR_NULL ("failed to allocate space for sorted data", GSL_ENOMEM);
+    }
+
+  c->nmax = nmax;
+  c->n = 0;
+
+  return c;
+}
+
+void
+gsl_stats_sorted_cache_free (gsl_stats_sorted_cache * c)
+{
+  RETURN_IF_NULL (c);
+
+  if (c->sorted)
+    free (c->sorted);
+
+  if (c->work)
+    free (c->work);
+
+  if (c->work_int)
+    free (c->work_int);
+
+  free (c);
+}
+
+int
+gsl_stats_sorted_cache_set (const double data[], const size_t stride,
+                            const size_t n, gsl_stats_sorted_cache * c)
+{
+  size_t i;
+
+  if (n > c->nmax)
+    {
+      GSL_ERROR ("n exceeds the size of the workspace", GSL_EBADLEN);
+    }
+
+  for (i = 0; i < n; ++i)
+    c->sorted[i] = data[i * stride];
+
+  gsl_sort_radix (c->sorted, 1, n);
+
+  c->n = n;
+
+  return GSL_SUCCESS;
+}
+
+double
+gsl_stats_sorted_cache_median (const gsl_stats_sorted_cache * c)
+{
+  return gsl_stats_median_from_sorted_data (c->sorted, 1, c->n);
+}
+
+double
+gsl_stats_sorted_cache_quantile (const double f, const gsl_stats_sorted_cache * c)
+{
+  return gsl_stats_quantile_from_sorted_data (c->sorted, 1, c->n, f);
+}
+
+/* The absolute deviations from the median of the elements below the
+   median, taken from the middle outwards, form one increasing sequence
+   and those of the elements above it form another, so the median of
+   the deviations is found by merging the two sequences up to the
+   middle. */
+
+double
+gsl_stats_sorted_cache_mad0 (const gsl_stats_sorted_cache * c)
+{
+  const double *x = c->sorted;
+  const size_t n = c->n;
+  const size_t lhs = (n - 1) / 2;
+  const size_t rhs = n / 2;
+  double median, d = 0.0, dprev = 0.0;
+  size_t i, lo, hi;
+
+  if (n == 0)
+    return 0.0;
+
+  median = gsl_stats_median_from_sorted_data (x, 1, n);
+
+  /* lo + 1 elements x[0..lo] remain below, x[hi..n-1] above */
+  lo = lhs + 1;
+  hi = lhs + 1;
+
+  for (i = 0; i <= rhs; ++i)
+    {
+      dprev = d;
+
+      if (hi >= n || (lo > 0 && median - x[lo - 1] <= x[hi] - median))
+        {
+          d = median - x[lo - 1];
+          --lo;
+        }
+      else
+        {
+          d = x[hi] - median;
+          ++hi;
+        }
+    }
+
+  /* d is deviation rhs and dprev deviation rhs - 1 = lhs for n even */
+  if (lhs == rhs)
+    return d;
+  else
+    return 0.5 * (dprev + d);
+}
+
+double
+gsl_stats_sorted_cache_mad (const gsl_stats_sorted_cache * c)
+{
+  return 1.482602218505602 * gsl_stats_sorted_cache_mad0 (c);
+}
+
+/* allocate the workspaces for S_n and Q_n when they are first used */
+static int
+sorted_cache_work (const int need_int, gsl_stats_sorted_cache * c)
+{
+  if (c->work == 0)
+    {
+      c->work = malloc (3 * c->nmax * sizeof (double));
+      if (c->work == 0)
+        {
+          GSL_ERROR ("failed to allocate space for work", GSL_ENOMEM);
+        }
+    }
+
+  if (need_int && c->work_int == 0)
+    {
+      c->work_int = malloc (5 * c->nmax * sizeof (int));
+      if (c->work_int == 0)
+        {
+          GSL_ERROR ("failed to allocate space for work_int", GSL_ENOMEM);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+double
+gsl_stats_sorted_cache_Sn0 (gsl_stats_sorted_cache * c)
+{
+  if (sorted_cache_work (0, c))
+    return GSL_NAN;
+
+  return gsl_stats_Sn0_from_sorted_data (c->sorted, 1, c->n, c->work);
+}
+
+double
+gsl_stats_sorted_cache_Sn (gsl_stats_sorted_cache * c)
+{
+  if (sorted_cache_work (0, c))
+    return GSL_NAN;
+
+  return gsl_stats_Sn_from_sorted_data (c->sorted, 1, c->n, c->work);
+}
+
+double
+gsl_stats_sorted_cache_Qn0 (gsl_stats_sorted_cache * c)
+{
+  if (sorted_cache_work (1, c))
+    return GSL_NAN;
+
+  return gsl_stats_Qn0_from_sorted_data (c->sorted, 1, c->n, c->work, c->work_int);
+}
+
+double
+gsl_stats_sorted_cache_Qn (gsl_stats_sorted_cache * c)
+{
+  if (sorted_cache_work (1, c))
+    return GSL_NAN;
+
+  return gsl_stats_Qn_from_sorted_data (c->sorted, 1, c->n, c->work, c->work_int);
+}
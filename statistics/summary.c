@@ -0,0 +1,280 @@
+/* statistics/summary.c
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Single-pass summary statistics.
+
+   The data are processed in blocks small enough to stay in the level 1
+   cache.  Each block is summarized exactly as in a two-pass algorithm:
+   a first loop finds the sum and a second loop accumulates the powers
+   of the deviations from the block mean.  The
+   loops use several independent accumulators so they pipeline (and
+   vectorize), and contain no divisions.  Memory is still read only
+   once.
+
+   The block summaries are then combined pairwise, like the terms of a
+   pairwise sum, using the update formulas of Chan, Golub and LeVeque
+   (Algorithms for computing the sample variance, Am Stat 37, 242--247
+   (1983)) extended to the third and fourth moments by Pebay (Formulas
+   for robust, one-pass parallel computation of covariances and
+   arbitrary-order statistical moments, Sandia report SAND2008-6212).
+   The rounding error then grows with the logarithm of the number of
+   blocks rather than linearly.
+
+   The first value is subtracted from the data before they are
+   summarized, so that the block means are small numbers and do not
+   lose the low-order digits of data with a large mean. */
+
+#include <config.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_statistics.h>
+
+/* number of values in a block */
+#define SUMMARY_BLOCK 256
+
+/* depth of the merge stack, enough for any size_t count */
+#define SUMMARY_LEVELS (8 * sizeof (size_t))
+
+void
+gsl_stats_summary_init (gsl_stats_summary_t * s)
+{
+  s->n = 0;
+  s->mean = 0.0;
+  s->M2 = 0.0;
+  s->M3 = 0.0;
+  s->M4 = 0.0;
+  s->min = GSL_POSINF;
+  s->max = GSL_NEGINF;
+}
+
+int
+gsl_stats_summary_merge (gsl_stats_summary_t * dest,
+                         const gsl_stats_summary_t * src)
+{
+  if (src->n == 0)
+    {
+      return GSL_SUCCESS;
+    }
+  else if (dest->n == 0)
+    {
+      *dest = *src;
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      const double na = (double) dest->n;
+      const double nb = (double) src->n;
+      const double n = na + nb;
+      const double d = src->mean - dest->mean;
+      const double d_n = d / n;
+      const double d_n2 = d_n * d_n;
+      const double t = d * d_n * na * nb;  /* d^2 na nb / n */
+      const double a2 = dest->M2, a3 = dest->M3;
+      const double b2 = src->M2, b3 = src->M3;
+
+      dest->M4 += src->M4 + t * d_n2 * (na * na - na * nb + nb * nb)
+        + 6.0 * d_n2 * (na * na * b2 + nb * nb * a2)
+        + 4.0 * d_n * (na * b3 - nb * a3);
+      dest->M3 += b3 + t * d_n * (na - nb)
+        + 3.0 * d_n * (na * b2 - nb * a2);
+      dest->M2 += b2 + t;
+      dest->mean += d_n * nb;
+      dest->n += src->n;
+
+      /* a NaN extremum in either summary is kept */
+
+      if (src->min < dest->min || isnan (src->min))
+        dest->min = isnan (dest->min) ? dest->min : src->min;
+
+      if (src->max > dest->max || isnan (src->max))
+        dest->max = isnan (dest->max) ? dest->max : src->max;
+
+      return GSL_SUCCESS;
+    }
+}
+
+double
+gsl_stats_summary_variance (const gsl_stats_summary_t * s)
+{
+  return s->M2 / (s->n - 1.0);
+}
+
+double
+gsl_stats_summary_sd (const gsl_stats_summary_t * s)
+{
+  return sqrt (gsl_stats_summary_variance (s));
+}
+
+double
+gsl_stats_summary_skew (const gsl_stats_summary_t * s)
+{
+  /* normalized by the estimated sd, as in gsl_stats_skew */
+  const double sd = gsl_stats_summary_sd (s);
+  return (s->M3 / s->n) / (sd * sd * sd);
+}
+
+double
+gsl_stats_summary_kurtosis (const gsl_stats_summary_t * s)
+{
+  /* normalized by the estimated variance, as in gsl_stats_kurtosis */
+  const double var = gsl_stats_summary_variance (s);
+  return (s->M4 / s->n) / (var * var) - 3.0;
+}
+
+/* summarize the m > 0 contiguous values x[], apart from the range */
+
+static void
+summary_block (const double x[], const size_t m, gsl_stats_summary_t * s)
+{
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  double c, delta, S1, S2, S3, S4;
+  size_t i;
+
+  for (i = 0; i + 4 <= m; i += 4)
+    {
+      s0 += x[i];
+      s1 += x[i + 1];
+      s2 += x[i + 2];
+      s3 += x[i + 3];
+    }
+
+  for (; i < m; i++)
+    s0 += x[i];
+
+  c = ((s0 + s1) + (s2 + s3)) / m;
+
+  /* sums of powers of the deviations from c, in two lanes */
+
+  {
+    double p1[2] = { 0.0, 0.0 }, p2[2] = { 0.0, 0.0 };
+    double p3[2] = { 0.0, 0.0 }, p4[2] = { 0.0, 0.0 };
+
+    for (i = 0; i + 2 <= m; i += 2)
+      {
+        const double d0 = x[i] - c, d1 = x[i + 1] - c;
+        const double e0 = d0 * d0, e1 = d1 * d1;
+
+        p1[0] += d0;
+        p1[1] += d1;
+        p2[0] += e0;
+        p2[1] += e1;
+        p3[0] += e0 * d0;
+        p3[1] += e1 * d1;
+        p4[0] += e0 * e0;
+        p4[1] += e1 * e1;
+      }
+
+    if (i < m)
+      {
+        const double d0 = x[i] - c, e0 = d0 * d0;
+
+        p1[0] += d0;
+        p2[0] += e0;
+        p3[0] += e0 * d0;
+        p4[0] += e0 * e0;
+      }
+
+    S1 = p1[0] + p1[1];
+    S2 = p2[0] + p2[1];
+    S3 = p3[0] + p3[1];
+    S4 = p4[0] + p4[1];
+  }
+
+  /* c is the rounded mean, so S1 is small but not exactly zero;
+     shift the moments to the exact mean c + delta */
+
+  delta = S1 / m;
+
+  s->n = m;
+  s->mean = c + delta;
+  s->M2 = S2 - S1 * delta;
+  s->M3 = S3 - 3.0 * delta * S2 + 2.0 * m * delta * delta * delta;
+  s->M4 = S4 - 4.0 * delta * S3 + 6.0 * delta * delta * S2
+    - 3.0 * m * delta * delta * delta * delta;
+  s->min = GSL_POSINF;
+  s->max = GSL_NEGINF;
+}
+
+#define BASE_LONG_DOUBLE
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_LONG_DOUBLE
+
+#define BASE_DOUBLE
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_DOUBLE
+
+#define BASE_FLOAT
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_FLOAT
+
+#define BASE_ULONG
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_ULONG
+
+#define BASE_LONG
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_LONG
+
+#define BASE_UINT
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_UINT
+
+#define BASE_INT
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_INT
+
+#define BASE_USHORT
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_USHORT
+
+#define BASE_SHORT
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_SHORT
+
+#define BASE_UCHAR
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_UCHAR
+
+#define BASE_CHAR
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_CHAR
+
@@ -0,0 +1,92 @@
+/* statistics/summary_source.c
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+int
+FUNCTION (gsl_stats,summary) (const BASE data[], const size_t stride,
+                              const size_t n, gsl_stats_summary_t * s)
+{
+  /* computes the count, mean, central moments and range of a dataset
+     in a single pass */
+
+  gsl_stats_summary_t stack[SUMMARY_LEVELS];
+  double x[SUMMARY_BLOCK];
+  double shift = 0.0, min = GSL_POSINF, max = GSL_NEGINF;
+  size_t top = 0;
+  size_t i;
+
+  if (n > 0 && gsl_finite ((double) data[0]))
+    shift = (double) data[0];
+
+  for (i = 0; i < n; i += SUMMARY_BLOCK)
+    {
+      const size_t m = GSL_MIN (SUMMARY_BLOCK, n - i);
+      size_t j;
+
+      /* gather the block, so that the kernel sees contiguous doubles */
+
+      for (j = 0; j < m; j++)
+        {
+          const double xj = (double) data[(i + j) * stride];
+
+          min = (xj < min) ? xj : min;
+          max = (xj > max) ? xj : max;
+          x[j] = xj - shift;
+        }
+
+      summary_block (x, m, &stack[top++]);
+
+#ifdef FP
+      /* a NaN gives a NaN mean, and also a NaN minimum and maximum as
+         in gsl_stats_minmax */
+
+      if (isnan (stack[top - 1].mean))
+        {
+          for (j = 0; j < m; j++)
+            {
+              if (isnan (x[j]))
+                min = max = x[j];
+            }
+        }
+#endif
+
+      /* merge blocks of equal size, as in a pairwise sum */
+
+      while (top >= 2 && stack[top - 2].n == stack[top - 1].n)
+        {
+          gsl_stats_summary_merge (&stack[top - 2], &stack[top - 1]);
+          top--;
+        }
+    }
+
+  gsl_stats_summary_init (s);
+
+  while (top > 0)
+    {
+      gsl_stats_summary_merge (s, &stack[--top]);
+    }
+
+  if (n > 0)
+    {
+      s->mean += shift;
+      s->min = min;
+      s->max = max;
+    }
+
+  return GSL_SUCCESS;
+}
@@ -100,6 +100,141 @@ int test_robust (void);
 #include "templates_off.h"
 #undef  BASE_CHAR
 
+/* compare gsl_stats_summary on a large dataset with a large mean against
+   a two-pass calculation in long double, and check merging */
+static void
+test_summary (void)
+{
+  const size_t n = 100003, k = 31337;
+  double *x = (double *) malloc (n * sizeof (double));
+  gsl_stats_summary_t s, a, b;
+  long double mean = 0, m2 = 0, m3 = 0, m4 = 0;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      double u = sin (1.0 + i) * cos (0.1 * i);
+      x[i] = 1.0e8 + u * u * u;
+      mean += x[i] - x[0];
+    }
+
+  mean /= n;
+
+  for (i = 0; i < n; i++)
+    {
+      long double d = (x[i] - x[0]) - mean;
+      m2 += d * d;
+      m3 += d * d * d;
+      m4 += d * d * d * d;
+    }
+
+  gsl_stats_summary (x, 1, n, &s);
+
+  gsl_test (s.n != n, "gsl_stats_summary large n");
+  gsl_test_rel (s.mean, x[0] + (double) mean, 1e-15, "gsl_stats_summary large mean");
+  gsl_test_rel (s.M2, (double) m2, 1e-12, "gsl_stats_summary large M2");
+  gsl_test_rel (s.M3, (double) m3, 1e-10, "gsl_stats_summary large M3");
+  gsl_test_rel (s.M4, (double) m4, 1e-12, "gsl_stats_summary large M4");
+  gsl_test_rel (gsl_stats_summary_variance (&s), gsl_stats_variance (x, 1, n),
+                1e-12, "gsl_stats_summary large variance");
+
+  gsl_stats_summary (x, 1, k, &a);
+  gsl_stats_summary (x + k, 1, n - k, &b);
+  gsl_stats_summary_merge (&a, &b);
+
+  gsl_test (a.n != n, "gsl_stats_summary_merge n");
+  gsl_test_rel (a.mean, s.mean, 1e-15, "gsl_stats_summary_merge mean");
+  gsl_test_rel (a.M2, s.M2, 1e-12, "gsl_stats_summary_merge M2");
+  gsl_test_rel (a.M3, s.M3, 1e-6, "gsl_stats_summary_merge M3");
+  gsl_test_rel (a.M4, s.M4, 1e-10, "gsl_stats_summary_merge M4");
+  gsl_test (a.min != s.min || a.max != s.max, "gsl_stats_summary_merge min/max");
+
+  gsl_stats_summary (x, 1, 0, &b);
+  gsl_test (b.n != 0 || b.min != GSL_POSINF || b.max != GSL_NEGINF,
+            "gsl_stats_summary empty");
+
+  x[n / 2] = GSL_NAN;
+  gsl_stats_summary (x, 1, n, &s);
+  gsl_test (!isnan (s.mean) || !isnan (s.min) || !isnan (s.max),
+            "gsl_stats_summary NaN");
+
+  free (x);
+}
+
+
+/* compare gsl_stats_select, gsl_stats_median and gsl_stats_quantiles
+   with a full sort, for patterns which are bad cases for quickselect */
+static void
+test_select (const size_t n)
+{
+  const double p[7] = { 0.999, 0.5, 0.9, 0.0, 0.99, 1.0, 0.123 };
+  double *x = (double *) malloc (n * sizeof (double));
+  double *y = (double *) malloc (n * sizeof (double));
+  double *z = (double *) malloc (n * sizeof (double));
+  double q[7];
+  int pattern;
+  size_t i, j;
+
+  for (pattern = 0; pattern < 5; pattern++)
+    {
+      int status = 0, pstatus = 0;
+
+      for (i = 0; i < n; i++)
+        {
+          switch (pattern)
+            {
+            case 0:             /* pseudo-random with repeats */
+              x[i] = (double) ((i * 7919) % (n / 3 + 1));
+              break;
+            case 1:             /* organ pipe */
+              x[i] = (double) (i < n / 2 ? i : n - i);
+              break;
+            case 2:             /* reversed */
+              x[i] = (double) (n - i);
+              break;
+            case 3:             /* all equal */
+              x[i] = 1.0;
+              break;
+            case 4:             /* sawtooth */
+              x[i] = (double) (i % 16);
+              break;
+            }
+        }
+
+      memcpy (y, x, n * sizeof (double));
+      gsl_sort (y, 1, n);
+
+      for (j = 0; j < 20; j++)
+        {
+          const size_t k = (j * (n - 1)) / 19;
+          double xk;
+
+          memcpy (z, x, n * sizeof (double));
+          xk = gsl_stats_select (z, 1, n, k);
+          status |= (xk != y[k]);
+
+          /* the data must be partitioned around element k */
+          for (i = 0; i < n; i++)
+            status |= (i < k) ? (z[i] > xk) : (z[i] < xk);
+        }
+
+      memcpy (z, x, n * sizeof (double));
+      status |= (gsl_stats_median (z, 1, n) != gsl_stats_median_from_sorted_data (y, 1, n));
+
+      memcpy (z, x, n * sizeof (double));
+      gsl_stats_quantiles (z, 1, n, p, 7, q);
+
+      for (i = 0; i < 7; i++)
+        pstatus |= (q[i] != gsl_stats_quantile_from_sorted_data (y, 1, n, p[i]));
+
+      gsl_test (status, "gsl_stats_select, n = %u, pattern %d", n, pattern);
+      gsl_test (pstatus, "gsl_stats_quantiles, n = %u, pattern %d", n, pattern);
+    }
+
+  free (x);
+  free (y);
+  free (z);
+}
 
 int
 main (void)
@@ -128,6 +263,9 @@ main (void)
 
   test_nist();
   test_robust();
+  test_summary();
+  test_select(1000);
+  test_select(100000);
 
   exit (gsl_test_summary ());
 }
@@ -128,6 +128,21 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
     gsl_test_rel (kurt, expected, rel, NAME(gsl_stats) "_kurtosis");
   }
 
+  {
+    gsl_stats_summary_t s;
+    FUNCTION(gsl_stats,summary) (groupa, stridea, na, &s);
+    gsl_test (s.n != na, NAME(gsl_stats) "_summary n");
+    gsl_test_rel (s.mean, 0.0728, rel, NAME(gsl_stats) "_summary mean");
+    gsl_test_rel (gsl_stats_summary_sd (&s), 0.0350134479659107, rel,
+                  NAME(gsl_stats) "_summary sd");
+    gsl_test_rel (gsl_stats_summary_skew (&s), 0.0954642051479004, rel,
+                  NAME(gsl_stats) "_summary skew");
+    gsl_test_rel (gsl_stats_summary_kurtosis (&s), -1.38583851548909, rel,
+                  NAME(gsl_stats) "_summary kurtosis");
+    gsl_test (s.min != (double) groupa[3 * stridea] || s.max != (double) groupa[4 * stridea],
+              NAME(gsl_stats) "_summary min/max");
+  }
+
   {
     double wmean = FUNCTION(gsl_stats,wmean) (w, strideb, groupa, stridea, na);
     double expected = 0.0678111523670601;
@@ -414,6 +429,25 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
     free(work);
   }
 
+  {
+    const double p[5] = { 0.9, 0.0, 0.5, 0.25, 1.0 };
+    double q[5];
+    BASE * work = (BASE *) malloc (stridea * na * sizeof(BASE));
+
+    for (i = 0; i < na; i++)
+      work[i * stridea] = (BASE) rawa[i];
+
+    FUNCTION(gsl_stats,quantiles)(work, stridea, na, p, 5, q);
+
+    for (i = 0; i < 5; i++)
+      {
+        double expected = FUNCTION(gsl_stats,quantile_from_sorted_data)(sorted, stridea, na, p[i]);
+        gsl_test_rel(q[i], expected, rel, NAME(gsl_stats) "_quantiles (%g)", p[i]);
+      }
+
+    free(work);
+  }
+
   /* Test for IEEE handling - set third element to NaN */
 
   groupa [3*stridea] = GSL_NAN;
@@ -115,6 +115,20 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
     gsl_test_rel (kurt, expected, rel, NAME(gsl_stats) "_kurtosis");
   }
 
+  {
+    gsl_stats_summary_t s;
+    FUNCTION(gsl_stats,summary) (igroupa, stridea, ina, &s);
+    gsl_test (s.n != ina, NAME(gsl_stats) "_summary n");
+    gsl_test_rel (s.mean, 17.0, rel, NAME(gsl_stats) "_summary mean");
+    gsl_test_rel (gsl_stats_summary_variance (&s), 14.4210526315789, rel,
+                  NAME(gsl_stats) "_summary variance");
+    gsl_test_rel (gsl_stats_summary_skew (&s), -0.909355923168064, rel,
+                  NAME(gsl_stats) "_summary skew");
+    gsl_test_rel (gsl_stats_summary_kurtosis (&s), -0.233692524908094, rel,
+                  NAME(gsl_stats) "_summary kurtosis");
+    gsl_test (s.min != 8 || s.max != 22, NAME(gsl_stats) "_summary min/max");
+  }
+
   {
     double c = FUNCTION(gsl_stats,covariance) (igroupa, stridea, igroupb, strideb, inb);
     double expected = 14.5263157894737;
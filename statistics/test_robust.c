@@ -175,7 +175,7 @@ static int
 test_Sn(const double tol, const size_t n, gsl_rng * r)
 {
   double * x = malloc(n * sizeof(double));
-  double * work = malloc(n * sizeof(double));
+  double * work = malloc(2 * n * sizeof(double));
   double Sn1, Sn2;
 
   random_array(n, x, r);
@@ -183,6 +183,10 @@ test_Sn(const double tol, const size_t n, gsl_rng * r)
   /* compute S_n with slow/naive algorithm */
   Sn1 = slow_Sn0(n, x);
 
+  /* compute S_n from unsorted data */
+  Sn2 = gsl_stats_Sn0(x, 1, n, work);
+  gsl_test_rel(Sn2, Sn1, tol, "test_Sn unsorted n=%zu", n);
+
   /* compute S_n with efficient algorithm */
   gsl_sort(x, 1, n);
   Sn2 = gsl_stats_Sn0_from_sorted_data(x, 1, n, work);
@@ -199,7 +203,7 @@ static int
 test_Qn(const double tol, const size_t n, gsl_rng * r)
 {
   double * x = malloc(n * sizeof(double));
-  double * work = malloc(3 * n * sizeof(double));
+  double * work = malloc(4 * n * sizeof(double));
   int * work_int = malloc(5 * n * sizeof(int));
   double Qn1, Qn2;
 
@@ -208,6 +212,10 @@ test_Qn(const double tol, const size_t n, gsl_rng * r)
   /* compute Q_n with slow/naive algorithm */
   Qn1 = slow_Qn0(n, x);
 
+  /* compute Q_n from unsorted data */
+  Qn2 = gsl_stats_Qn0(x, 1, n, work, work_int);
+  gsl_test_rel(Qn2, Qn1, tol, "test_Qn unsorted n=%zu", n);
+
   /* compute Q_n with efficient algorithm */
   gsl_sort(x, 1, n);
   Qn2 = gsl_stats_Qn0_from_sorted_data(x, 1, n, work, work_int);
@@ -221,6 +229,56 @@ test_Qn(const double tol, const size_t n, gsl_rng * r)
   return 0;
 }
 
+/* compare the estimators computed from a sorted cache with the slow
+   versions; if round is set the data have many repeated values */
+static int
+test_sorted_cache(const double tol, const size_t n, const int round, gsl_rng * r)
+{
+  double * x = malloc(n * sizeof(double));
+  double * y = malloc(2 * n * sizeof(double));
+  gsl_stats_sorted_cache * c = gsl_stats_sorted_cache_alloc(2 * n);
+  size_t i;
+
+  random_array(n, x, r);
+
+  if (round)
+    {
+      for (i = 0; i < n; ++i)
+        x[i] = floor(10.0 * x[i]);
+    }
+
+  /* the data are stored with stride 2 */
+  for (i = 0; i < n; ++i)
+    y[2 * i] = x[i];
+
+  gsl_stats_sorted_cache_set(y, 2, n, c);
+
+  gsl_test_rel(gsl_stats_sorted_cache_mad0(c), slow_MAD(n, x), tol,
+               "test_sorted_cache mad0 n=%zu round=%d", n, round);
+  gsl_test_rel(gsl_stats_sorted_cache_Sn0(c), slow_Sn0(n, x), tol,
+               "test_sorted_cache Sn0 n=%zu round=%d", n, round);
+  gsl_test_rel(gsl_stats_sorted_cache_Qn0(c), slow_Qn0(n, x), tol,
+               "test_sorted_cache Qn0 n=%zu round=%d", n, round);
+
+  gsl_sort(x, 1, n);
+
+  gsl_test_rel(gsl_stats_sorted_cache_median(c),
+               gsl_stats_median_from_sorted_data(x, 1, n), tol,
+               "test_sorted_cache median n=%zu round=%d", n, round);
+  gsl_test_rel(gsl_stats_sorted_cache_quantile(0.9, c),
+               gsl_stats_quantile_from_sorted_data(x, 1, n, 0.9), tol,
+               "test_sorted_cache quantile n=%zu round=%d", n, round);
+  gsl_test_rel(gsl_stats_sorted_cache_Sn(c),
+               gsl_stats_Sn_from_sorted_data(x, 1, n, y), tol,
+               "test_sorted_cache Sn n=%zu round=%d", n, round);
+
+  free(x);
+  free(y);
+  gsl_stats_sorted_cache_free(c);
+
+  return 0;
+}
+
 int
 test_robust (void)
 {
@@ -251,6 +309,14 @@ test_robust (void)
   test_Sn(tol, 500, r);
   test_Sn(tol, 501, r);
 
+  test_sorted_cache(tol, 1, 0, r);
+  test_sorted_cache(tol, 2, 0, r);
+  test_sorted_cache(tol, 3, 0, r);
+  test_sorted_cache(tol, 100, 0, r);
+  test_sorted_cache(tol, 101, 1, r);
+  test_sorted_cache(tol, 500, 1, r);
+  test_sorted_cache(tol, 501, 0, r);
+
   test_Qn(tol, 1, r);
   test_Qn(tol, 2, r);
   test_Qn(tol, 3, r);